@@ -0,0 +1,194 @@
+#include "Generators.hh"
+#include <benchmark/benchmark.h>
+
+using namespace chase;
+
+namespace {
+
+// Contracts over range(0) variables, with formulas of depth range(1).
+void contractArgs(benchmark::internal::Benchmark *b) {
+  for (int variables : {4, 16, 64})
+    for (int depth : {2, 4, 6})
+      b->Args({variables, depth});
+}
+
+template <typename Operation>
+void runAlgebra(benchmark::State &state, Operation operation) {
+  WorkloadGenerator gen(42);
+  auto variables = static_cast<unsigned int>(state.range(0));
+  auto depth = static_cast<unsigned int>(state.range(1));
+  Contract *c1 = bench::randomContract(gen, "c1", variables, depth);
+  Contract *c2 = bench::randomContract(gen, "c2", variables, depth);
+  names_projection_map correspondences =
+      bench::identityCorrespondences(variables);
+  for (auto _ : state) {
+    Contract *r = operation(c1, c2, correspondences);
+    benchmark::DoNotOptimize(r);
+    delete r;
+  }
+  delete c1;
+  delete c2;
+}
+
+void BM_Composition(benchmark::State &state) {
+  runAlgebra(state, [](Contract *c1, Contract *c2,
+                       names_projection_map &m) {
+    return Contract::composition(c1, c2, m);
+  });
+}
+BENCHMARK(BM_Composition)->Apply(contractArgs);
+
+void BM_Conjunction(benchmark::State &state) {
+  runAlgebra(state, [](Contract *c1, Contract *c2,
+                       names_projection_map &m) {
+    return Contract::conjunction(c1, c2, m);
+  });
+}
+BENCHMARK(BM_Conjunction)->Apply(contractArgs);
+
+void BM_Quotient(benchmark::State &state) {
+  runAlgebra(state, [](Contract *c1, Contract *c2,
+                       names_projection_map &m) {
+    return Contract::quotient(c1, c2, m);
+  });
+}
+BENCHMARK(BM_Quotient)->Apply(contractArgs);
+
+void BM_RefinementCheck(benchmark::State &state) {
+  runAlgebra(state, [](Contract *c1, Contract *c2,
+                       names_projection_map &m) {
+    return Contract::refinementCheck(c1, c2, m);
+  });
+}
+BENCHMARK(BM_RefinementCheck)->Apply(contractArgs);
+
+void BM_CloneContract(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  Contract *c = bench::randomContract(
+      gen, "c", static_cast<unsigned int>(state.range(0)),
+      static_cast<unsigned int>(state.range(1)));
+  for (auto _ : state) {
+    Contract *r = c->clone();
+    benchmark::DoNotOptimize(r);
+    delete r;
+  }
+  delete c;
+}
+BENCHMARK(BM_CloneContract)->Apply(contractArgs);
+
+void BM_ContractString(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  Contract *c = bench::randomContract(
+      gen, "c", static_cast<unsigned int>(state.range(0)),
+      static_cast<unsigned int>(state.range(1)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(c->getString());
+  delete c;
+}
+BENCHMARK(BM_ContractString)->Apply(contractArgs);
+
+// Systems of range(0) contracts over 16 variables: deep and copy-on-write
+// clones, then the edit of one contract.
+void BM_SystemClone(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  workload_options options(static_cast<unsigned int>(state.range(0)), 16);
+  System *s = gen.generateSystem(options);
+  for (auto _ : state) {
+    System *clone = s->clone();
+    benchmark::DoNotOptimize(clone);
+    delete clone;
+  }
+  delete s;
+}
+BENCHMARK(BM_SystemClone)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_SystemLazyCloneEdit(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  workload_options options(static_cast<unsigned int>(state.range(0)), 16);
+  System *s = gen.generateSystem(options);
+  for (auto _ : state) {
+    System *clone = s->lazyClone();
+    Contract *first = *clone->getContractsSet().begin();
+    Contract *c = clone->getMutableContract(first);
+    benchmark::DoNotOptimize(c);
+    delete clone;
+  }
+  delete s;
+}
+BENCHMARK(BM_SystemLazyCloneEdit)->RangeMultiplier(4)->Range(4, 256);
+
+// Formulas: deep chains of unary operators and wide conjunctions of size
+// range(0).
+void BM_SimplifyDeep(benchmark::State &state) {
+  auto vars = bench::makeVariables(4);
+  LogicFormula *f =
+      bench::deepFormula(vars, static_cast<unsigned int>(state.range(0)));
+  simplify_options options;
+  for (auto _ : state) {
+    state.PauseTiming();
+    LogicFormula *copy = f->clone();
+    state.ResumeTiming();
+    simplify(copy, &options);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_SimplifyDeep)->DenseRange(4, 16, 4);
+
+void BM_SimplifyWide(benchmark::State &state) {
+  auto vars = bench::makeVariables(16);
+  LogicFormula *f =
+      bench::wideFormula(vars, static_cast<unsigned int>(state.range(0)));
+  simplify_options options;
+  for (auto _ : state) {
+    state.PauseTiming();
+    LogicFormula *copy = f->clone();
+    state.ResumeTiming();
+    simplify(copy, &options);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_SimplifyWide)->RangeMultiplier(4)->Range(16, 1024);
+
+void BM_CloneDeep(benchmark::State &state) {
+  auto vars = bench::makeVariables(4);
+  LogicFormula *f =
+      bench::deepFormula(vars, static_cast<unsigned int>(state.range(0)));
+  for (auto _ : state) {
+    LogicFormula *copy = f->clone();
+    benchmark::DoNotOptimize(copy);
+    delete copy;
+  }
+}
+BENCHMARK(BM_CloneDeep)->RangeMultiplier(4)->Range(16, 4096);
+
+void BM_CloneWide(benchmark::State &state) {
+  auto vars = bench::makeVariables(16);
+  LogicFormula *f =
+      bench::wideFormula(vars, static_cast<unsigned int>(state.range(0)));
+  for (auto _ : state) {
+    LogicFormula *copy = f->clone();
+    benchmark::DoNotOptimize(copy);
+    delete copy;
+  }
+}
+BENCHMARK(BM_CloneWide)->RangeMultiplier(4)->Range(16, 4096);
+
+void BM_StringDeep(benchmark::State &state) {
+  auto vars = bench::makeVariables(4);
+  LogicFormula *f =
+      bench::deepFormula(vars, static_cast<unsigned int>(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(f->getString());
+}
+BENCHMARK(BM_StringDeep)->RangeMultiplier(4)->Range(16, 4096);
+
+void BM_StringWide(benchmark::State &state) {
+  auto vars = bench::makeVariables(16);
+  LogicFormula *f =
+      bench::wideFormula(vars, static_cast<unsigned int>(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(f->getString());
+}
+BENCHMARK(BM_StringWide)->RangeMultiplier(4)->Range(16, 4096);
+
+} // namespace
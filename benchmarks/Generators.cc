@@ -0,0 +1,83 @@
+#include "Generators.hh"
+
+using namespace chase;
+
+namespace bench {
+
+std::vector<Variable *> makeVariables(unsigned int count,
+                                      const std::string &prefix) {
+  std::vector<Variable *> vars;
+  for (unsigned int i = 0; i < count; ++i)
+    vars.push_back(
+        new Variable(new Boolean(), new Name(prefix + std::to_string(i))));
+  return vars;
+}
+
+LogicFormula *deepFormula(const std::vector<Variable *> &vars,
+                          unsigned int depth) {
+  LogicFormula *f = Prop(vars[0]);
+  for (unsigned int i = 0; i < depth; ++i) {
+    switch (i % 4) {
+    case 0:
+      f = Always(f);
+      break;
+    case 1:
+      f = Eventually(f);
+      break;
+    case 2:
+      f = Next(f);
+      break;
+    default:
+      f = Not(f);
+      break;
+    }
+  }
+  return f;
+}
+
+LogicFormula *wideFormula(const std::vector<Variable *> &vars,
+                          unsigned int width) {
+  std::vector<LogicFormula *> operands;
+  for (unsigned int i = 0; i < width; ++i) {
+    Proposition *p = Prop(vars[i % vars.size()]);
+    operands.push_back(i % 2 ? Eventually(p) : Always(p));
+  }
+  return LargeAnd(operands);
+}
+
+Contract *randomContract(WorkloadGenerator &gen, const std::string &name,
+                         unsigned int variables, unsigned int depth) {
+  workload_options options(1, variables, depth, 1);
+  options.temporal = 4.0 / 7.0;
+  return gen.generateContract(name, options);
+}
+
+names_projection_map identityCorrespondences(unsigned int variables) {
+  names_projection_map map;
+  for (unsigned int i = 0; i < variables; ++i)
+    map["v" + std::to_string(i)] = "v" + std::to_string(i);
+  return map;
+}
+
+Graph *randomGraph(WorkloadGenerator &gen, unsigned int size,
+                   unsigned int degree, bool directed) {
+  edge_list edges;
+  for (unsigned int i = 0; i < size * degree; ++i)
+    edges.emplace_back(static_cast<unsigned int>(gen.uniform(size)),
+                       static_cast<unsigned int>(gen.uniform(size)));
+  return WorkloadGenerator::buildGraph(size, edges, directed, true);
+}
+
+Graph *ladderGraph(unsigned int size) {
+  auto g = new Graph(size, true);
+  for (unsigned int i = 0; i < size; ++i) {
+    g->associateVertex(i, new Vertex(new Name("n" + std::to_string(i))));
+    if (i + 1 < size)
+      g->addEdge(new Edge(i, i + 1));
+    if (i + 2 < size)
+      g->addEdge(new Edge(i, i + 2));
+  }
+  return g;
+}
+
+} // namespace bench
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "chase-core.hh"
+
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Boolean variables named <prefix>0 ... <prefix>(count - 1).
+std::vector<chase::Variable *> makeVariables(unsigned int count,
+                                             const std::string &prefix = "v");
+
+// Chain of depth nested unary operators (G, F, X, !) over a proposition.
+chase::LogicFormula *deepFormula(const std::vector<chase::Variable *> &vars,
+                                 unsigned int depth);
+
+// Flat conjunction of width propositions, alternating G and F.
+chase::LogicFormula *wideFormula(const std::vector<chase::Variable *> &vars,
+                                 unsigned int width);
+
+// Contract over variables named v0 ... v(count - 1), with random assumptions
+// and guarantees of the given depth.
+chase::Contract *randomContract(chase::WorkloadGenerator &gen,
+                                const std::string &name,
+                                unsigned int variables, unsigned int depth);
+
+// Correspondences matching the names v0 ... v(count - 1).
+chase::names_projection_map identityCorrespondences(unsigned int variables);
+
+// Random graph with the given average out-degree. Every vertex is named.
+chase::Graph *randomGraph(chase::WorkloadGenerator &gen, unsigned int size,
+                          unsigned int degree, bool directed = true);
+
+// Directed graph with edges i -> i + 1 and i -> i + 2, whose number of paths
+// between the first and the last vertex grows as the Fibonacci numbers.
+chase::Graph *ladderGraph(unsigned int size);
+
+} // namespace bench
@@ -0,0 +1,337 @@
+#include "Generators.hh"
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <sstream>
+
+using namespace chase;
+
+namespace {
+
+// Random graphs with range(0) vertexes and average out-degree 4.
+void BM_GetEdge(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 4);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        g->getEdge(gen.uniform(size), gen.uniform(size)));
+}
+BENCHMARK(BM_GetEdge)->RangeMultiplier(4)->Range(64, 16384);
+
+void BM_GetAdjacentNodes(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 4);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(g->getAdjacentNodes(gen.uniform(size)));
+}
+BENCHMARK(BM_GetAdjacentNodes)->RangeMultiplier(4)->Range(64, 16384);
+
+// Ladder graphs with range(0) vertexes: the number of paths between the
+// first and the last vertex is the range(0)-th Fibonacci number.
+void BM_FindAllPaths(benchmark::State &state) {
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::ladderGraph(size);
+  size_t paths = 0;
+  for (auto _ : state) {
+    std::vector<unsigned int> visited{0};
+    std::list<std::vector<unsigned int>> result;
+    findAllPathsBetweenNodes(g, visited, size - 1, result);
+    paths = result.size();
+  }
+  state.counters["paths"] = static_cast<double>(paths);
+}
+BENCHMARK(BM_FindAllPaths)->DenseRange(8, 20, 4);
+
+// Reachability index of random graphs with range(0) vertexes, built and
+// queried on random pairs.
+void BM_ReachabilityBuild(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 2);
+  for (auto _ : state) {
+    ReachabilityIndex index(g);
+    benchmark::DoNotOptimize(index.getComponentsCount());
+  }
+}
+BENCHMARK(BM_ReachabilityBuild)
+    ->RangeMultiplier(8)
+    ->Range(1 << 9, 1 << 15)
+    ->Unit(benchmark::kMillisecond);
+
+// range(1) is 1 for the bit matrix, 0 for the interval labels.
+void BM_ReachabilityQuery(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 1);
+  ReachabilityIndex index(g, state.range(1) ? size_t(1) << 28 : 0);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        index.reaches(gen.uniform(size), gen.uniform(size)));
+}
+BENCHMARK(BM_ReachabilityQuery)
+    ->ArgsProduct({{1 << 10, 1 << 14}, {0, 1}});
+
+// range(1) is the scc_algorithm.
+void BM_StronglyConnectedComponents(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 2);
+  const compact_adjacency &adjacency = g->getAdjacency();
+  auto algorithm = static_cast<scc_algorithm>(state.range(1));
+  std::vector<unsigned int> component;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        getStronglyConnectedComponents(adjacency, component, algorithm));
+}
+BENCHMARK(BM_StronglyConnectedComponents)
+    ->ArgsProduct({{1 << 10, 1 << 14, 1 << 18}, {0, 1}});
+
+// Random integer weights; range(1) is the dijkstra_heap.
+void BM_ShortestPaths(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 4);
+  const compact_adjacency &adjacency = g->getAdjacency();
+  std::vector<double> weights(g->getEdgesCount());
+  for (auto &w : weights)
+    w = static_cast<double>(gen.uniform(1000));
+  auto heap = static_cast<dijkstra_heap>(state.range(1));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        findShortestPaths(adjacency, weights, gen.uniform(size), heap));
+}
+BENCHMARK(BM_ShortestPaths)
+    ->ArgsProduct({{1 << 10, 1 << 14, 1 << 18}, {0, 1}});
+
+void BM_KShortestPaths(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 4);
+  const compact_adjacency &adjacency = g->getAdjacency();
+  std::vector<double> weights(g->getEdgesCount());
+  for (auto &w : weights)
+    w = static_cast<double>(gen.uniform(1000));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(findKShortestPaths(
+        adjacency, weights, gen.uniform(size), gen.uniform(size), 8));
+}
+BENCHMARK(BM_KShortestPaths)->RangeMultiplier(8)->Range(1 << 8, 1 << 14);
+
+// range(1) is 0 for edge-disjoint paths, 1 for vertex-disjoint paths.
+void BM_DisjointPaths(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 8);
+  const compact_adjacency &adjacency = g->getAdjacency();
+  for (auto _ : state) {
+    unsigned int source = gen.uniform(size);
+    unsigned int target = (source + 1 + gen.uniform(size - 1)) % size;
+    benchmark::DoNotOptimize(
+        state.range(1) ? countVertexDisjointPaths(adjacency, source, target)
+                       : countEdgeDisjointPaths(adjacency, source, target));
+  }
+}
+BENCHMARK(BM_DisjointPaths)
+    ->ArgsProduct({{1 << 10, 1 << 14}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// range(1) is 0 for getGraphViz, 1 for writeGraphViz, 2 for writeGraphML.
+void BM_WriteGraph(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 4);
+  for (auto _ : state) {
+    std::ostringstream out;
+    if (state.range(1) == 0)
+      out << g->getGraphViz();
+    else if (state.range(1) == 1)
+      writeGraphViz(g, out);
+    else
+      writeGraphML(g, out);
+    benchmark::DoNotOptimize(out.tellp());
+  }
+}
+BENCHMARK(BM_WriteGraph)
+    ->ArgsProduct({{1 << 10, 1 << 16}, {0, 1, 2}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Sub-graph with half of the vertexes of a random graph.
+void BM_GetSubGraph(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 4);
+  std::set<Vertex *> vertexes;
+  for (unsigned int i = 0; i < size; i += 2)
+    vertexes.insert(g->getVertex(i));
+  for (auto _ : state) {
+    Graph *sub = getSubGraph(g, vertexes);
+    benchmark::DoNotOptimize(sub);
+  }
+}
+BENCHMARK(BM_GetSubGraph)->RangeMultiplier(4)->Range(16, 16384);
+
+// The same sub-graph as a view, with its compact adjacency.
+void BM_GraphView(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 4);
+  std::vector<unsigned int> nodes;
+  for (unsigned int i = 0; i < size; i += 2)
+    nodes.push_back(i);
+  for (auto _ : state) {
+    GraphView view(g, nodes);
+    benchmark::DoNotOptimize(view.getAdjacency().targets.data());
+  }
+}
+BENCHMARK(BM_GraphView)->RangeMultiplier(4)->Range(16, 16384);
+
+void BM_GetVertexIndex(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 4);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        g->getVertexIndex("n" + std::to_string(gen.uniform(size))));
+}
+BENCHMARK(BM_GetVertexIndex)->RangeMultiplier(4)->Range(64, 16384);
+
+// Workload generation: scale-free graphs with range(0) vertexes and three
+// edges per vertex, and square grids with range(0) vertexes.
+void BM_GeneratePowerLaw(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  edge_list edges;
+  for (auto _ : state) {
+    gen.generatePowerLawEdges(size, 3, edges);
+    benchmark::DoNotOptimize(edges.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GeneratePowerLaw)
+    ->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_GenerateGrid(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto side = static_cast<unsigned int>(state.range(0));
+  edge_list edges;
+  for (auto _ : state) {
+    gen.generateGridEdges(side, side, edges);
+    benchmark::DoNotOptimize(edges.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) *
+                          state.range(0));
+}
+BENCHMARK(BM_GenerateGrid)
+    ->RangeMultiplier(4)
+    ->Range(64, 1024)
+    ->Unit(benchmark::kMillisecond);
+
+// Graph construction from range(0) edges over range(0) / 4 vertexes:
+// range(1) is 0 for one addEdge per edge, 1 for the bulk constructor.
+void BM_BuildGraph(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto edges = static_cast<unsigned int>(state.range(0));
+  unsigned int size = edges / 4;
+  std::vector<unsigned int> sources(edges), targets(edges);
+  for (unsigned int e = 0; e < edges; ++e) {
+    sources[e] = gen.uniform(size);
+    targets[e] = gen.uniform(size);
+  }
+  for (auto _ : state) {
+    Graph *g;
+    if (state.range(1)) {
+      g = new Graph(size, sources, targets, std::vector<double>(), true);
+    } else {
+      g = new Graph(size, true);
+      for (unsigned int e = 0; e < edges; ++e)
+        g->addEdge(new Edge(sources[e], targets[e]));
+      g->getAdjacency();
+    }
+    benchmark::DoNotOptimize(g);
+    state.PauseTiming();
+    delete g;
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BuildGraph)
+    ->ArgsProduct({{1 << 16, 1 << 20}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+// Reachability from 256 sources: range(1) is 0 for one getAdjacentNodes
+// search per source, 1 for the bit-parallel search, 2 for the bit-parallel
+// search on a pool.
+void BM_MultiSourceReachability(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 8);
+  std::vector<unsigned int> sources(256);
+  for (auto &s : sources)
+    s = gen.uniform(size);
+  ThreadPool pool;
+  BreadthFirstSearch search(g, state.range(1) == 2 ? &pool : nullptr);
+  for (auto _ : state) {
+    if (state.range(1) == 0) {
+      for (auto s : sources) {
+        std::vector<bool> reached(size, false);
+        std::list<unsigned int> queue{s};
+        reached[s] = true;
+        while (!queue.empty()) {
+          for (auto n : g->getAdjacentNodes(queue.front()))
+            if (!reached[n]) {
+              reached[n] = true;
+              queue.push_back(n);
+            }
+          queue.pop_front();
+        }
+        benchmark::DoNotOptimize(reached);
+      }
+    } else {
+      benchmark::DoNotOptimize(search.getReachedSets(sources));
+    }
+  }
+}
+BENCHMARK(BM_MultiSourceReachability)
+    ->ArgsProduct({{1 << 10, 1 << 14}, {0, 1, 2}})
+    ->Unit(benchmark::kMillisecond);
+
+// Single-source distances on a dense graph: range(1) is 0 without a pool,
+// 1 with a pool.
+void BM_DirectionOptimizingSearch(benchmark::State &state) {
+  WorkloadGenerator gen(42);
+  auto size = static_cast<unsigned int>(state.range(0));
+  Graph *g = bench::randomGraph(gen, size, 16);
+  ThreadPool pool;
+  BreadthFirstSearch search(g, state.range(1) ? &pool : nullptr);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(search.getDistances(gen.uniform(size)));
+}
+BENCHMARK(BM_DirectionOptimizingSearch)
+    ->ArgsProduct({{1 << 14, 1 << 18}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+// Partition of a power-law graph into range(1) parts, reporting the cut
+// weight as a fraction of the edges.
+void BM_PartitionGraph(benchmark::State &state) {
+  auto size = static_cast<unsigned int>(state.range(0));
+  auto parts = static_cast<unsigned int>(state.range(1));
+  Graph *g = WorkloadGenerator(42).generatePowerLawGraph(size, 4, false);
+  const compact_adjacency &adjacency = g->getAdjacency();
+  std::vector<unsigned int> partition;
+  for (auto _ : state) {
+    partition = partitionGraph(adjacency, {}, parts);
+    benchmark::DoNotOptimize(partition);
+  }
+  state.counters["cut"] =
+      getCutWeight(adjacency, {}, partition) / g->getEdgesCount();
+  delete g;
+}
+BENCHMARK(BM_PartitionGraph)
+    ->ArgsProduct({{1 << 12, 1 << 16}, {2, 16}})
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
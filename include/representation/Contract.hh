@@ -13,6 +13,9 @@
 
 #include <list>
 #include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 
 
@@ -22,7 +25,31 @@ namespace chase {
     /// used to during the operations in the algebra.
     typedef std::map<std::string, std::string> names_projection_map;
 
+    class DataDeclaration;
+    class Identifier;
+
+    /// @brief Map from the declarations to the identifiers referring to them.
+    typedef std::unordered_map< DataDeclaration *, std::vector< Identifier * > >
+            occurrences_map;
+
+    /// @brief Structure of the index of the occurrences of the declarations
+    /// in the formulas of a contract.
+    typedef struct occurrence_index {
+        /// @brief Occurrences in the assumptions.
+        occurrences_map assumptions;
+        /// @brief Occurrences in the guarantees.
+        occurrences_map guarantees;
+    } occurrence_index;
+
     /// @brief Class to represent contracts.
+    /// The operations of the algebra (composition, conjunction, quotient and
+    /// refinementCheck) only read their input contracts: the result is built
+    /// from clones of the input declarations and formulas, and the inputs
+    /// (including the parent links of their nodes) are never modified. The
+    /// operations do not use global state, so they can run concurrently,
+    /// also on shared inputs, provided that no thread modifies the inputs
+    /// meanwhile. saturate modifies its argument, and needs exclusive
+    /// access to it.
     class Contract : public Scope {
     public:
 
@@ -57,6 +84,45 @@ namespace chase {
         /// @param spec Pointer to the the specification to add.
         void addGuarantees( semantic_domain domain, Specification * spec );
 
+        /// @brief Function enabling the index of the occurrences of the
+        /// declarations in the assumptions and guarantees, or rebuilding it.
+        /// Building the index costs a traversal of the formulas. Then, it is
+        /// updated incrementally by addAssumptions, addGuarantees,
+        /// renameOccurrences and saturate, and it is inherited by the clones
+        /// and by the results of the algebra. Formulas modified by other
+        /// means require rebuilding it.
+        void enableOccurrenceIndex();
+
+        /// @brief Function disabling the index of the occurrences, and
+        /// releasing its memory.
+        void disableOccurrenceIndex();
+
+        /// @brief Function checking whether the index of the occurrences is
+        /// enabled.
+        /// @return True if the index is enabled.
+        bool hasOccurrenceIndex() const;
+
+        /// @brief Function providing the identifiers referring to a
+        /// declaration. The index must be enabled.
+        /// @param declaration The declaration.
+        /// @param inAssumptions True for the occurrences in the assumptions,
+        /// false for the ones in the guarantees.
+        /// @return The identifiers.
+        const std::vector< Identifier * > & getOccurrences(
+                DataDeclaration * declaration, bool inAssumptions ) const;
+
+        /// @brief Function providing the whole index of the occurrences. The
+        /// index must be enabled.
+        /// @return The index.
+        const occurrence_index & getOccurrenceIndex() const;
+
+        /// @brief Function redirecting all the identifiers referring to a
+        /// declaration to another one, in time linear in the number of
+        /// occurrences. The index must be enabled.
+        /// @param from The declaration currently referred.
+        /// @param to The declaration to refer.
+        void renameOccurrences( DataDeclaration * from, DataDeclaration * to );
+
         /// @brief Base function for the visitor pattern.
         /// @param v The visitor to be used.
         /// @return The return value of the visitor.
@@ -193,6 +259,23 @@ namespace chase {
         /// by multiple contracts.
         Name * _name;
 
+        /// @brief Index of the occurrences. Null when it is disabled.
+        std::unique_ptr< occurrence_index > _occurrences;
+
+        /// @brief Function adding identifiers to the index of the
+        /// occurrences, if it is enabled.
+        /// @param identifiers The identifiers.
+        /// @param inAssumptions True if they are in the assumptions.
+        void _indexOccurrences(
+                const std::vector< Identifier * > & identifiers,
+                bool inAssumptions );
+
+        /// @brief Function adding the identifiers of a specification to the
+        /// index of the occurrences, if it is enabled.
+        /// @param spec The specification.
+        /// @param inAssumptions True if it is an assumption.
+        void _indexOccurrences( Specification * spec, bool inAssumptions );
+
 
 
 
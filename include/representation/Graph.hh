@@ -13,8 +13,12 @@
 #include "representation/Specification.hh"
 #include "representation/Value.hh"
 
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace chase {
@@ -84,7 +88,8 @@ namespace chase {
         /// @return The name of the vertex.
         Name *getName() const;
 
-        /// @brief Function to set the name of the vertex.
+        /// @brief Function to set the name of the vertex. The name index of
+        /// the graph containing the vertex is updated.
         /// @param name the standard string of the vertex name to be assigned.
         void setName(std::string name);
 
@@ -93,8 +98,8 @@ namespace chase {
         /// @return The return value of the visitor.
         int accept_visitor(chase::BaseVisitor &v) override;
 
-        /// @brief ATTENTION: this function is not implemented.
-        /// \todo Implement the getGraphViz function.
+        /// @brief Function providing the GraphViz attributes of the vertex.
+        /// @return The attribute list, labeling the node with the name.
         virtual std::string getGraphViz();
 
         /// @brief Function printing the vertex.
@@ -160,7 +165,36 @@ namespace chase {
 
 
 
+    /// @brief Compact adjacency of a graph, in compressed sparse row format:
+    /// the neighbors of the node i are targets[offsets[i]] ...
+    /// targets[offsets[i + 1] - 1]. Undirected edges appear in the rows of
+    /// both their nodes.
+    typedef struct compact_adjacency {
+        /// @brief Start of the row of each node, plus the end of the last one.
+        std::vector< unsigned int > offsets;
+        /// @brief Neighbors of the nodes.
+        std::vector< unsigned int > targets;
+        /// @brief Index of the edge of each neighbor (see Graph::getEdgeAt).
+        std::vector< unsigned int > edges;
+
+        /// @brief Function providing the number of nodes.
+        /// @return The number of nodes.
+        unsigned int getSize() const
+        {
+            return offsets.empty() ? 0 :
+                   static_cast< unsigned int >(offsets.size() - 1);
+        }
+    } compact_adjacency;
+
     /// @brief Base class to represent graphs.
+    /// The graph keeps the outgoing edges of every node, and an index from
+    /// the names of the vertexes to their nodes. Edges must not be modified
+    /// after being added, and vertexes must be renamed through
+    /// Vertex::setName, so that both stay consistent.
+    /// Graphs can also be loaded in bulk, from arrays of sources and targets:
+    /// the Edge objects of those edges are then created only when an edge
+    /// object is requested (getEdgeAt, getEdges, getEdge, getIncidentEdges),
+    /// while the algorithms working on the compact adjacency never need them.
     /// @todo GraphViz support for the graphical representation of the Graph.
     class Graph : public Specification {
     public:
@@ -169,6 +203,23 @@ namespace chase {
         Graph( unsigned int size, bool directed = false,
                 Name * name = new Name("GenericGraph") );
 
+        /// @brief Constructor loading the edges in bulk, from parallel
+        /// arrays. The compact adjacency is built directly, and no Edge
+        /// object is created until one is requested: edges with a weight
+        /// become WeightedEdge objects with a RealValue weight.
+        /// @param size The number of nodes.
+        /// @param sources The source of each edge.
+        /// @param targets The target of each edge.
+        /// @param weights The weight of each edge, or no weight at all.
+        /// @param directed True for a directed graph.
+        /// @param name The name of the graph.
+        Graph( unsigned int size,
+               std::vector< unsigned int > sources,
+               std::vector< unsigned int > targets,
+               std::vector< double > weights = std::vector< double >(),
+               bool directed = false,
+               Name * name = new Name("GenericGraph") );
+
         /// @brief Destructor.
         ~Graph() override;
 
@@ -187,20 +238,63 @@ namespace chase {
         void associateVertex(unsigned int index, Vertex *vertex);
 
         /// @brief Function to add a edge to the graph.
-        /// @param edge The edge to be added.
+        /// @param edge The edge to be added. Its nodes must be in the graph.
         void addEdge( Edge * edge );
 
         /// @brief Function retrieving the type of graph.
         /// @return True if the graph is directed. False otherwise.
         bool isDirected() const;
 
-        /// @brief Analyze whether an edge exists between two given nodes.
+        /// @brief Analyze whether an edge exists between two given nodes, in
+        /// time linear in the degree of the source.
         /// @param source The source of the searched edge.
         /// @param target The target of the searched edge.
         /// @return A pointer to the edge if the edge exists.
         /// A nullptr otherwise.
         Edge * getEdge( unsigned int source, unsigned int target );
 
+        /// @brief Getter of the edges of the graph.
+        /// @return The set of the edges.
+        const std::set< Edge * > & getEdges() const;
+
+        /// @brief Function providing the number of edges of the graph.
+        /// @return The number of edges.
+        unsigned int getEdgesCount() const;
+
+        /// @brief Function providing the source of an edge, without creating
+        /// its Edge object.
+        /// @param index The index of the edge (see getEdgeAt).
+        /// @return The source node.
+        unsigned int getEdgeSource( unsigned int index ) const;
+
+        /// @brief Function providing the target of an edge, without creating
+        /// its Edge object.
+        /// @param index The index of the edge (see getEdgeAt).
+        /// @return The target node.
+        unsigned int getEdgeTarget( unsigned int index ) const;
+
+        /// @brief Function providing the number of edges loaded in bulk.
+        /// They are the first ones in index order.
+        /// @return The number of edges.
+        unsigned int getBulkEdgesCount() const;
+
+        /// @brief Function providing the weights of the edges loaded in bulk.
+        /// @return The weights, indexed as the edges, or an empty vector if
+        /// the edges were loaded without weights.
+        const std::vector< double > & getBulkWeights() const;
+
+        /// @brief Function providing an edge by its index. Edges are indexed
+        /// in insertion order.
+        /// @param index The index of the edge.
+        /// @return The edge.
+        Edge * getEdgeAt( unsigned int index ) const;
+
+        /// @brief Function providing the compact adjacency of the graph. It
+        /// is built on the first request after a change of the graph, in
+        /// time linear in its size, and it can be requested concurrently.
+        /// @return The adjacency. It is valid until the graph is modified.
+        const compact_adjacency & getAdjacency();
+
         /// @brief Return the Vertex object associated to a index of vertex in
         /// the graph. Notice: it is not mandatory to associate a vertex in the
         /// graph with a Vertex object.
@@ -216,10 +310,11 @@ namespace chase {
         unsigned int getSize() const;
 
         /// @brief Function searching a Vertex by name in a graph. It returns
-        /// the index of the vertex.
+        /// the index of the vertex, in constant time on average.
         /// @param name The name to search.
-        /// @return the index of the vertex if found, -1 if not found.
-        int getVertexIndex(std::string name );
+        /// @return the index of the vertex if found, -1 if not found. If
+        /// several vertexes have the name, the lowest index.
+        int getVertexIndex( const std::string & name );
 
         /// @brief Getter of the name.
         /// @return The name of the graph.
@@ -229,8 +324,10 @@ namespace chase {
         /// @param name Pointer to the Name object containing the name.
         void setName(Name *name);
 
-        /// @brief ATTENTION: this function is not implemented.
-        /// \todo Implement the getGraphViz function.
+        /// @brief Function printing the graph in the GraphViz DOT format.
+        /// Large graphs should rather be written to a stream, with
+        /// writeGraphViz (see utilities/GraphWriters.hh).
+        /// @return The DOT representation of the graph.
         std::string getGraphViz();
 
         /// @brief Function to retrieve all the nodes adjacent to a given node.
@@ -240,16 +337,21 @@ namespace chase {
         /// @return a vector containing the indexes of the adjacent nodes to id.
         std::set< unsigned int > getAdjacentNodes( unsigned int id );
 
+        /// @brief Function providing the edges incident to a node: the edges
+        /// leaving it and, if the graph is undirected, the edges entering it.
+        /// @param id The ID of the node.
+        /// @return The edges, in insertion order.
+        const std::vector< Edge * > & getIncidentEdges( unsigned int id ) const;
+
         /// @brief Clone method.
         /// @return Clone of the object.
         Graph * clone() override;
 
     protected:
 
-        /// @brief Adjacency matrix of the graph.
-        AdjMatrix _matrix;
-        /// @brief Set of edges of the graph.
-        std::set< Edge * > _edges;
+        /// @brief Set of edges of the graph. It lacks the edges loaded in
+        /// bulk until _edgesMaterialized is true.
+        mutable std::set< Edge * > _edges;
         /// @brief Set of nodes in the graph.
         std::vector< Vertex * > _vertexes;
 
@@ -261,6 +363,58 @@ namespace chase {
         /// @brief the name of the graph.
         Name * _name;
 
+        /// @brief Edges incident to each node (see getIncidentEdges). It is
+        /// built when _edgesMaterialized becomes true.
+        mutable std::vector< std::vector< Edge * > > _incident;
+        /// @brief Edges in insertion order. The edges loaded in bulk are null
+        /// until _edgesMaterialized is true.
+        mutable std::vector< Edge * > _edgeList;
+        /// @brief Source of each edge, in insertion order.
+        std::vector< unsigned int > _edgeSources;
+        /// @brief Target of each edge, in insertion order.
+        std::vector< unsigned int > _edgeTargets;
+        /// @brief Number of edges loaded in bulk.
+        unsigned int _bulkEdges;
+        /// @brief Weights of the edges loaded in bulk, if any.
+        std::vector< double > _bulkWeights;
+        /// @brief True if all the edges have their Edge object.
+        mutable std::atomic< bool > _edgesMaterialized;
+        /// @brief Mutex serializing the creation of the Edge objects.
+        mutable std::mutex _edgesMutex;
+
+        /// @brief Compact adjacency, when _adjacencyValid is true.
+        compact_adjacency _adjacency;
+        /// @brief True if _adjacency reflects the edges of the graph.
+        std::atomic< bool > _adjacencyValid;
+        /// @brief Mutex serializing the builds of the compact adjacency.
+        std::mutex _adjacencyMutex;
+
+        /// @brief Index from the names of the vertexes to the lowest index of
+        /// a vertex having the name.
+        std::unordered_map< std::string, unsigned int > _vertexNames;
+        /// @brief Indexes of the other vertexes having the same name of a
+        /// vertex in _vertexNames.
+        std::unordered_multimap< std::string, unsigned int > _duplicateNames;
+
+        /// @brief Function adding a vertex to the name index.
+        /// @param name The name of the vertex.
+        /// @param index The index of the vertex.
+        void _indexVertexName( const std::string & name, unsigned int index );
+
+        /// @brief Function removing a vertex from the name index.
+        /// @param name The name of the vertex.
+        /// @param index The index of the vertex.
+        void _unindexVertexName( const std::string & name, unsigned int index );
+
+        /// @brief Function creating the Edge objects of the edges loaded in
+        /// bulk, and indexing them, on the first request.
+        void _materializeEdges() const;
+
+        /// @brief Function building the compact adjacency from the sources
+        /// and targets of the edges.
+        void _buildAdjacency();
+
+        friend class Vertex;
     };
 
 }
@@ -13,6 +13,8 @@
 #include "representation/Value.hh"
 #include "representation/DataDeclaration.hh"
 
+#include <vector>
+
 namespace chase {
 
     /// @brief Class describing the instance of a declared object.
@@ -72,6 +74,55 @@ namespace chase {
             /// @brief Boolean to indicate whether the identified variable
             /// is primed or not.
             bool _primed;
+
+            /// @brief True if the identifier was created while an
+            /// IdentifierRecorder was active.
+            bool _recorded;
+
+            friend class IdentifierRecorder;
+    };
+
+    /// @brief Recorder of the identifiers created in a scope of the current
+    /// thread. It provides the index of the identifiers of a cloned tree
+    /// without traversing it, so that their declarations can be fixed by
+    /// ClonedDeclarationVisitor::remap. The identifiers deleted within the
+    /// scope are dropped from the index. Recorders can be nested: when a
+    /// recorder is destroyed, its identifiers are passed to the enclosing
+    /// one.
+    class IdentifierRecorder
+    {
+        public:
+            /// @brief Constructor. It starts recording.
+            IdentifierRecorder();
+
+            /// @brief Destructor. It stops recording.
+            ~IdentifierRecorder();
+
+            IdentifierRecorder( const IdentifierRecorder & ) = delete;
+            IdentifierRecorder & operator=(
+                    const IdentifierRecorder & ) = delete;
+
+            /// @brief Function providing the identifiers created since the
+            /// construction of the recorder, and not deleted.
+            /// @return The identifiers, in creation order.
+            const std::vector< Identifier * > & getIdentifiers() const;
+
+            /// @brief Function recording the creation of an identifier. It
+            /// does nothing if no recorder is active in the thread.
+            /// @param i The identifier.
+            static void recordCreation( Identifier * i );
+
+            /// @brief Function recording the deletion of an identifier. It
+            /// does nothing if no recorder is active in the thread.
+            /// @param i The identifier.
+            static void recordDeletion( Identifier * i );
+
+        protected:
+            /// @brief Recorder active when this one was created.
+            IdentifierRecorder * _parent;
+
+            /// @brief Recorded identifiers.
+            std::vector< Identifier * > _identifiers;
     };
 
 }
@@ -11,8 +11,24 @@
 #include "Contract.hh"
 #include "Scope.hh"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace chase {
 
+class System;
+
+/// @brief Structure recording, for the objects shared by the systems created
+/// with System::lazyClone, which systems hold each of them.
+typedef struct shared_objects {
+  /// @brief Mutex protecting the holders.
+  std::mutex mutex;
+  /// @brief Systems holding each shared object.
+  std::unordered_map<ChaseObject *, std::vector<System *>> holders;
+} shared_objects;
+
 /// @brief Class representing a System composed by multiple contracts.
 class System : public Scope {
 public:
@@ -68,11 +84,74 @@ public:
   /// @return A clone of the object.
   System *clone() override;
 
+  /// @brief Copy-on-write clone. The clone shares the declarations, the
+  /// contracts and the components with this system, so that it costs a
+  /// pointer copy per object rather than a deep copy. Shared objects are
+  /// copied the first time one of the systems asks for them through
+  /// getMutableDeclaration, getMutableContract or getMutableComponent, so
+  /// memory grows with the edits. Every system holding a shared object must
+  /// use these methods before modifying it, and a shared object's parent
+  /// may be any of the systems holding it: when that system releases the
+  /// object, the parent is moved to another holder. Systems sharing objects
+  /// may be edited concurrently.
+  /// Objects are shared as a whole: a private copy of a contract is a deep
+  /// copy made by Contract::clone, and the contract algebra and clone()
+  /// still produce deep copies.
+  /// @return The clone.
+  System *lazyClone();
+
+  /// @brief Function checking whether an object of the system is shared
+  /// with other systems.
+  /// @param object The object.
+  /// @return True if the object is shared.
+  bool isShared(ChaseObject *object);
+
+  /// @brief Function providing a contract of the system that can be
+  /// modified: if the contract is shared, it is replaced by a private copy.
+  /// @param contract A contract of the system.
+  /// @return The contract to modify.
+  Contract *getMutableContract(Contract *contract);
+
+  /// @brief Function providing a component of the system that can be
+  /// modified: if the component is shared, it is replaced by a private copy.
+  /// @param component A component of the system.
+  /// @return The component to modify.
+  Component *getMutableComponent(Component *component);
+
+  /// @brief Function providing a declaration of the system that can be
+  /// modified: if the declaration is shared, it is replaced by a private
+  /// copy, and the contracts referring to it are made private and updated.
+  /// @param declaration A declaration of the system.
+  /// @return The declaration to modify.
+  Declaration *getMutableDeclaration(Declaration *declaration);
+
 protected:
   /// Set of contracts describing the system's requirements.
   std::set<Contract *> _contracts;
   /// Set of components of the system.
   std::set<Component *> _components;
+  /// Holders of the objects shared with other systems, if any.
+  std::shared_ptr<shared_objects> _shared;
+
+  /// @brief Function marking an object as held also by a new system.
+  /// The caller must hold the mutex of the holders.
+  /// @param object The object.
+  /// @param system The new holder.
+  void _share(ChaseObject *object, System *system);
+
+  /// @brief Function checking whether an object must be copied before
+  /// being modified.
+  /// @param object The object.
+  /// @return True if other systems hold the object.
+  bool _mustCopy(ChaseObject *object);
+
+  /// @brief Function releasing an object held by this system. If other
+  /// systems hold it, the object is no more counted for this system, and
+  /// its parent is moved to one of them if it was this system.
+  /// @param object The object.
+  /// @return True if no other system holds the object, which can be
+  /// deleted or modified.
+  bool _release(ChaseObject *object);
 };
 
 } // namespace chase
@@ -1,15 +1,36 @@
 #pragma once
 
+#include "utilities/AstStatistics.hh"
 #include "utilities/BaseVisitor.hh"
+#include "utilities/BreadthFirstSearch.hh"
 #include "utilities/ClonedDeclarationVisitor.hh"
+#include "utilities/Combinations.hh"
+#include "utilities/DesignExploration.hh"
+#include "utilities/ExpressionCompiler.hh"
 #include "utilities/Factory.hh"
+#include "utilities/FlatPointerMap.hh"
 #include "utilities/GraphUtilities.hh"
+#include "utilities/GraphPartitioning.hh"
+#include "utilities/GraphReaders.hh"
+#include "utilities/GraphView.hh"
+#include "utilities/GraphWriters.hh"
 #include "utilities/GroupTemporalOperatorsVisitor.hh"
 #include "utilities/GuideVisitor.hh"
+#include "utilities/InteractionGraph.hh"
+#include "utilities/IntervalPropagation.hh"
 #include "utilities/IOUtils.hh"
 #include "utilities/LogicIdentificationVisitor.hh"
 #include "utilities/LogicNotNormalizationVisitor.hh"
 #include "utilities/LogicSimplificationVisitor.hh"
+#include "utilities/LtlToBuchi.hh"
+#include "utilities/MaxFlow.hh"
+#include "utilities/Profiler.hh"
+#include "utilities/Rational.hh"
+#include "utilities/ReachabilityIndex.hh"
+#include "utilities/ShortestPaths.hh"
+#include "utilities/Simplex.hh"
+#include "utilities/ThreadPool.hh"
 #include "utilities/UtilityFunctions.hh"
 #include "utilities/VarsCausalityVisitor.hh"
+#include "utilities/WorkloadGenerator.hh"
 #include "utilities/simplify.hh"
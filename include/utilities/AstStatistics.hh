@@ -0,0 +1,68 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/ChaseObject.hh"
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace chase {
+
+    /// @brief Structure of statistics about the shape and the memory
+    /// footprint of a tree of the representation (e.g., of a Contract, a
+    /// System or a Library).
+    typedef struct ast_statistics {
+        /// @brief Number of distinct nodes of each type.
+        std::map< nodeType, size_t > nodes;
+        /// @brief Total number of distinct nodes.
+        size_t total;
+        /// @brief Number of nodes without children.
+        size_t leaves;
+        /// @brief Maximum depth of a node. The root has depth 0.
+        unsigned int max_depth;
+        /// @brief Average depth of the leaves.
+        double average_depth;
+        /// @brief Number of nodes reached from more than one parent, such
+        /// as the declarations referenced by identifiers.
+        size_t shared;
+        /// @brief Number of structurally distinct subtrees. The difference
+        /// with total is the number of nodes that hash-consing would save.
+        size_t unique_subtrees;
+        /// @brief Estimate of the bytes allocated for the nodes, including
+        /// their strings and containers.
+        size_t bytes;
+        /// @brief Number of distinct strings among the Name nodes.
+        size_t names;
+
+        /// @brief Constructor.
+        ast_statistics();
+    } ast_statistics;
+
+    /// @brief Function computing the statistics of a tree in a single
+    /// iterative traversal, so that deep formulas do not exhaust the stack.
+    /// Every node is counted once, also when it is reached from several
+    /// parents. The depth of a node is the depth at which it is first
+    /// reached.
+    /// @param root The root of the tree.
+    /// @return The statistics.
+    ast_statistics computeStatistics(ChaseObject * root);
+
+    /// @brief Function printing the statistics as a JSON object.
+    /// @param statistics The statistics.
+    /// @return The JSON string.
+    std::string getStatisticsJSON(const ast_statistics & statistics);
+
+    /// @brief Function providing the name of a node type (e.g.,
+    /// "contract" for contract_node).
+    /// @param type The node type.
+    /// @return The name.
+    std::string getNodeTypeName(nodeType type);
+
+}
@@ -0,0 +1,98 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Graph.hh"
+#include "utilities/ThreadPool.hh"
+
+#include <cstdint>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Breadth-first searches over the compact adjacency of a graph,
+    /// optionally run by a thread pool.
+    /// Single-source searches are direction-optimizing: while the frontier
+    /// is small, its nodes push to their successors (top-down); when the
+    /// edges of the frontier outnumber a fraction of the unexplored ones,
+    /// the unvisited nodes look for a predecessor in the frontier (bottom-up)
+    /// and stop at the first one found.
+    /// Multi-source searches are bit-parallel: the sources are processed in
+    /// batches of 64, and every node keeps a word whose bits are the sources
+    /// of the batch that reached it, so that one pass over the edges advances
+    /// the 64 searches together. Batches are independent tasks.
+    /// Distances are numbers of edges; UINT_MAX marks the nodes not reached.
+    /// The searches can run concurrently, also from tasks of the pool: every
+    /// search waits only for its own tasks, and runs itself those that no
+    /// worker has started yet.
+    class BreadthFirstSearch {
+    public:
+        /// @brief Constructor. The adjacency of the graph must not change
+        /// while the object is used.
+        /// @param graph The graph.
+        /// @param pool The pool running the searches, or nullptr to run them
+        /// in the calling thread.
+        explicit BreadthFirstSearch( Graph * graph,
+                                     ThreadPool * pool = nullptr );
+
+        /// @brief Constructor over a compact adjacency, e.g., the one of a
+        /// GraphView. The adjacency must outlive the object.
+        /// @param adjacency The adjacency.
+        /// @param symmetric True if every edge appears in both directions,
+        /// as for undirected graphs: the predecessors are then the
+        /// successors, and the reversed adjacency is not built.
+        /// @param pool The pool running the searches, or nullptr.
+        BreadthFirstSearch( const compact_adjacency & adjacency,
+                            bool symmetric, ThreadPool * pool = nullptr );
+
+        /// @brief Function computing the distances from a node.
+        /// @param source The source node.
+        /// @return The distance of each node from the source.
+        std::vector< unsigned int > getDistances( unsigned int source ) const;
+
+        /// @brief Function computing the distances from several nodes.
+        /// @param sources The source nodes.
+        /// @return The distances: the one of node v from the i-th source is
+        /// at i * size + v.
+        std::vector< unsigned int > getDistances(
+                const std::vector< unsigned int > & sources ) const;
+
+        /// @brief Function computing the nodes reached from several nodes,
+        /// as bitsets.
+        /// @param sources The source nodes.
+        /// @return One word per batch of 64 sources and node: bit j of the
+        /// word at b * size + v is set if the source b * 64 + j reaches v.
+        std::vector< uint64_t > getReachedSets(
+                const std::vector< unsigned int > & sources ) const;
+
+        /// @brief Getter of the number of nodes.
+        /// @return The number of nodes.
+        unsigned int getSize() const;
+
+    protected:
+        /// @brief Successors of the nodes.
+        const compact_adjacency * _adjacency;
+        /// @brief Reversed adjacency, built for non symmetric adjacencies.
+        compact_adjacency _reverse;
+        /// @brief Predecessors of the nodes: _adjacency or _reverse.
+        const compact_adjacency * _predecessors;
+        /// @brief The pool, if any.
+        ThreadPool * _pool;
+
+        /// @brief Bit-parallel search from a batch of at most 64 sources,
+        /// calling visit(node, bits, distance) when the bits of the sources
+        /// first reach a node.
+        template< typename F >
+        void _searchBatch( const unsigned int * sources, unsigned int count,
+                           F visit ) const;
+
+        /// @brief Function checking that the sources are in the graph.
+        void _checkSources( const std::vector< unsigned int > & sources ) const;
+    };
+
+}
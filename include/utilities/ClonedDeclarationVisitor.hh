@@ -9,6 +9,9 @@
 
 #include "representation.hh"
 #include "GuideVisitor.hh"
+#include "FlatPointerMap.hh"
+
+#include <vector>
 
 namespace chase {
 
@@ -21,16 +24,38 @@ namespace chase {
         explicit ClonedDeclarationVisitor(
                 std::map< Declaration *, Declaration * > &m );
 
+        /// @brief Explicit constructor.
+        /// @param m Reference to the declaration map. It must outlive the
+        /// visitor.
+        explicit ClonedDeclarationVisitor(
+                FlatPointerMap< Declaration, Declaration > &m );
+
         /// @brief Function visiting the identifiers.
         /// @param o The identifier to be visited.
         int visitIdentifier(Identifier &o) override;
 
+        /// @brief Function visiting the contracts. When the contract has the
+        /// index of the occurrences, the identifiers of its formulas are
+        /// redirected through the index, without traversing the formulas.
+        /// @param o The contract to be visited.
+        int visitContract(Contract &o) override;
+
+        /// @brief Function fixing the declarations of a set of identifiers,
+        /// without traversing the tree containing them. It is equivalent to
+        /// visiting the tree when the identifiers are all the ones of the
+        /// tree, e.g., as recorded by an IdentifierRecorder while cloning.
+        /// @param identifiers The identifiers.
+        void remap(const std::vector< Identifier * > &identifiers);
+
     protected:
 
+        /// @brief Declaration map, when it is built from a std::map.
+        FlatPointerMap< Declaration, Declaration > _owned;
+
         /// @brief Declaration map. Generated when cloning a contract. For each
         /// entry: the key is a pointer to the original declaration, the value
         /// is a pointer to the cloned declaration.
-        std::map< Declaration *, Declaration * > * _map;
+        FlatPointerMap< Declaration, Declaration > * _map;
     };
 
-}
\ No newline at end of file
+}
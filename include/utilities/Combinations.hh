@@ -0,0 +1,137 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Callback used to prune the enumeration of combinations. It
+    /// receives a partial combination (the first size indexes), and returns
+    /// false to skip all the combinations starting with it.
+    typedef std::function< bool(const unsigned int * indexes,
+                                unsigned int size) > combination_filter;
+
+    /// @brief Lazy enumeration of the combinations of k elements out of n,
+    /// in lexicographic order of the indexes. The iterator does not
+    /// allocate memory after its construction. Each combination has a rank
+    /// (its position in the lexicographic order), so that the enumeration
+    /// can be split into ranges of ranks processed independently.
+    class CombinationIterator {
+    public:
+        /// @brief Constructor enumerating all the combinations.
+        /// @param n The number of elements.
+        /// @param k The size of the combinations.
+        /// @param filter Optional callback pruning partial combinations.
+        CombinationIterator(unsigned int n, unsigned int k,
+                            combination_filter filter = nullptr);
+
+        /// @brief Constructor enumerating the combinations with rank in
+        /// [begin, end).
+        /// @param n The number of elements.
+        /// @param k The size of the combinations.
+        /// @param begin The rank of the first combination.
+        /// @param end The rank following the last combination.
+        /// @param filter Optional callback pruning partial combinations.
+        CombinationIterator(unsigned int n, unsigned int k,
+                            uint64_t begin, uint64_t end,
+                            combination_filter filter = nullptr);
+
+        /// @brief Destructor.
+        ~CombinationIterator();
+
+        /// @brief Function checking whether the enumeration is over.
+        /// @return True if there is no current combination.
+        bool isDone() const;
+
+        /// @brief Function moving to the next combination.
+        /// @return False if the enumeration is over.
+        bool next();
+
+        /// @brief Getter of the current combination.
+        /// @return The sorted indexes of the current combination.
+        const std::vector< unsigned int > & getIndexes() const;
+
+        /// @brief Function computing the rank of the current combination.
+        /// @return The rank.
+        uint64_t getRank() const;
+
+        /// @brief Function copying the elements of the current combination.
+        /// @param elements The elements being combined.
+        /// @param combination The vector receiving the selected elements.
+        template< typename T >
+        void getCombination(const std::vector< T > & elements,
+                            std::vector< T > & combination) const;
+
+        /// @brief Function computing a binomial coefficient. An error is
+        /// raised if the result does not fit in 64 bits.
+        /// @param n The number of elements.
+        /// @param k The size of the combinations.
+        /// @return The number of combinations of k elements out of n.
+        static uint64_t binomial(unsigned int n, unsigned int k);
+
+        /// @brief Function computing the indexes of the combination with a
+        /// given rank.
+        /// @param n The number of elements.
+        /// @param rank The rank.
+        /// @param indexes The vector (of size k) receiving the indexes.
+        static void unrank(unsigned int n, uint64_t rank,
+                           std::vector< unsigned int > & indexes);
+
+        /// @brief Function computing the rank of a combination.
+        /// @param n The number of elements.
+        /// @param indexes The sorted indexes of the combination.
+        /// @return The rank.
+        static uint64_t rank(unsigned int n,
+                             const std::vector< unsigned int > & indexes);
+
+        /// @brief Function computing the next combination represented as a
+        /// bit mask (Gosper's hack). The masks of the combinations of k
+        /// elements out of n are enumerated in increasing order, starting
+        /// from (1 << k) - 1, until the result reaches 1 << n.
+        /// @param mask The current combination. It must not be zero.
+        /// @return The next combination.
+        static uint64_t nextMask(uint64_t mask);
+
+    protected:
+        /// @brief The number of elements.
+        unsigned int _n;
+        /// @brief The size of the combinations.
+        unsigned int _k;
+        /// @brief The current combination.
+        std::vector< unsigned int > _indexes;
+        /// @brief The combination where the enumeration stops.
+        std::vector< unsigned int > _end;
+        /// @brief True if the enumeration stops before the last combination.
+        bool _bounded;
+        /// @brief True if the enumeration is over.
+        bool _done;
+        /// @brief The pruning callback.
+        combination_filter _filter;
+
+        /// @brief Function searching the first accepted combination not
+        /// preceding the current one.
+        /// @param level The first position that may change.
+        /// @param keep True to keep the current values of the following
+        /// positions, false to reset them to their minimum.
+        void _seek(int level, bool keep);
+    };
+
+    template< typename T >
+    void CombinationIterator::getCombination(
+            const std::vector< T > & elements,
+            std::vector< T > & combination) const
+    {
+        combination.resize(_indexes.size());
+        for(size_t i = 0; i < _indexes.size(); ++i)
+            combination[i] = elements[_indexes[i]];
+    }
+
+}
@@ -0,0 +1,270 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/ComponentDefinition.hh"
+#include "representation/Contract.hh"
+#include "representation/DesignProblem.hh"
+#include "representation/Library.hh"
+#include "utilities/ThreadPool.hh"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Architecture found by the design space exploration.
+    typedef struct exploration_result {
+        /// @brief The selected components, in the order of the slots.
+        std::vector< ComponentDefinition * > components;
+        /// @brief The cost of the selection.
+        double cost;
+        /// @brief The composition of the selected views. The contract is
+        /// owned by the receiver of the result.
+        Contract * contract;
+    } exploration_result;
+
+    /// @brief Callback computing the cost of a component.
+    typedef std::function< double(ComponentDefinition *) > component_cost;
+
+    /// @brief Callback pruning partial selections. It receives the
+    /// components selected so far, and returns false to discard all the
+    /// selections extending them.
+    typedef std::function<
+            bool(const std::vector< ComponentDefinition * > &) >
+            selection_filter;
+
+    /// @brief Callback checking whether a composition refines a
+    /// requirement.
+    typedef std::function< bool(Contract * composition,
+                                Contract * requirement) > refinement_checker;
+
+    /// @brief Engine exploring the architectures of a design problem. The
+    /// architecture is a sequence of slots, each one choosing a number of
+    /// components from a library. The views of the selected components are
+    /// composed, and each complete composition is checked to refine all the
+    /// requirements of the problem.
+    /// The search is run depth first on a work-stealing thread pool.
+    /// Partial selections are pruned when their guarantees are
+    /// inconsistent (the composition conjoins the guarantees, so no
+    /// extension can be consistent), when they are rejected by the filter,
+    /// or when their cost exceeds the cost of the best architecture found
+    /// so far. The consistency of the sets of components is memoized and
+    /// shared among the workers, and pairs of conflicting components are
+    /// discarded before composing them.
+    /// The results are streamed as soon as they are found. A selection on
+    /// which the algebra raises an error is discarded, without stopping the
+    /// exploration.
+    class DesignExploration {
+    public:
+        /// @brief Constructor.
+        /// @param problem The design problem providing the libraries and
+        /// the requirements.
+        /// @param view The name of the view used for the components, or the
+        /// empty string to use the first view of each component.
+        /// @param threads The number of workers, 0 to use the number of
+        /// hardware threads.
+        explicit DesignExploration(DesignProblem * problem,
+                                   std::string view = std::string(),
+                                   unsigned int threads = 0);
+
+        /// @brief Destructor. It stops the exploration and deletes the
+        /// results not retrieved.
+        ~DesignExploration();
+
+        /// @brief Function adding a slot of the architecture. If no slot is
+        /// added, each library of the problem provides one component.
+        /// @param library The library providing the candidates.
+        /// @param count The number of distinct components to select.
+        void addSlot(Library * library, unsigned int count = 1);
+
+        /// @brief Setter of the cost of the components. The cost of a
+        /// selection is the sum of the costs of its components. Costs must
+        /// not be negative.
+        /// @param cost The callback.
+        void setCostFunction(component_cost cost);
+
+        /// @brief Function enabling the pruning of the dominated
+        /// selections, i.e., the ones more expensive than the best
+        /// architecture found so far.
+        /// @param enabled True to prune the dominated selections.
+        void setPruneDominated(bool enabled);
+
+        /// @brief Setter of the filter of the partial selections.
+        /// @param filter The callback.
+        void setFilter(selection_filter filter);
+
+        /// @brief Setter of the refinement check. The default check
+        /// decides the refinement in the logic domain (checkRefinementLTL).
+        /// The callback is called concurrently by the workers.
+        /// @param checker The callback.
+        void setChecker(refinement_checker checker);
+
+        /// @brief Setter of the maximum number of memoized sets.
+        /// @param size The size of the memo.
+        void setMemoLimit(size_t size);
+
+        /// @brief Function starting the exploration in background.
+        void start();
+
+        /// @brief Function waiting for the next result.
+        /// @param result The result.
+        /// @return False if the exploration is over and all the results
+        /// have been retrieved.
+        bool next(exploration_result & result);
+
+        /// @brief Function stopping the exploration. The running checks are
+        /// completed, and the pending results can still be retrieved.
+        void stop();
+
+        /// @brief Function waiting for the end of the exploration.
+        void wait();
+
+        /// @brief Function running the whole exploration.
+        /// @param callback Function called (by the calling thread) on every
+        /// result, as soon as it is found.
+        void run(const std::function< void(exploration_result &) > &
+                callback);
+
+        /// @brief Getter of the number of partial selections visited.
+        /// @return The number of selections.
+        size_t getVisitedCount() const;
+
+        /// @brief Getter of the number of pruned partial selections.
+        /// @return The number of selections.
+        size_t getPrunedCount() const;
+
+        /// @brief Getter of the number of memo hits.
+        /// @return The number of hits.
+        size_t getMemoHitsCount() const;
+
+        /// @brief Getter of the number of partial selections discarded
+        /// because the algebra, or one of the callbacks, raised an error on
+        /// them.
+        /// @return The number of selections.
+        size_t getFailedCount() const;
+
+    protected:
+
+        /// @brief Slot of the architecture.
+        typedef struct exploration_slot {
+            /// @brief The candidate components.
+            std::vector< ComponentDefinition * > candidates;
+            /// @brief The number of components to select.
+            unsigned int count;
+        } exploration_slot;
+
+        /// @brief Partial selection of the search.
+        typedef struct exploration_node {
+            /// @brief The selected components.
+            std::vector< ComponentDefinition * > components;
+            /// @brief The composition of their views.
+            std::shared_ptr< Contract > contract;
+            /// @brief The cost of the selection.
+            double cost;
+        } exploration_node;
+
+        /// @brief The design problem.
+        DesignProblem * _problem;
+        /// @brief The name of the view.
+        std::string _view;
+        /// @brief The slots.
+        std::vector< exploration_slot > _slots;
+        /// @brief The cost callback.
+        component_cost _cost;
+        /// @brief The filter callback.
+        selection_filter _filter;
+        /// @brief The refinement check.
+        refinement_checker _checker;
+        /// @brief True to prune the dominated selections.
+        bool _pruneDominated;
+        /// @brief The cost of the best architecture found.
+        std::atomic< double > _bound;
+        /// @brief The number of workers.
+        unsigned int _threads;
+        /// @brief The pool, created by start.
+        std::unique_ptr< ThreadPool > _pool;
+
+        /// @brief The mutex protecting the memo.
+        std::mutex _memoMutex;
+        /// @brief Consistency of the sets of components, keyed by the
+        /// sorted set.
+        std::map< std::vector< ComponentDefinition * >, bool > _memo;
+        /// @brief Maximum number of memoized sets.
+        size_t _memoLimit;
+
+        /// @brief The mutex protecting the results.
+        std::mutex _resultsMutex;
+        /// @brief Condition signaled when a result is found, or the search
+        /// ends.
+        std::condition_variable _resultsAvailable;
+        /// @brief The results not yet retrieved.
+        std::deque< exploration_result > _results;
+        /// @brief Number of tasks of the search not completed.
+        size_t _active;
+        /// @brief True if the search has been started.
+        bool _started;
+        /// @brief True to stop the search.
+        std::atomic< bool > _stopped;
+
+        /// @brief Number of partial selections visited.
+        std::atomic< size_t > _visited;
+        /// @brief Number of pruned partial selections.
+        std::atomic< size_t > _pruned;
+        /// @brief Number of memo hits.
+        std::atomic< size_t > _memoHits;
+        /// @brief Number of failed partial selections.
+        std::atomic< size_t > _failed;
+
+        /// @brief Function getting the view of a component.
+        /// @param component The component.
+        /// @return The view, or nullptr.
+        Contract * _getView(ComponentDefinition * component) const;
+
+        /// @brief Function composing two contracts, matching their shared
+        /// names.
+        /// @param c1 The first contract.
+        /// @param c2 The second contract.
+        /// @return The composition.
+        static Contract * _compose(Contract * c1, Contract * c2);
+
+        /// @brief Function checking the consistency of a set of components,
+        /// using the memo.
+        /// @param components The components.
+        /// @param contract The composition of their views, or nullptr to
+        /// build it.
+        /// @return True if the guarantees are consistent.
+        bool _isConsistent(std::vector< ComponentDefinition * > components,
+                           Contract * contract);
+
+        /// @brief Function scheduling the expansion of a node.
+        /// @param node The node.
+        /// @param slot The slot to fill.
+        void _schedule(exploration_node node, size_t slot);
+
+        /// @brief Function expanding a node, filling the given slot.
+        /// @param node The node.
+        /// @param slot The slot to fill.
+        void _expand(const exploration_node & node, size_t slot);
+
+        /// @brief Function checking a complete selection.
+        /// @param node The node.
+        void _check(const exploration_node & node);
+
+        /// @brief Function marking the completion of a task.
+        void _done();
+    };
+
+}
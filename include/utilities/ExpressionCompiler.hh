@@ -0,0 +1,207 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "BaseVisitor.hh"
+#include "representation/Constraint.hh"
+#include "representation/DataDeclaration.hh"
+#include "representation/Expression.hh"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Operation codes of the expressions bytecode.
+    enum bytecode_opcode : uint8_t
+    {
+        bc_load_constant,
+        bc_load_variable,
+        bc_negate,
+        bc_add,
+        bc_sub,
+        bc_mul,
+        bc_div,
+        bc_mod,
+        bc_eq,
+        bc_neq,
+        bc_lt,
+        bc_gt,
+        bc_le,
+        bc_ge,
+        bc_and
+    };
+
+    /// @brief Instruction of the expressions bytecode. The instruction
+    /// computes dst = a op b over registers. For the load instructions, a is
+    /// the index of the constant or of the variable to load.
+    typedef struct bytecode_instruction {
+        /// @brief Operation code.
+        bytecode_opcode opcode;
+        /// @brief Destination register.
+        uint32_t dst;
+        /// @brief First operand.
+        uint32_t a;
+        /// @brief Second operand.
+        uint32_t b;
+    } bytecode_instruction;
+
+    /// @brief Arithmetic expressions and constraints compiled into a compact
+    /// register-based bytecode. All the values are evaluated as doubles;
+    /// relational operators produce 1.0 (true) or 0.0 (false). Compiling
+    /// multiple expressions in the same program evaluates their conjunction.
+    /// The result of the program is always stored in the register 0.
+    class ExpressionProgram {
+    public:
+        /// @brief Number of assignments evaluated together by the batch
+        /// evaluation.
+        static const size_t batch_block = 256;
+
+        /// @brief Constructor.
+        ExpressionProgram();
+
+        /// @brief Destructor.
+        ~ExpressionProgram();
+
+        /// @brief Function to register a variable of the program. Variables
+        /// are numbered in order of registration, and the number is the index
+        /// of the variable in the assignments. Variables not registered are
+        /// added while compiling, in order of occurrence.
+        /// @param declaration The declaration of the variable.
+        /// @return The index of the variable.
+        unsigned int addVariable(DataDeclaration * declaration);
+
+        /// @brief Function compiling an expression into the program.
+        /// @param expression The expression to compile.
+        void compile(Expression * expression);
+
+        /// @brief Function compiling a constraint into the program.
+        /// @param constraint The constraint to compile.
+        void compile(Constraint * constraint);
+
+        /// @brief Function evaluating the program over an assignment.
+        /// @param assignment Values of the variables, indexed as returned
+        /// by addVariable.
+        /// @param registers Buffer of at least getRegistersCount() values.
+        /// @return The value of the program.
+        double evaluate(const double * assignment, double * registers) const;
+
+        /// @brief Function evaluating the program over an assignment.
+        /// @param assignment Values of the variables, indexed as returned
+        /// by addVariable.
+        /// @return The value of the program.
+        double evaluate(const std::vector< double > & assignment) const;
+
+        /// @brief Function evaluating the program over a batch of
+        /// assignments. Each instruction is executed over a block of
+        /// assignments at once, so that the inner loops are vectorized.
+        /// @param columns For each variable, a pointer to the array of its
+        /// values (one per assignment).
+        /// @param count The number of assignments.
+        /// @param results Array of count values receiving the results.
+        void evaluateBatch(const std::vector< const double * > & columns,
+                           size_t count, double * results) const;
+
+        /// @brief Getter of the variables of the program.
+        /// @return The declarations of the variables, in index order.
+        const std::vector< DataDeclaration * > & getVariables() const;
+
+        /// @brief Getter of the bytecode.
+        /// @return The instructions of the program.
+        const std::vector< bytecode_instruction > & getCode() const;
+
+        /// @brief Getter of the number of registers used by the program.
+        /// @return The number of registers.
+        unsigned int getRegistersCount() const;
+
+        /// @brief Function printing the program.
+        /// @return The textual representation of the bytecode.
+        std::string getString() const;
+
+    protected:
+
+        friend class ExpressionCompiler;
+
+        /// @brief The instructions.
+        std::vector< bytecode_instruction > _code;
+        /// @brief The pool of constants.
+        std::vector< double > _constants;
+        /// @brief The variables, in index order.
+        std::vector< DataDeclaration * > _variables;
+        /// @brief Map from the declarations to the index of the variables.
+        std::map< DataDeclaration *, unsigned int > _variablesIndex;
+        /// @brief Number of registers used.
+        unsigned int _registers;
+        /// @brief True if the program already computes a result.
+        bool _hasResult;
+    };
+
+    /// @brief Visitor generating the bytecode of an expression. Each visit
+    /// function returns the register where the value of the visited node is
+    /// stored. Registers are allocated as a stack.
+    class ExpressionCompiler : public BaseVisitor {
+    public:
+        /// @brief Constructor.
+        /// @param program The program to which the code is appended.
+        /// @param base The first free register.
+        ExpressionCompiler(ExpressionProgram & program, unsigned int base);
+
+        /// @brief Destructor.
+        ~ExpressionCompiler() override;
+
+        /// @cond
+        int visitExpression(Expression & ) override;
+        int visitIdentifier(Identifier & ) override;
+        int visitIntegerValue(IntegerValue & ) override;
+        int visitRealValue(RealValue & ) override;
+        int visitBooleanValue(BooleanValue & ) override;
+        int visitConstraint(Constraint & ) override;
+
+        // Operands that cannot be compiled raise an error.
+        int visitRange(Range & ) override;
+        int visitStringValue(StringValue & ) override;
+        int visitInterval(Interval & ) override;
+        int visitMatrix(Matrix & ) override;
+        int visitProbabilityFunction(ProbabilityFunction & ) override;
+        int visitFunctionCall(FunctionCall & ) override;
+        int visitProposition(Proposition & ) override;
+        int visitBooleanConstant(BooleanConstant & ) override;
+        int visitBinaryBooleanOperation(BinaryBooleanFormula & ) override;
+        int visitUnaryBooleanOperation(UnaryBooleanFormula & ) override;
+        int visitLargeBooleanFormula(LargeBooleanFormula & ) override;
+        int visitQuantifiedFormula(QuantifiedFormula & ) override;
+        int visitModalFormula(ModalFormula & ) override;
+        int visitUnaryTemporalOperation(UnaryTemporalFormula & ) override;
+        int visitBinaryTemporalOperation(BinaryTemporalFormula & ) override;
+        /// @endcond
+
+    protected:
+        /// @brief The program being generated.
+        ExpressionProgram & _program;
+        /// @brief The first free register.
+        unsigned int _top;
+
+        /// @brief Function emitting the load of a constant.
+        /// @param value The constant to load.
+        /// @return The register containing the constant.
+        int _loadConstant(double value);
+    };
+
+    /// @brief Factory compiling an expression.
+    /// @param expression The expression to compile.
+    /// @return A pointer to the new program.
+    ExpressionProgram * compileExpression(Expression * expression);
+
+    /// @brief Factory compiling the conjunction of a set of constraints.
+    /// @param constraints The constraints to compile.
+    /// @return A pointer to the new program.
+    ExpressionProgram * compileConstraints(
+            std::vector< Constraint * > & constraints);
+
+}
@@ -0,0 +1,136 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Hash map from pointers to pointers, with open addressing and
+    /// linear probing in a single array. Lookups touch one or two cache
+    /// lines, instead of walking the nodes of a red-black tree. The null
+    /// pointer cannot be used as key. Entries cannot be removed.
+    template< typename K, typename V >
+    class FlatPointerMap {
+    public:
+        /// @brief Constructor.
+        /// @param capacity The number of entries to reserve.
+        explicit FlatPointerMap(size_t capacity = 0) :
+            _slots(),
+            _size(0),
+            _mask(0)
+        {
+            reserve(capacity);
+        }
+
+        /// @brief Function inserting an entry, or replacing its value.
+        /// @param key The key. It must not be null.
+        /// @param value The value.
+        void insert(K * key, V * value)
+        {
+            if((_size + 1) * 4 > _slots.size() * 3)
+                reserve(_size + 1);
+            size_t i = _hash(key) & _mask;
+            while(_slots[i].first != nullptr && _slots[i].first != key)
+                i = (i + 1) & _mask;
+            if(_slots[i].first == nullptr) ++_size;
+            _slots[i].first = key;
+            _slots[i].second = value;
+        }
+
+        /// @brief Function searching the value of a key.
+        /// @param key The key.
+        /// @return The value, or nullptr if the key is missing.
+        V * find(K * key) const
+        {
+            if(_size == 0 || key == nullptr) return nullptr;
+            size_t i = _hash(key) & _mask;
+            while(_slots[i].first != nullptr)
+            {
+                if(_slots[i].first == key) return _slots[i].second;
+                i = (i + 1) & _mask;
+            }
+            return nullptr;
+        }
+
+        /// @brief Function checking whether a key is in the map.
+        /// @param key The key.
+        /// @return True if the key is in the map.
+        bool contains(K * key) const
+        {
+            if(_size == 0 || key == nullptr) return false;
+            size_t i = _hash(key) & _mask;
+            while(_slots[i].first != nullptr)
+            {
+                if(_slots[i].first == key) return true;
+                i = (i + 1) & _mask;
+            }
+            return false;
+        }
+
+        /// @brief Function reserving room for a number of entries, so that
+        /// the map is at most three quarters full.
+        /// @param capacity The number of entries.
+        void reserve(size_t capacity)
+        {
+            size_t slots = 8;
+            while(slots * 3 < capacity * 4) slots *= 2;
+            if(slots <= _slots.size()) return;
+
+            std::vector< std::pair< K *, V * > > old(
+                    slots, std::pair< K *, V * >(nullptr, nullptr));
+            old.swap(_slots);
+            _mask = slots - 1;
+            for(auto & slot : old)
+            {
+                if(slot.first == nullptr) continue;
+                size_t i = _hash(slot.first) & _mask;
+                while(_slots[i].first != nullptr) i = (i + 1) & _mask;
+                _slots[i] = slot;
+            }
+        }
+
+        /// @brief Function removing all the entries.
+        void clear()
+        {
+            for(auto & slot : _slots)
+                slot = std::pair< K *, V * >(nullptr, nullptr);
+            _size = 0;
+        }
+
+        /// @brief Function providing the number of entries.
+        /// @return The number of entries.
+        size_t size() const
+        {
+            return _size;
+        }
+
+    protected:
+        /// @brief Slots: pairs of key and value, with null keys when empty.
+        std::vector< std::pair< K *, V * > > _slots;
+        /// @brief Number of entries.
+        size_t _size;
+        /// @brief Number of slots minus one. The number of slots is a power
+        /// of two.
+        size_t _mask;
+
+        /// @brief Fibonacci hashing of the address: the low bits of
+        /// addresses are aligned, hence they are mixed into the high ones.
+        static size_t _hash(K * key)
+        {
+            auto x = static_cast< uint64_t >(
+                    reinterpret_cast< uintptr_t >(key));
+            x *= 0x9e3779b97f4a7c15ull;
+            return static_cast< size_t >(x ^ (x >> 32));
+        }
+    };
+
+}
@@ -0,0 +1,58 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Graph.hh"
+
+#include <cstdint>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Function partitioning the nodes of a graph into parts of
+    /// balanced weight, minimizing the weight of the edges between different
+    /// parts. The graph is partitioned by recursive bisection, and every
+    /// bisection is multilevel: the graph is coarsened by contracting a
+    /// matching of heavy edges until it is small, the coarsest graph is
+    /// bisected by growing one side from several random nodes, and the
+    /// bisection is projected back level by level, refined at each level by
+    /// Fiduccia-Mattheyses passes. Edge directions are ignored, and parallel
+    /// edges add their weights. The result is a heuristic: it depends on
+    /// the seed, not on the platform.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param weights The weight of each edge, indexed as the edges of the
+    /// graph (see getEdgeWeights), or empty for unit weights. Weights must
+    /// not be negative.
+    /// @param parts The number of parts. Parts may be empty when the graph
+    /// has fewer nodes than parts.
+    /// @param imbalance The maximum excess of the weight of a part over the
+    /// average, as a fraction of it (e.g., 0.03 for 3%). It is exceeded only
+    /// when no assignment of the nodes can satisfy it.
+    /// @param nodeWeights The weight of each node, or empty for unit weights.
+    /// @param seed The seed of the random choices.
+    /// @return The part of each node, in [0, parts).
+    std::vector< unsigned int > partitionGraph(
+            const compact_adjacency & adjacency,
+            const std::vector< double > & weights,
+            unsigned int parts,
+            double imbalance = 0.03,
+            const std::vector< unsigned int > & nodeWeights =
+                    std::vector< unsigned int >(),
+            uint64_t seed = 0 );
+
+    /// @brief Function computing the weight of the edges between different
+    /// parts. Undirected edges are counted once.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param weights The weight of each edge, or empty for unit weights.
+    /// @param partition The part of each node.
+    /// @return The weight of the cut.
+    double getCutWeight( const compact_adjacency & adjacency,
+                         const std::vector< double > & weights,
+                         const std::vector< unsigned int > & partition );
+
+}
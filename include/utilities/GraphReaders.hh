@@ -0,0 +1,36 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Graph.hh"
+
+#include <istream>
+#include <string>
+
+namespace chase {
+
+    /// @brief Function loading a graph from an edge list, with the bulk
+    /// constructor of Graph. Each line holds the source and the target of an
+    /// edge, as indexes from 0, optionally followed by a weight; either all
+    /// the edges have a weight or none has. Empty lines and lines starting
+    /// with '#' or '%' are skipped. The number of nodes is the largest index
+    /// plus one. The input is parsed in blocks, without a copy of each line.
+    /// @param in The stream.
+    /// @param directed True for a directed graph.
+    /// @param name The name of the graph.
+    /// @return The graph.
+    Graph * readEdgeList( std::istream & in, bool directed = false,
+                          Name * name = new Name("GenericGraph") );
+
+    /// @brief Function loading a graph from an edge list file.
+    /// @param path The path of the file.
+    /// @param directed True for a directed graph.
+    /// @return The graph, named after the file.
+    Graph * readEdgeList( const std::string & path, bool directed = false );
+
+}
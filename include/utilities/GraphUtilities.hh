@@ -8,10 +8,16 @@
 #pragma once
 #include "representation/Graph.hh"
 
+#include <list>
+#include <vector>
+
 namespace chase
 {
     /// @brief Create a new graph considering only a subset of the vertexes
-    /// of a graph. It preserves the edges between the vertexes.
+    /// of a graph. It preserves the edges between the vertexes, with a clone
+    /// of their weights. The vertexes are matched to the nodes of the graph
+    /// by name, and the nodes of the sub-graph follow the order of the set.
+    /// It runs in time linear in the vertexes and in their incident edges.
     /// @param graph The original graph.
     /// @param vertexes The set of vertexes to preserve.
     /// @return A pointer to a new graph having only the specified vertexes.
@@ -31,4 +37,66 @@ namespace chase
             std::list< std::vector< unsigned int > >& result
             );
 
+    /// @brief Algorithms computing the strongly connected components.
+    typedef enum scc_algorithm {
+        /// @brief Tarjan algorithm: one depth-first search.
+        tarjan_scc,
+        /// @brief Kosaraju algorithm: a depth-first search of the graph and
+        /// one of the reversed graph.
+        kosaraju_scc
+    } scc_algorithm;
+
+    /// @brief Function computing the strongly connected components of a
+    /// graph, with iterative searches running in time O(V + E). Components
+    /// are numbered in reverse topological order: the components reached
+    /// from a component have lower numbers. The adjacency of an undirected
+    /// graph has the edges in both directions, hence its components are the
+    /// connected ones.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param component The component of each node. It is overwritten.
+    /// @param algorithm The algorithm.
+    /// @return The number of components.
+    unsigned int getStronglyConnectedComponents(
+            const compact_adjacency & adjacency,
+            std::vector< unsigned int > & component,
+            scc_algorithm algorithm = tarjan_scc );
+
+    /// @brief Function reversing the edges of a compact adjacency, in time
+    /// O(V + E). The edge indexes are preserved.
+    /// @param adjacency The adjacency.
+    /// @return The reversed adjacency.
+    compact_adjacency getReverseAdjacency( const compact_adjacency & adjacency );
+
+    /// @brief Function building the condensation of a graph: the DAG having
+    /// a node per strongly connected component, and an edge between two
+    /// components if an edge of the graph links them. It runs in time
+    /// O(V + E), and it does not create duplicated edges. The edges of the
+    /// condensation are indexed by the first edge of the graph linking the
+    /// components.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param component The component of each node, numbered as by
+    /// getStronglyConnectedComponents.
+    /// @param count The number of components.
+    /// @return The adjacency of the condensation.
+    compact_adjacency getCondensation(
+            const compact_adjacency & adjacency,
+            const std::vector< unsigned int > & component,
+            unsigned int count );
+
+    /// @brief Function computing a topological order of the nodes of a
+    /// graph, with the Kahn algorithm, in time O(V + E). If the graph has a
+    /// cycle, the function reports one.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param order The nodes, ordered so that every edge goes from a node
+    /// to a later one. If the graph has a cycle, only the nodes that are not
+    /// reached from any cycle are ordered. It is overwritten.
+    /// @param cycle The nodes of a cycle, in the order of its edges, if the
+    /// graph is not acyclic; the last node has an edge to the first one.
+    /// Empty otherwise. It is overwritten.
+    /// @return True if the graph is acyclic.
+    bool getTopologicalOrder(
+            const compact_adjacency & adjacency,
+            std::vector< unsigned int > & order,
+            std::vector< unsigned int > & cycle );
+
 }
@@ -0,0 +1,128 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Graph.hh"
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace chase {
+
+    /// @brief View of the sub-graph of a graph induced by a set of nodes. It
+    /// copies neither the nodes nor the edges: it holds the list of the
+    /// selected nodes and a bitset of them, and it reads the compact
+    /// adjacency of the graph. The nodes of the view are numbered from 0, in
+    /// increasing order of their index in the graph. The view is valid until
+    /// the graph is modified.
+    class GraphView {
+    public:
+        /// @brief Constructor of the view of a whole graph.
+        /// @param graph The graph.
+        explicit GraphView( Graph * graph );
+
+        /// @brief Constructor of the view of the sub-graph induced by a set
+        /// of nodes.
+        /// @param graph The graph.
+        /// @param nodes The indexes of the nodes in the graph. Duplicates are
+        /// ignored.
+        GraphView( Graph * graph, const std::vector< unsigned int > & nodes );
+
+        /// @brief Constructor of the view of the sub-graph induced by a set
+        /// of vertexes, as in getSubGraph.
+        /// @param graph The graph.
+        /// @param vertexes The vertexes, matched to the nodes of the graph by
+        /// name. Vertexes not in the graph are ignored.
+        GraphView( Graph * graph, const std::set< Vertex * > & vertexes );
+
+        /// @brief Getter of the viewed graph.
+        /// @return The graph.
+        Graph * getGraph() const;
+
+        /// @brief Function retrieving the type of graph.
+        /// @return True if the graph is directed.
+        bool isDirected() const;
+
+        /// @brief Function providing the number of nodes in the view.
+        /// @return The number of nodes.
+        unsigned int getSize() const;
+
+        /// @brief Function providing the index in the graph of a node of the
+        /// view.
+        /// @param local The index of the node in the view.
+        /// @return The index of the node in the graph.
+        unsigned int getNode( unsigned int local ) const;
+
+        /// @brief Function checking whether a node of the graph is in the
+        /// view, in constant time.
+        /// @param node The index of the node in the graph.
+        /// @return True if the node is in the view.
+        bool contains( unsigned int node ) const;
+
+        /// @brief Function providing the index in the view of a node of the
+        /// graph, in time logarithmic in the size of the view.
+        /// @param node The index of the node in the graph.
+        /// @return The index in the view, or -1 if the node is not in it.
+        int getLocalIndex( unsigned int node ) const;
+
+        /// @brief Function calling a function on each neighbor of a node of
+        /// the view that is in the view, without allocations.
+        /// @param local The index of the node in the view.
+        /// @param f Function taking the index of the neighbor in the view and
+        /// the index of the edge in the graph.
+        template< typename F >
+        void forEachNeighbor( unsigned int local, F f ) const
+        {
+            unsigned int node = getNode(local);
+            for( unsigned int i = _adjacency->offsets[node];
+                 i < _adjacency->offsets[node + 1]; ++i )
+            {
+                unsigned int target = _adjacency->targets[i];
+                if( ! contains(target) ) continue;
+                f(_all ? target :
+                  static_cast< unsigned int >(getLocalIndex(target)),
+                  _adjacency->edges[i]);
+            }
+        }
+
+        /// @brief Function providing the neighbors of a node of the view
+        /// that are in the view.
+        /// @param local The index of the node in the view.
+        /// @return The indexes of the neighbors in the view.
+        std::vector< unsigned int > getNeighbors( unsigned int local ) const;
+
+        /// @brief Function providing the compact adjacency of the view, over
+        /// the indexes of the view. For a whole graph, it is the adjacency of
+        /// the graph.
+        /// @return The adjacency.
+        compact_adjacency getAdjacency() const;
+
+        /// @brief Function creating a graph with the nodes and the edges of
+        /// the view. The vertexes and the edges (with their weights) are
+        /// cloned.
+        /// @return The new graph.
+        Graph * materialize() const;
+
+    protected:
+        /// @brief The viewed graph.
+        Graph * _graph;
+        /// @brief Compact adjacency of the viewed graph.
+        const compact_adjacency * _adjacency;
+        /// @brief True if the view contains all the nodes of the graph.
+        bool _all;
+        /// @brief Indexes in the graph of the nodes of the view, sorted.
+        std::vector< unsigned int > _nodes;
+        /// @brief Bitset of the nodes of the graph in the view.
+        std::vector< uint64_t > _members;
+
+        /// @brief Function initializing the view from a list of nodes.
+        void _select( std::vector< unsigned int > nodes );
+    };
+
+}
@@ -0,0 +1,46 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Graph.hh"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Function writing a graph in the GraphViz DOT format. Nodes are
+    /// identified by their index, and labeled with the name of their vertex.
+    /// Edges are labeled with their weight, if any. The output goes through
+    /// a fixed-size buffer: it runs in time linear in the size of the graph,
+    /// with constant extra memory.
+    /// @param graph The graph.
+    /// @param out The stream.
+    /// @param clusters If not null, the cluster of each node, or UINT_MAX for
+    /// the nodes not in a cluster. Each cluster is drawn as a subgraph;
+    /// nodes of the same cluster need not be consecutive.
+    void writeGraphViz( Graph * graph, std::ostream & out,
+                        const std::vector< unsigned int > * clusters = nullptr );
+
+    /// @brief Function writing a graph in the GraphML format, with the same
+    /// guarantees as writeGraphViz. Vertex names, edge weights and clusters
+    /// are node and edge data, with keys "label", "weight" and "cluster".
+    /// @param graph The graph.
+    /// @param out The stream.
+    /// @param clusters If not null, the cluster of each node, or UINT_MAX for
+    /// the nodes not in a cluster.
+    void writeGraphML( Graph * graph, std::ostream & out,
+                       const std::vector< unsigned int > * clusters = nullptr );
+
+    /// @brief Function escaping a string for a quoted DOT identifier.
+    /// @param s The string.
+    /// @return The escaped string, without quotes.
+    std::string escapeGraphViz( const std::string & s );
+
+}
@@ -11,27 +11,78 @@
 #pragma once
 
 #include "representation/forwards.hh"
+#include <cstddef>
+#include <ctime>
+#include <functional>
 #include <iostream>
+#include <stdexcept>
 #include <string>
-#include <ctime>
 #include <string.h>
+#include <vector>
 
 namespace chase {
 
-    /// @brief Base function for all the messages.
+    /// @brief Severity of the diagnostic messages.
+    enum message_severity
+    {
+        severity_info,
+        severity_warning,
+        severity_error
+    };
+
+    /// @brief Diagnostic message, as received by the sinks.
+    typedef struct diagnostic_message {
+        /// @brief The severity.
+        message_severity severity;
+        /// @brief The text of the message.
+        std::string text;
+        /// @brief Object of the AST subject of the message, if any.
+        ChaseObject * object;
+        /// @brief Time of the message.
+        time_t time;
+    } diagnostic_message;
+
+    /// @brief Callback receiving the diagnostic messages. Sinks installed
+    /// for all the threads may be called concurrently.
+    typedef std::function< void(const diagnostic_message &) >
+            diagnostic_sink;
+
+    /// @brief Exception raised by messageError. The message has already
+    /// been delivered to the sinks when the exception is thrown, so that
+    /// callers can recover from the failure of a single operation.
+    class ChaseError : public std::runtime_error {
+    public:
+        /// @brief Constructor.
+        /// @param msg The text of the error.
+        /// @param object Object of the AST causing the error.
+        explicit ChaseError(const std::string & msg,
+                            ChaseObject * object = nullptr);
+
+        /// @brief Getter of the object causing the error.
+        /// @return The object, or nullptr.
+        ChaseObject * getObject() const;
+
+    protected:
+        /// @brief The object causing the error.
+        ChaseObject * _object;
+    };
+
+    /// @brief Base function for all the messages. It formats the message
+    /// on a single line, written with a single operation on the stream.
     /// @param msg (C) string to be printed.
     /// @param object Object of the AST subject of the message.
     /// @param str Stream to use.
     void baseMessage(
             const char * msg,
             ChaseObject * object,
-            const std::ostream & str 
+            std::ostream & str
             );
 
-    /// @brief Function for all the error messages.
+    /// @brief Function for all the error messages. The message is
+    /// delivered to the sinks, and then a ChaseError is thrown.
     /// @param msg (C) string to be printed.
     /// @param object Object of the AST causing the Error.
-    void messageError(
+    [[noreturn]] void messageError(
             const char * msg,
             ChaseObject * object = nullptr );
 
@@ -49,10 +100,11 @@ namespace chase {
             const char * msg,
             ChaseObject * object = nullptr );
 
-    /// @brief Function for all the error messages.
+    /// @brief Function for all the error messages. The message is
+    /// delivered to the sinks, and then a ChaseError is thrown.
     /// @param msg (C) string to be printed.
     /// @param object Object of the AST causing the Error.
-    void messageError(
+    [[noreturn]] void messageError(
             std::string msg,
             ChaseObject * object = nullptr );
 
@@ -70,5 +122,54 @@ namespace chase {
             std::string msg,
             ChaseObject * object = nullptr );
 
-}
+    /// @brief Function setting the sink used by all the threads without a
+    /// sink of their own. The default sink prints the messages on the
+    /// standard streams.
+    /// @param sink The sink, or nullptr to restore the default one.
+    void setDiagnosticSink(diagnostic_sink sink);
+
+    /// @brief Function setting the sink of the calling thread.
+    /// @param sink The sink, or nullptr to use the global one.
+    /// @return The previous sink of the thread.
+    diagnostic_sink setThreadDiagnosticSink(diagnostic_sink sink);
 
+    /// @brief Getter of the number of messages of a severity, reported by
+    /// all the threads.
+    /// @param severity The severity.
+    /// @return The number of messages.
+    size_t getDiagnosticsCount(message_severity severity);
+
+    /// @brief Function resetting the counters of the messages.
+    void resetDiagnosticsCounters();
+
+    /// @brief Buffer collecting the messages of the calling thread. While
+    /// the buffer exists, the messages are stored in it instead of being
+    /// printed. Buffers can be nested.
+    class DiagnosticBuffer {
+    public:
+        /// @brief Constructor. It installs the buffer as the sink of the
+        /// calling thread.
+        DiagnosticBuffer();
+
+        /// @brief Destructor. It restores the previous sink.
+        ~DiagnosticBuffer();
+
+        DiagnosticBuffer(const DiagnosticBuffer &) = delete;
+        DiagnosticBuffer & operator=(const DiagnosticBuffer &) = delete;
+
+        /// @brief Getter of the messages collected so far.
+        /// @return The messages.
+        const std::vector< diagnostic_message > & getMessages() const;
+
+        /// @brief Function printing the collected messages on a stream.
+        /// @param str The stream.
+        void flush(std::ostream & str);
+
+    protected:
+        /// @brief The collected messages.
+        std::vector< diagnostic_message > _messages;
+        /// @brief The sink replaced by the buffer.
+        diagnostic_sink _previous;
+    };
+
+}
@@ -0,0 +1,86 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Graph.hh"
+#include "representation/System.hh"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Correspondences of the variables of the contracts of a system:
+    /// for each contract, the map from the names of its variables to the
+    /// names of the variables of the system. Names not in the map are
+    /// matched as they are.
+    typedef std::map< Contract *, names_projection_map > system_correspondences;
+
+    /// @brief Variable-interaction graph of a system.
+    typedef struct interaction_graph {
+        /// @brief Undirected graph with a node per contract, whose vertex is
+        /// named as the contract, and an edge for each pair of contracts
+        /// sharing variables, weighted by the number of shared variables.
+        Graph * graph;
+        /// @brief The contract of each node, in order of name.
+        std::vector< Contract * > contracts;
+        /// @brief The variables shared by the contracts of each edge, indexed
+        /// as the edges: the declarations of the system if it declares them,
+        /// otherwise the ones of the first contract.
+        std::vector< std::vector< Declaration * > > shared;
+    } interaction_graph;
+
+    /// @brief Partition of the contracts of a system into clusters.
+    typedef struct system_partition {
+        /// @brief The contracts of each cluster.
+        std::vector< std::vector< Contract * > > clusters;
+        /// @brief The variables shared by contracts of different clusters,
+        /// i.e., the interface along which the compositions of the clusters
+        /// are to be joined.
+        std::vector< Declaration * > interface;
+        /// @brief The number of pairs of contracts of different clusters
+        /// sharing a variable, counted once per variable.
+        double cut;
+    } system_partition;
+
+    /// @brief Function building the variable-interaction graph of a system.
+    /// A variable shared by k contracts contributes an edge to each of the
+    /// k * (k - 1) / 2 pairs of them.
+    /// @param system The system.
+    /// @param correspondences The correspondences of the names of the
+    /// variables of the contracts.
+    /// @return The graph. The caller owns the graph and its vertexes, which
+    /// are not deleted by the graph.
+    interaction_graph buildInteractionGraph(
+            System * system,
+            const system_correspondences & correspondences =
+                    system_correspondences() );
+
+    /// @brief Function splitting the contracts of a system into loosely
+    /// coupled clusters of similar size, by partitioning its interaction
+    /// graph (see partitionGraph). The clusters can be composed
+    /// independently, e.g., in parallel, and their compositions joined
+    /// along the interface.
+    /// @param system The system.
+    /// @param clusters The number of clusters.
+    /// @param correspondences The correspondences of the names of the
+    /// variables of the contracts.
+    /// @param imbalance The maximum excess of the size of a cluster over the
+    /// average, as a fraction of it.
+    /// @param seed The seed of the partitioner.
+    /// @return The partition.
+    system_partition partitionSystem(
+            System * system,
+            unsigned int clusters,
+            const system_correspondences & correspondences =
+                    system_correspondences(),
+            double imbalance = 0.03,
+            uint64_t seed = 0 );
+
+}
@@ -0,0 +1,197 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Constraint.hh"
+#include "representation/Contract.hh"
+#include "representation/DataDeclaration.hh"
+#include "representation/Expression.hh"
+#include "representation/Interval.hh"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Closed interval of real numbers. Infinite bounds are
+    /// represented by the IEEE infinities. The interval is empty when the
+    /// lower bound is greater than the upper bound.
+    typedef struct interval_domain {
+        /// @brief Lower bound.
+        double lower;
+        /// @brief Upper bound.
+        double upper;
+
+        /// @brief Function checking whether the interval is empty.
+        /// @return True if the interval contains no value.
+        bool isEmpty() const;
+    } interval_domain;
+
+    /// @brief Kinds of the nodes of the constraints trees.
+    enum hc4_node_kind
+    {
+        hc4_constant,
+        hc4_variable,
+        hc4_operation
+    };
+
+    /// @brief Node of a constraint tree flattened for the propagation.
+    typedef struct hc4_node {
+        /// @brief Kind of the node.
+        hc4_node_kind kind;
+        /// @brief Operator of operation nodes.
+        Operator op;
+        /// @brief Index of the first operand, or -1.
+        int left;
+        /// @brief Index of the second operand, or -1.
+        int right;
+        /// @brief Index of the variable of variable nodes, or value of the
+        /// constant nodes.
+        double value;
+        /// @brief True if the node can take only integer values.
+        bool integral;
+        /// @brief Interval of the node computed by the revise.
+        interval_domain domain;
+    } hc4_node;
+
+    /// @brief Engine narrowing the domains of the variables of a set of
+    /// arithmetic constraints. Each constraint is revised with the HC4
+    /// algorithm: a forward evaluation of the expression tree over
+    /// intervals, followed by a backward projection of the relation on
+    /// the operands. A worklist scheduler re-runs only the constraints
+    /// containing variables whose domain has changed.
+    /// The engine uses floating-point arithmetic without outward rounding,
+    /// so the resulting domains are approximated up to rounding errors.
+    class IntervalPropagator {
+    public:
+        /// @brief Constructor.
+        IntervalPropagator();
+
+        /// @brief Destructor.
+        ~IntervalPropagator();
+
+        /// @brief Function adding a variable. The initial domain is the one
+        /// of its type (Integer, Real or Boolean). Variables appearing in
+        /// the constraints are added automatically.
+        /// @param declaration The declaration of the variable.
+        /// @return The index of the variable.
+        unsigned int addVariable(DataDeclaration * declaration);
+
+        /// @brief Function adding a variable with a given domain.
+        /// @param declaration The declaration of the variable.
+        /// @param domain A Range or an Interval with numeric bounds.
+        /// @return The index of the variable.
+        unsigned int addVariable(DataDeclaration * declaration, Value * domain);
+
+        /// @brief Function restricting the domain of a variable.
+        /// @param declaration The declaration of the variable.
+        /// @param lower The lower bound.
+        /// @param upper The upper bound.
+        void setDomain(DataDeclaration * declaration,
+                       double lower, double upper);
+
+        /// @brief Function adding a constraint.
+        /// @param constraint The constraint. Its expression must be a
+        /// relation (=, !=, <, >, <=, >=) between arithmetic expressions.
+        void addConstraint(Constraint * constraint);
+
+        /// @brief Function adding a relation as a constraint.
+        /// @param expression The relation.
+        void addConstraint(Expression * expression);
+
+        /// @brief Function adding all the constraints of a contract, both
+        /// assumptions and guarantees, in the constraints domain.
+        /// @param contract The contract.
+        void addContract(Contract * contract);
+
+        /// @brief Function running the propagation until a fixed point is
+        /// reached, or until the domains stop shrinking significantly.
+        /// @return False if some domain becomes empty, i.e., the
+        /// constraints are unsatisfiable. True otherwise.
+        bool propagate();
+
+        /// @brief Function checking whether the last propagation found the
+        /// constraints consistent.
+        /// @return False if the constraints are known to be unsatisfiable.
+        bool isConsistent() const;
+
+        /// @brief Getter of the domain of a variable.
+        /// @param declaration The declaration of the variable.
+        /// @return The domain of the variable.
+        const interval_domain & getDomain(DataDeclaration * declaration) const;
+
+        /// @brief Function building the domain of a variable as an Interval.
+        /// @param declaration The declaration of the variable.
+        /// @return A pointer to a new Interval, with IntegerValue bounds for
+        /// integer variables and RealValue bounds otherwise.
+        Interval * getInterval(DataDeclaration * declaration) const;
+
+        /// @brief Setter of the precision of the propagation. A constraint
+        /// is re-scheduled only if the width of the domain of one of its
+        /// variables has been reduced by more than this ratio.
+        /// @param precision The relative precision.
+        void setPrecision(double precision);
+
+        /// @brief Getter of the number of revisions run so far.
+        /// @return The number of revisions.
+        size_t getRevisionsCount() const;
+
+        /// @brief Function printing the domains of the variables.
+        /// @return The string representing the domains.
+        std::string getString() const;
+
+    protected:
+
+        /// @brief Flattened constraint.
+        typedef struct hc4_constraint {
+            /// @brief The nodes, in post-order: the root is the last one.
+            std::vector< hc4_node > nodes;
+            /// @brief Indexes of the variables of the constraint.
+            std::vector< unsigned int > variables;
+        } hc4_constraint;
+
+        /// @brief The variables.
+        std::vector< DataDeclaration * > _variables;
+        /// @brief Map from the declarations to the variables indexes.
+        std::map< DataDeclaration *, unsigned int > _variablesIndex;
+        /// @brief The domains of the variables.
+        std::vector< interval_domain > _domains;
+        /// @brief Flags marking the integer variables.
+        std::vector< bool > _integers;
+        /// @brief For each variable, the constraints in which it appears.
+        std::vector< std::vector< unsigned int > > _watches;
+        /// @brief The constraints.
+        std::vector< hc4_constraint > _constraints;
+        /// @brief Relative precision of the propagation.
+        double _precision;
+        /// @brief Number of revisions.
+        size_t _revisions;
+        /// @brief False if the constraints are unsatisfiable.
+        bool _consistent;
+
+        /// @brief Function building the nodes of a tree.
+        /// @param value The root of the tree.
+        /// @param c The constraint receiving the nodes.
+        /// @return The index of the root node.
+        int _flatten(Value * value, hc4_constraint & c);
+
+        /// @brief Function narrowing the domain of a variable.
+        /// @param var The variable index.
+        /// @param d The new domain, intersected with the current one.
+        /// @return True if the domain shrank significantly.
+        bool _narrow(unsigned int var, interval_domain d);
+
+        /// @brief HC4 revise of a constraint.
+        /// @param index The index of the constraint.
+        /// @param changed Receives the variables whose domain changed.
+        /// @return False if the constraint is unsatisfiable.
+        bool _revise(unsigned int index, std::vector< unsigned int > & changed);
+    };
+
+}
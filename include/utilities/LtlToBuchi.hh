@@ -0,0 +1,282 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/LogicFormula.hh"
+#include "representation/Contract.hh"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Kinds of the nodes stored in the hash-consed LTL table. The
+    /// table only stores formulas in negation normal form: negations may
+    /// appear only in front of atoms.
+    enum ltl_node_kind
+    {
+        ltl_true,
+        ltl_false,
+        ltl_atom,
+        ltl_not_atom,
+        ltl_and,
+        ltl_or,
+        ltl_next,
+        ltl_until,
+        ltl_release
+    };
+
+    /// @brief Node of the hash-consed LTL table. For literals, left is the
+    /// index of the atom. For unary operators, right is unused.
+    typedef struct ltl_node {
+        /// @brief Kind of the node.
+        ltl_node_kind kind;
+        /// @brief First operand (or atom index for literals).
+        unsigned int left;
+        /// @brief Second operand.
+        unsigned int right;
+
+        /// @brief Equality operator, used by the hash-consing.
+        bool operator==(const ltl_node & o) const;
+    } ltl_node;
+
+    /// @brief Hash function of the LTL nodes.
+    struct ltl_node_hash {
+        /// @brief Hash function.
+        size_t operator()(const ltl_node & n) const;
+    };
+
+    /// @brief Hash function of the sets of formulas identifying the states.
+    struct ltl_state_hash {
+        /// @brief Hash function.
+        size_t operator()(const std::vector< unsigned int > & s) const;
+    };
+
+    /// @brief Bitset used for transition labels and acceptance conditions.
+    typedef std::vector< uint64_t > ltl_bitset;
+
+    /// @brief Table of hash-consed LTL formulas. Structurally equal
+    /// sub-formulas are stored once and identified by an integer.
+    class LtlFormulaTable {
+    public:
+        /// @brief Constructor.
+        LtlFormulaTable();
+
+        /// @brief Destructor.
+        ~LtlFormulaTable();
+
+        /// @brief Function inserting a formula in the table. Negations are
+        /// pushed towards the atoms while inserting the formula, as done by
+        /// the LogicNotNormalizationVisitor, so that the stored formula is
+        /// always in negation normal form.
+        /// @param formula The formula to insert.
+        /// @param negated True to insert the negation of the formula.
+        /// @return The identifier of the formula in the table.
+        unsigned int intern(LogicFormula * formula, bool negated = false);
+
+        /// @brief Function building a node, reusing it if already existing.
+        /// @param kind The kind of the node.
+        /// @param left The first operand.
+        /// @param right The second operand.
+        /// @return The identifier of the node.
+        unsigned int makeNode(ltl_node_kind kind,
+                              unsigned int left = 0, unsigned int right = 0);
+
+        /// @brief Function building the negation (in negation normal form)
+        /// of a formula of the table.
+        /// @param id The identifier of the formula to negate.
+        /// @return The identifier of the negated formula.
+        unsigned int negate(unsigned int id);
+
+        /// @brief Getter of a node.
+        /// @param id The identifier of the node.
+        /// @return A reference to the node.
+        const ltl_node & getNode(unsigned int id) const;
+
+        /// @brief Getter of the number of nodes in the table.
+        /// @return The number of nodes.
+        size_t getSize() const;
+
+        /// @brief Getter of the number of atoms in the table.
+        /// @return The number of atoms.
+        size_t getAtomsCount() const;
+
+        /// @brief Getter of the name of an atom.
+        /// @param atom The index of the atom.
+        /// @return The string used to identify the atom.
+        const std::string & getAtomName(unsigned int atom) const;
+
+        /// @brief Getter of the number of until nodes in the table. Each
+        /// until node defines one acceptance condition of the automata.
+        /// @return The number of until nodes.
+        size_t getUntilsCount() const;
+
+        /// @brief Getter of the acceptance index of an until node.
+        /// @param id The identifier of the until node.
+        /// @return The acceptance index of the node.
+        unsigned int getAcceptanceIndex(unsigned int id) const;
+
+        /// @brief Function printing a formula of the table.
+        /// @param id The identifier of the formula.
+        /// @return The string representing the formula.
+        std::string getString(unsigned int id) const;
+
+    protected:
+
+        /// @brief The nodes of the table.
+        std::vector< ltl_node > _nodes;
+        /// @brief Index used for the hash-consing.
+        std::unordered_map< ltl_node, unsigned int, ltl_node_hash > _index;
+        /// @brief Map from the name of the atoms to their index.
+        std::unordered_map< std::string, unsigned int > _atoms;
+        /// @brief Names of the atoms.
+        std::vector< std::string > _atomNames;
+        /// @brief Map from the until nodes to their acceptance index.
+        std::unordered_map< unsigned int, unsigned int > _untils;
+        /// @brief Memoization of the negations of the nodes.
+        std::unordered_map< unsigned int, unsigned int > _negations;
+
+        /// @brief Function returning the atom index of a proposition.
+        /// @param name The string identifying the proposition.
+        /// @return The index of the atom.
+        unsigned int _getAtom(const std::string & name);
+    };
+
+    /// @brief Transition of a Büchi automaton. The transition is enabled by
+    /// the letters assigning true to all the positive atoms, and false to all
+    /// the negative atoms. Acceptance conditions are carried by transitions.
+    typedef struct buchi_transition {
+        /// @brief Target state of the transition.
+        unsigned int target;
+        /// @brief Atoms that must hold.
+        ltl_bitset positive;
+        /// @brief Atoms that must not hold.
+        ltl_bitset negative;
+        /// @brief Acceptance sets to which the transition belongs.
+        ltl_bitset acceptance;
+    } buchi_transition;
+
+    /// @brief Generalized Büchi automaton (with acceptance conditions on
+    /// transitions) recognizing the models of a LTL formula. It is built
+    /// with the tableau construction: each state is the set of formulas
+    /// that must hold from that point on. The states are generated on the
+    /// fly, only when their successors are requested.
+    class BuchiAutomaton {
+    public:
+        /// @brief Constructor.
+        /// @param formula The LTL formula to translate.
+        /// @param negated True to translate the negation of the formula.
+        explicit BuchiAutomaton(LogicFormula * formula, bool negated = false);
+
+        /// @brief Destructor.
+        ~BuchiAutomaton();
+
+        /// @brief Getter of the initial state.
+        /// @return The index of the initial state.
+        unsigned int getInitialState() const;
+
+        /// @brief Function returning the outgoing transitions of a state.
+        /// The state is expanded when the function is first called on it.
+        /// @param state The index of the state.
+        /// @return The outgoing transitions of the state.
+        const std::vector< buchi_transition > & getSuccessors(
+                unsigned int state);
+
+        /// @brief Function generating all the states reachable from the
+        /// initial state.
+        void explore();
+
+        /// @brief Getter of the number of states generated so far.
+        /// @return The number of states.
+        size_t getStatesCount() const;
+
+        /// @brief Getter of the number of acceptance sets.
+        /// @return The number of acceptance sets.
+        size_t getAcceptanceSetsCount() const;
+
+        /// @brief Getter of the set of formulas labeling a state.
+        /// @param state The index of the state.
+        /// @return The sorted set of formula identifiers of the state.
+        const std::vector< unsigned int > & getStateFormulas(
+                unsigned int state) const;
+
+        /// @brief Function checking the emptiness of the language of the
+        /// automaton. The check explores the automaton on the fly searching
+        /// for a reachable strongly connected component intersecting all the
+        /// acceptance sets, and it stops as soon as one is found.
+        /// @return True if the automaton accepts no word.
+        bool isEmpty();
+
+        /// @brief Getter of the formula table used by the automaton.
+        /// @return A reference to the table.
+        LtlFormulaTable & getTable();
+
+        /// @brief Function printing the automaton. Only the states generated
+        /// so far are printed.
+        /// @return The textual representation of the automaton.
+        std::string getString();
+
+    protected:
+
+        /// @brief The table of the formulas.
+        LtlFormulaTable _table;
+        /// @brief The sets of formulas labeling the states. A deque is used
+        /// so that references to the states survive the generation of new
+        /// states.
+        std::deque< std::vector< unsigned int > > _states;
+        /// @brief Index used for the hash-consing of the states.
+        std::unordered_map< std::vector< unsigned int >, unsigned int,
+                ltl_state_hash > _statesIndex;
+        /// @brief Outgoing transitions of the states.
+        std::deque< std::vector< buchi_transition > > _transitions;
+        /// @brief Flags marking the states already expanded.
+        std::vector< bool > _expanded;
+        /// @brief The initial state.
+        unsigned int _initial;
+        /// @brief Number of words of the label bitsets.
+        size_t _labelWords;
+        /// @brief Number of words of the acceptance bitsets.
+        size_t _acceptanceWords;
+
+        /// @brief Function returning the state labeled by a set of formulas,
+        /// creating it if necessary.
+        /// @param formulas The sorted set of formulas.
+        /// @return The index of the state.
+        unsigned int _getState(const std::vector< unsigned int > & formulas);
+
+        /// @brief Function computing the outgoing transitions of a state by
+        /// expanding its formulas.
+        /// @param state The index of the state.
+        void _expand(unsigned int state);
+    };
+
+    /// @brief Function checking whether a LTL formula is satisfiable.
+    /// @param formula The formula to check.
+    /// @return True if the formula has at least a model.
+    bool isSatisfiableLTL(LogicFormula * formula);
+
+    /// @brief Function checking whether a LTL formula is valid.
+    /// @param formula The formula to check.
+    /// @return True if every word is a model of the formula.
+    bool isValidLTL(LogicFormula * formula);
+
+    /// @brief Function checking the refinement between two contracts whose
+    /// specifications are in the logic domain. It builds the refinement check
+    /// contract and decides the validity of its formulas.
+    /// @param c1 The refining contract.
+    /// @param c2 The refined contract.
+    /// @param correspondences Map of the correspondences between the names
+    /// of the two contracts (see Contract::refinementCheck).
+    /// @return True if c1 refines c2.
+    bool checkRefinementLTL(Contract * c1, Contract * c2,
+                            names_projection_map & correspondences);
+
+}
@@ -0,0 +1,60 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Graph.hh"
+
+#include <vector>
+
+namespace chase {
+
+    /// @brief Minimum cut separating two nodes.
+    typedef struct minimum_cut {
+        /// @brief True for the nodes on the side of the source, i.e.,
+        /// still reachable from it once the cut is removed.
+        std::vector< bool > sourceSide;
+        /// @brief The nodes of the cut, for vertex cuts.
+        std::vector< unsigned int > nodes;
+        /// @brief The indexes of the edges of the cut (see Graph::getEdgeAt).
+        /// For vertex cuts, the edges linking the source to the target,
+        /// which no vertex cut can separate.
+        std::vector< unsigned int > edges;
+    } minimum_cut;
+
+    /// @brief Function counting the edge-disjoint paths between two nodes,
+    /// i.e., the maximum flow with unit capacity on every edge, computed by
+    /// the Dinic algorithm in time O(E * min(V^(2/3), E^(1/2))). By Menger
+    /// theorem, it is the number of edges that must be removed to separate
+    /// the nodes. Undirected edges can be used in either direction.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param source The source node.
+    /// @param target The target node.
+    /// @param cut If not null, it receives a minimum set of edges whose
+    /// removal separates the nodes.
+    /// @return The number of edge-disjoint paths.
+    unsigned int countEdgeDisjointPaths( const compact_adjacency & adjacency,
+                                         unsigned int source,
+                                         unsigned int target,
+                                         minimum_cut * cut = nullptr );
+
+    /// @brief Function counting the paths between two nodes sharing no node
+    /// but the source and the target, as a unit-capacity flow through the
+    /// nodes, each one split into an input and an output node. Every edge
+    /// from the source to the target is a path by itself.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param source The source node.
+    /// @param target The target node.
+    /// @param cut If not null, it receives a minimum set of nodes, plus the
+    /// direct edges, whose removal separates the nodes.
+    /// @return The number of vertex-disjoint paths.
+    unsigned int countVertexDisjointPaths( const compact_adjacency & adjacency,
+                                           unsigned int source,
+                                           unsigned int target,
+                                           minimum_cut * cut = nullptr );
+
+}
@@ -0,0 +1,139 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// @brief Instrumentation macros. They are compiled only when CHASE_PROFILING
+/// is defined (see the ENABLE_PROFILING option of CMake), and do nothing
+/// until the profiling is enabled at runtime with setProfilingEnabled.
+#define CHASE_PROFILE_CONCAT_(a, b) a##b
+#define CHASE_PROFILE_CONCAT(a, b) CHASE_PROFILE_CONCAT_(a, b)
+
+#ifdef CHASE_PROFILING
+/// @brief Time the enclosing scope under the given name, which must be a
+/// string literal.
+#define CHASE_PROFILE_SCOPE(name) \
+    chase::ScopedTimer CHASE_PROFILE_CONCAT(_chase_timer_, __LINE__)(name)
+/// @brief Add a value to the counter with the given name, which must be a
+/// string literal.
+#define CHASE_PROFILE_COUNT(name, value) \
+    chase::addProfileCounter(name, value)
+#else
+#define CHASE_PROFILE_SCOPE(name) ((void)0)
+#define CHASE_PROFILE_COUNT(name, value) ((void)0)
+#endif
+
+namespace chase {
+
+    /// @brief Structure of the flat profile of an instrumented scope. Times
+    /// are in nanoseconds.
+    typedef struct profile_entry {
+        /// @brief Name of the scope.
+        std::string name;
+        /// @brief Number of executions.
+        uint64_t calls;
+        /// @brief Time spent in the scope.
+        uint64_t total;
+        /// @brief Time spent in the scope, excluding the instrumented scopes
+        /// nested into it.
+        uint64_t self;
+    } profile_entry;
+
+    /// @brief Structure of an execution of a scope, as recorded when the
+    /// tracing is enabled. Times are in nanoseconds from the start of the
+    /// program.
+    typedef struct trace_event {
+        /// @brief Name of the scope.
+        const char * name;
+        /// @brief Start time.
+        uint64_t start;
+        /// @brief Duration.
+        uint64_t duration;
+        /// @brief Index of the thread.
+        unsigned int thread;
+    } trace_event;
+
+    /// @brief Timer measuring a scope, from its construction to its
+    /// destruction. Every thread accumulates its own measures, so that the
+    /// timers do not contend; they are merged on demand. Use the
+    /// CHASE_PROFILE_SCOPE macro rather than this class directly.
+    class ScopedTimer {
+    public:
+        /// @brief Constructor.
+        /// @param name The name of the scope. It must outlive the profile,
+        /// as string literals do.
+        explicit ScopedTimer(const char * name);
+
+        /// @brief Destructor.
+        ~ScopedTimer();
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer & operator=(const ScopedTimer &) = delete;
+
+    protected:
+        /// @brief Name of the scope.
+        const char * _name;
+        /// @brief Timer of the enclosing scope in the same thread.
+        ScopedTimer * _parent;
+        /// @brief Start time.
+        uint64_t _start;
+        /// @brief Time spent in the nested timers.
+        uint64_t _children;
+        /// @brief False if the profiling was disabled at construction.
+        bool _active;
+    };
+
+    /// @brief Function enabling or disabling the profiling.
+    /// @param enabled True to enable the profiling.
+    /// @param trace True to record also every execution of the scopes, for
+    /// the trace. The trace grows with the number of executions.
+    void setProfilingEnabled(bool enabled, bool trace = false);
+
+    /// @brief Function checking whether the profiling is enabled.
+    /// @return True if the profiling is enabled.
+    bool isProfilingEnabled();
+
+    /// @brief Function discarding all the measures of all the threads.
+    void resetProfile();
+
+    /// @brief Function adding a value to a counter of the current thread.
+    /// It does nothing if the profiling is disabled.
+    /// @param name The name of the counter. It must outlive the profile.
+    /// @param value The value to add.
+    void addProfileCounter(const char * name, int64_t value = 1);
+
+    /// @brief Function merging the measures of all the threads in a flat
+    /// profile.
+    /// @return The profile, sorted by decreasing self time.
+    std::vector< profile_entry > getProfileSummary();
+
+    /// @brief Function merging the counters of all the threads.
+    /// @return The counters by name.
+    std::map< std::string, int64_t > getProfileCounters();
+
+    /// @brief Function merging the recorded executions of all the threads.
+    /// @return The executions, sorted by start time.
+    std::vector< trace_event > getProfileTrace();
+
+    /// @brief Function printing the flat profile and the counters as a
+    /// table.
+    /// @param out The stream.
+    void printProfileSummary(std::ostream & out);
+
+    /// @brief Function writing the recorded executions and the counters in
+    /// the Chrome trace-event format, which can be loaded in
+    /// chrome://tracing or Perfetto.
+    /// @param out The stream.
+    void writeChromeTrace(std::ostream & out);
+
+}
@@ -0,0 +1,91 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace chase {
+
+    /// @brief Exact rational number. Numerator and denominator are stored
+    /// as 64-bit integers, always reduced and with a positive denominator.
+    /// Operations are computed on 128-bit integers, and an error is raised
+    /// if the result does not fit in 64 bits.
+    class Rational {
+    public:
+        /// @brief Constructor.
+        /// @param numerator The numerator.
+        /// @param denominator The denominator. It must not be zero.
+        Rational(int64_t numerator = 0, int64_t denominator = 1);
+
+        /// @brief Function building the rational closest to a double, with
+        /// denominator not greater than 10^9.
+        /// @param value The value to convert.
+        /// @return The rational approximating the value.
+        static Rational fromDouble(double value);
+
+        /// @brief Getter of the numerator.
+        /// @return The numerator.
+        int64_t getNumerator() const;
+
+        /// @brief Getter of the denominator.
+        /// @return The denominator (always positive).
+        int64_t getDenominator() const;
+
+        /// @brief Function converting the number into a double.
+        /// @return The closest double.
+        double toDouble() const;
+
+        /// @brief Function checking if the number is an integer.
+        /// @return True if the denominator is one.
+        bool isInteger() const;
+
+        /// @brief Function computing the largest integer not greater than
+        /// the number.
+        /// @return The floor of the number.
+        Rational floor() const;
+
+        /// @brief Function computing the smallest integer not lower than
+        /// the number.
+        /// @return The ceiling of the number.
+        Rational ceil() const;
+
+        /// @brief Function returning the sign of the number.
+        /// @return -1, 0 or 1.
+        int sign() const;
+
+        /// @brief Function printing the number.
+        /// @return The string n/d, or n for integers.
+        std::string getString() const;
+
+        /// @cond
+        Rational operator-() const;
+        Rational operator+(const Rational & o) const;
+        Rational operator-(const Rational & o) const;
+        Rational operator*(const Rational & o) const;
+        Rational operator/(const Rational & o) const;
+        Rational & operator+=(const Rational & o);
+        Rational & operator-=(const Rational & o);
+        Rational & operator*=(const Rational & o);
+        Rational & operator/=(const Rational & o);
+        bool operator==(const Rational & o) const;
+        bool operator!=(const Rational & o) const;
+        bool operator<(const Rational & o) const;
+        bool operator<=(const Rational & o) const;
+        bool operator>(const Rational & o) const;
+        bool operator>=(const Rational & o) const;
+        /// @endcond
+
+    protected:
+        /// @brief The numerator.
+        int64_t _num;
+        /// @brief The denominator.
+        int64_t _den;
+    };
+
+}
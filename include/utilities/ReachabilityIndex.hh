@@ -0,0 +1,107 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Graph.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Index answering whether a node of a graph reaches another one.
+    /// The strongly connected components of the graph are collapsed into the
+    /// nodes of a DAG (the condensation). The transitive closure of the DAG
+    /// is then stored as a bit matrix, computed with word-parallel ORs of
+    /// 64-bit blocks in O(V * E / 64), so that queries are a bit test.
+    /// When the matrix would exceed a memory budget, the index falls back to
+    /// interval labels (GRAIL): several post-order intervals per component,
+    /// which reject most unreachable pairs in constant time, and prune the
+    /// search of the DAG for the others.
+    /// The index is immutable after construction, and it can be queried
+    /// concurrently. It is not updated when the graph changes.
+    class ReachabilityIndex {
+    public:
+        /// @brief Constructor.
+        /// @param graph The graph.
+        /// @param maxMatrixBytes Memory budget of the bit matrix. Graphs
+        /// needing more use the interval labels.
+        /// @param labelings Number of interval labels per component, when
+        /// they are used.
+        explicit ReachabilityIndex( Graph * graph,
+                                    size_t maxMatrixBytes = size_t(1) << 28,
+                                    unsigned int labelings = 3 );
+
+        /// @brief Constructor over a compact adjacency, e.g., the one of a
+        /// GraphView.
+        /// @param adjacency The adjacency.
+        /// @param maxMatrixBytes Memory budget of the bit matrix.
+        /// @param labelings Number of interval labels per component.
+        explicit ReachabilityIndex( const compact_adjacency & adjacency,
+                                    size_t maxMatrixBytes = size_t(1) << 28,
+                                    unsigned int labelings = 3 );
+
+        /// @brief Function checking whether a node reaches another one. Every
+        /// node reaches itself.
+        /// @param source The source node.
+        /// @param target The target node.
+        /// @return True if there is a path from source to target.
+        bool reaches( unsigned int source, unsigned int target ) const;
+
+        /// @brief Function providing the strongly connected component of a
+        /// node. Components are numbered in reverse topological order: the
+        /// components reached from a component have lower numbers.
+        /// @param node The node.
+        /// @return The component.
+        unsigned int getComponent( unsigned int node ) const;
+
+        /// @brief Function providing the number of strongly connected
+        /// components.
+        /// @return The number of components.
+        unsigned int getComponentsCount() const;
+
+        /// @brief Function checking whether the index uses the bit matrix.
+        /// @return True for the bit matrix, false for the interval labels.
+        bool isDense() const;
+
+        /// @brief Function providing the memory used by the index.
+        /// @return The number of bytes.
+        size_t getBytes() const;
+
+    protected:
+        /// @brief Component of each node.
+        std::vector< unsigned int > _component;
+        /// @brief Number of components.
+        unsigned int _components;
+        /// @brief Condensation DAG, over the components.
+        compact_adjacency _dag;
+        /// @brief Number of 64-bit words of a row of the matrix.
+        size_t _words;
+        /// @brief Bit matrix of the closure: row c holds the components
+        /// reached by c. Empty when the labels are used.
+        std::vector< uint64_t > _matrix;
+        /// @brief Number of interval labels per component.
+        unsigned int _labelings;
+        /// @brief Interval labels: the pairs (low, post) of the labeling l
+        /// of the component c are at 2 * (c * _labelings + l).
+        std::vector< unsigned int > _labels;
+
+        /// @brief Function building the index.
+        void _build( const compact_adjacency & adjacency,
+                     size_t maxMatrixBytes );
+
+        /// @brief Function checking whether the labels of a component
+        /// contain the ones of another component.
+        bool _contains( unsigned int c, unsigned int d ) const;
+
+        /// @brief Search of the DAG pruned by the labels.
+        bool _search( unsigned int source, unsigned int target ) const;
+    };
+
+}
@@ -0,0 +1,124 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Graph.hh"
+#include "utilities/ThreadPool.hh"
+
+#include <vector>
+
+namespace chase {
+
+    /// @brief Priority queues of the Dijkstra algorithm.
+    typedef enum dijkstra_heap {
+        /// @brief Binary heap, O((V + E) log V).
+        binary_heap,
+        /// @brief Radix heap over the bits of the distances, which are
+        /// monotone for non-negative doubles. Each node moves across at most
+        /// 64 buckets, and no comparison of distances is performed.
+        radix_heap
+    } dijkstra_heap;
+
+    /// @brief Shortest paths from a source node.
+    typedef struct shortest_paths {
+        /// @brief The source node.
+        unsigned int source;
+        /// @brief Distance of each node from the source, infinity for the
+        /// nodes not reached.
+        std::vector< double > distances;
+        /// @brief Previous node of each node on its shortest path, UINT_MAX
+        /// for the source and for the nodes not reached.
+        std::vector< unsigned int > parents;
+        /// @brief Index of the edge (see Graph::getEdgeAt) from the parent
+        /// of each node, UINT_MAX for the source and for the nodes not
+        /// reached.
+        std::vector< unsigned int > edges;
+
+        /// @brief Function providing the shortest path to a node.
+        /// @param target The node.
+        /// @return The nodes of the path, from the source to the target, or
+        /// an empty list if the target is not reached.
+        std::vector< unsigned int > getPath( unsigned int target ) const;
+    } shortest_paths;
+
+    /// @brief Path with its length.
+    typedef struct weighted_path {
+        /// @brief Sum of the weights of the edges.
+        double length;
+        /// @brief The nodes, from the source to the target.
+        std::vector< unsigned int > nodes;
+        /// @brief The indexes of the edges (see Graph::getEdgeAt).
+        std::vector< unsigned int > edges;
+    } weighted_path;
+
+    /// @brief Function extracting the weights of the edges of a graph into
+    /// a dense array, so that the algorithms never touch the Value objects.
+    /// Weights must be IntegerValue or RealValue.
+    /// @param graph The graph.
+    /// @param unweighted The weight of the edges that are not WeightedEdge,
+    /// or have no weight.
+    /// @return The weight of each edge, indexed as Graph::getEdgeAt.
+    std::vector< double > getEdgeWeights( Graph * graph,
+                                          double unweighted = 1.0 );
+
+    /// @brief Dijkstra algorithm. Weights must not be negative.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param weights The weights of the edges, indexed by the edges of the
+    /// adjacency (see getEdgeWeights).
+    /// @param source The source node.
+    /// @param heap The priority queue.
+    /// @return The shortest paths from the source.
+    shortest_paths findShortestPaths( const compact_adjacency & adjacency,
+                                      const std::vector< double > & weights,
+                                      unsigned int source,
+                                      dijkstra_heap heap = binary_heap );
+
+    /// @brief Bellman-Ford algorithm, accepting negative weights, in time
+    /// O(V * E). In undirected graphs, a negative edge is a negative cycle.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param weights The weights of the edges.
+    /// @param source The source node.
+    /// @param result The shortest paths from the source. It is overwritten.
+    /// @return False if a negative cycle is reachable from the source: the
+    /// result is then meaningless.
+    bool findShortestPathsBellmanFord( const compact_adjacency & adjacency,
+                                       const std::vector< double > & weights,
+                                       unsigned int source,
+                                       shortest_paths & result );
+
+    /// @brief Yen algorithm, computing the k shortest simple paths between
+    /// two nodes. Weights must not be negative. Paths are distinguished by
+    /// their edges, hence parallel edges give different paths.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param weights The weights of the edges.
+    /// @param source The source node.
+    /// @param target The target node.
+    /// @param k The number of paths.
+    /// @return At most k paths, by increasing length.
+    std::vector< weighted_path > findKShortestPaths(
+            const compact_adjacency & adjacency,
+            const std::vector< double > & weights,
+            unsigned int source, unsigned int target, unsigned int k );
+
+    /// @brief Function running the Dijkstra algorithm from several sources
+    /// in parallel, one task per source.
+    /// @param adjacency The compact adjacency of the graph.
+    /// @param weights The weights of the edges.
+    /// @param sources The source nodes.
+    /// @param pool The pool running the searches.
+    /// @param heap The priority queue.
+    /// @return The shortest paths from each source, in the order of the
+    /// sources.
+    std::vector< shortest_paths > findShortestPathsFromSources(
+            const compact_adjacency & adjacency,
+            const std::vector< double > & weights,
+            const std::vector< unsigned int > & sources,
+            ThreadPool & pool,
+            dijkstra_heap heap = binary_heap );
+
+}
@@ -0,0 +1,363 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Constraint.hh"
+#include "representation/Contract.hh"
+#include "representation/DataDeclaration.hh"
+#include "representation/Expression.hh"
+#include "utilities/Rational.hh"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Results of the simplex checks.
+    enum simplex_result
+    {
+        simplex_sat,
+        simplex_unsat,
+        simplex_unknown
+    };
+
+    /// @brief Bound of a variable of the simplex tableau.
+    template< typename T >
+    struct simplex_bound {
+        /// @brief True if the bound exists.
+        bool present;
+        /// @brief Value of the bound.
+        T value;
+    };
+
+    /// @brief Tableau of the general simplex algorithm used by decision
+    /// procedures (Dutertre and de Moura, 2006). Every row defines a basic
+    /// variable as a linear combination of the non-basic ones, and the
+    /// constraints are bounds on the variables. Bounds can be asserted and
+    /// retracted with push and pop, while the rows are never removed, so
+    /// that the tableau is reused by the following checks.
+    /// The class is instantiated for double (fast, approximated) and
+    /// Rational (exact) numbers.
+    template< typename T >
+    class SimplexTableau {
+    public:
+        /// @brief Constructor.
+        SimplexTableau();
+
+        /// @brief Destructor.
+        ~SimplexTableau();
+
+        /// @brief Function adding an unbounded variable.
+        /// @return The index of the variable.
+        unsigned int addVariable();
+
+        /// @brief Function adding a variable defined by a linear
+        /// combination of the existing variables.
+        /// @param form Pairs of variable index and coefficient.
+        /// @return The index of the new (basic) variable.
+        unsigned int addRow(
+                const std::vector< std::pair< unsigned int, T > > & form);
+
+        /// @brief Function asserting a lower bound. Bounds weaker than the
+        /// current one are ignored.
+        /// @param var The variable.
+        /// @param value The bound.
+        void assertLower(unsigned int var, const T & value);
+
+        /// @brief Function asserting an upper bound. Bounds weaker than the
+        /// current one are ignored.
+        /// @param var The variable.
+        /// @param value The bound.
+        void assertUpper(unsigned int var, const T & value);
+
+        /// @brief Function asserting a lower bound below all the scopes, so
+        /// that it is never retracted by pop.
+        /// @param var The variable.
+        /// @param value The bound.
+        void assertBaseLower(unsigned int var, const T & value);
+
+        /// @brief Function asserting an upper bound below all the scopes, so
+        /// that it is never retracted by pop.
+        /// @param var The variable.
+        /// @param value The bound.
+        void assertBaseUpper(unsigned int var, const T & value);
+
+        /// @brief Function marking the current scope as unsatisfiable.
+        void assertConflict();
+
+        /// @brief Function opening a new scope of bounds.
+        void push();
+
+        /// @brief Function retracting the bounds asserted since the
+        /// matching push.
+        void pop();
+
+        /// @brief Function searching an assignment satisfying all the
+        /// bounds. The search starts from the current assignment, so that
+        /// incremental checks usually need few pivots.
+        /// @param maxPivots Maximum number of pivots, 0 for no limit.
+        /// @return The result of the check.
+        simplex_result check(size_t maxPivots = 0);
+
+        /// @brief Function moving the tableau to a given basis, and the
+        /// non-basic variables to the given bounds. Used to start a check
+        /// from the basis found by another tableau.
+        /// @param basic For each variable, true if it should be basic.
+        /// @param atUpper For each variable, -1 if it should be at its lower
+        /// bound, 1 if it should be at its upper bound, 0 otherwise.
+        void setBasis(const std::vector< bool > & basic,
+                      const std::vector< int > & atUpper);
+
+        /// @brief Function moving a non-basic variable to a value within
+        /// its bounds, updating the basic variables.
+        /// @param var The non-basic variable.
+        /// @param value The new value.
+        void setValue(unsigned int var, const T & value);
+
+        /// @brief Function making a basic variable non-basic, exchanging it
+        /// with a non-basic variable of its row.
+        /// @param var The basic variable.
+        /// @param allowed For each variable, true if it may enter the basis.
+        /// @return True if an exchange was possible.
+        bool pivotOut(unsigned int var, const std::vector< bool > & allowed);
+
+        /// @brief Function checking whether a variable is basic.
+        /// @param var The variable.
+        /// @return True if the variable is basic.
+        bool isBasic(unsigned int var) const;
+
+        /// @brief Getter of the value of a variable.
+        /// @param var The variable.
+        /// @return The value in the current assignment.
+        const T & getValue(unsigned int var) const;
+
+        /// @brief Getter of the lower bound of a variable.
+        /// @param var The variable.
+        /// @return The bound.
+        const simplex_bound< T > & getLower(unsigned int var) const;
+
+        /// @brief Getter of the upper bound of a variable.
+        /// @param var The variable.
+        /// @return The bound.
+        const simplex_bound< T > & getUpper(unsigned int var) const;
+
+        /// @brief Getter of the number of variables.
+        /// @return The number of variables.
+        size_t getVariablesCount() const;
+
+        /// @brief Getter of the number of pivots done so far.
+        /// @return The number of pivots.
+        size_t getPivotsCount() const;
+
+    protected:
+
+        /// @brief Entry of the trail of the bounds.
+        typedef struct trail_entry {
+            /// @brief The variable.
+            unsigned int var;
+            /// @brief The previous lower bound.
+            simplex_bound< T > lower;
+            /// @brief The previous upper bound.
+            simplex_bound< T > upper;
+        } trail_entry;
+
+        /// @brief Rows of the tableau, dense over all the variables.
+        std::vector< std::vector< T > > _rows;
+        /// @brief Basic variable of each row.
+        std::vector< unsigned int > _basic;
+        /// @brief Row of each variable, or -1 for non-basic ones.
+        std::vector< int > _rowOf;
+        /// @brief Current assignment.
+        std::vector< T > _values;
+        /// @brief Lower bounds.
+        std::vector< simplex_bound< T > > _lower;
+        /// @brief Upper bounds.
+        std::vector< simplex_bound< T > > _upper;
+        /// @brief Trail of the bounds changes.
+        std::vector< trail_entry > _trail;
+        /// @brief For each scope, the trail size and the conflict flag.
+        std::vector< std::pair< size_t, bool > > _scopes;
+        /// @brief True if the current bounds are contradictory.
+        bool _conflict;
+        /// @brief Number of pivots.
+        size_t _pivots;
+
+        /// @brief Function setting a non-basic variable to a value,
+        /// updating the basic variables.
+        /// @param var The non-basic variable.
+        /// @param value The new value.
+        void _update(unsigned int var, const T & value);
+
+        /// @brief Function swapping a basic and a non-basic variable.
+        /// @param row The row of the leaving basic variable.
+        /// @param var The entering non-basic variable.
+        void _pivot(unsigned int row, unsigned int var);
+
+        /// @brief Function pivoting and updating the assignment, so that the
+        /// leaving variable takes the given value.
+        /// @param row The row of the leaving basic variable.
+        /// @param var The entering non-basic variable.
+        /// @param value The new value of the leaving variable.
+        void _pivotAndUpdate(unsigned int row, unsigned int var,
+                             const T & value);
+
+        /// @brief Function saving the bounds of a variable on the trail.
+        /// @param var The variable.
+        void _save(unsigned int var);
+
+        /// @brief Function marking the current scope and all the enclosing
+        /// ones as unsatisfiable.
+        void _assertBaseConflict();
+    };
+
+    /// @brief Solver of conjunctions of linear constraints over Real and
+    /// Integer variables. Constraints are relations (<=, >=, =) between
+    /// linear expressions; they are stored as bounds on the variables or on
+    /// slack variables of a simplex tableau. Each check runs first on a
+    /// double-precision tableau, and then confirms the result on an exact
+    /// rational tableau started from the basis found by the first one.
+    /// Integer variables are handled by branch and bound. Results are exact
+    /// with respect to the rational bounds; the bounds of Real types are
+    /// doubles, converted by Rational::fromDouble, so that a bound which is
+    /// not a fraction with denominator up to 10^9 is approximated.
+    class SimplexSolver {
+    public:
+        /// @brief Constructor.
+        SimplexSolver();
+
+        /// @brief Destructor.
+        ~SimplexSolver();
+
+        /// @brief Function adding a variable. Variables appearing in the
+        /// constraints are added automatically. The bounds of Integer, Real
+        /// and Boolean types are asserted in the base scope, even when the
+        /// variable is added inside a push, and are never retracted. A
+        /// warning is raised when a Real bound is approximated.
+        /// @param declaration The declaration of the variable.
+        /// @return The index of the variable.
+        unsigned int addVariable(DataDeclaration * declaration);
+
+        /// @brief Function adding a constraint to the current scope.
+        /// @param constraint The constraint.
+        void addConstraint(Constraint * constraint);
+
+        /// @brief Function adding a linear relation to the current scope.
+        /// @param expression The relation, with operator op_le, op_ge or
+        /// op_eq.
+        void addConstraint(Expression * expression);
+
+        /// @brief Function adding all the constraints of a contract, both
+        /// assumptions and guarantees, in the constraints domain.
+        /// @param contract The contract.
+        void addContract(Contract * contract);
+
+        /// @brief Function opening a new scope.
+        void push();
+
+        /// @brief Function removing the constraints added since the
+        /// matching push.
+        void pop();
+
+        /// @brief Function checking the satisfiability of the constraints.
+        /// @return simplex_sat, simplex_unsat, or simplex_unknown if the
+        /// branch and bound exceeded its limit.
+        simplex_result check();
+
+        /// @brief Getter of the value of a variable in the last model.
+        /// @param declaration The declaration of the variable.
+        /// @return The value of the variable.
+        Rational getValue(DataDeclaration * declaration) const;
+
+        /// @brief Function enabling or disabling the double-precision
+        /// tableau.
+        /// @param enabled True to use the fast path.
+        void setFastPath(bool enabled);
+
+        /// @brief Setter of the maximum number of branch and bound nodes.
+        /// @param limit The maximum number of nodes.
+        void setBranchLimit(size_t limit);
+
+        /// @brief Getter of the number of exact pivots done so far.
+        /// @return The number of pivots.
+        size_t getExactPivotsCount() const;
+
+        /// @brief Function printing the last model.
+        /// @return The string with the values of the variables.
+        std::string getString() const;
+
+    protected:
+
+        /// @brief Linear form: map from variables to coefficients.
+        typedef std::map< unsigned int, Rational > linear_form;
+
+        /// @brief The exact tableau.
+        SimplexTableau< Rational > _exact;
+        /// @brief The fast tableau.
+        SimplexTableau< double > _fast;
+        /// @brief The declarations of the variables, indexed by their
+        /// column. Slack variables have no declaration.
+        std::vector< DataDeclaration * > _declarations;
+        /// @brief Map from the declarations to their column.
+        std::map< DataDeclaration *, unsigned int > _variablesIndex;
+        /// @brief Flags marking the integer variables.
+        std::vector< bool > _integers;
+        /// @brief Slack variables of the normalized linear forms.
+        std::map< std::vector< std::pair< unsigned int, Rational > >,
+                unsigned int > _slacks;
+        /// @brief The last model.
+        std::vector< Rational > _model;
+        /// @brief True to use the fast path.
+        bool _fastPath;
+        /// @brief Maximum number of branch and bound nodes.
+        size_t _branchLimit;
+
+        /// @brief Function building the linear form of a value.
+        /// @param value The value.
+        /// @param form The form receiving the variables.
+        /// @param constant The constant term.
+        /// @param scale The coefficient of the value.
+        void _linearize(Value * value, linear_form & form,
+                        Rational & constant, const Rational & scale);
+
+        /// @brief Function adding a new column to both the tableaux.
+        /// @return The index of the column.
+        unsigned int _addColumn();
+
+        /// @brief Function asserting a bound on both the tableaux.
+        /// @param var The variable.
+        /// @param op op_le, op_ge or op_eq.
+        /// @param value The bound.
+        void _assert(unsigned int var, Operator op, const Rational & value);
+
+        /// @brief Function asserting a bound of the type of a variable on
+        /// the base scope of both the tableaux.
+        /// @param var The variable.
+        /// @param op op_le or op_ge.
+        /// @param value The bound.
+        void _assertBase(unsigned int var, Operator op,
+                         const Rational & value);
+
+        /// @brief Function checking the rational relaxation.
+        /// @return The result of the check.
+        simplex_result _checkRelaxation();
+
+        /// @brief Function rounding the non-basic variables to integer
+        /// values within their bounds, and restoring the feasibility. This
+        /// often yields an integer solution without branching.
+        /// @return The result of the check after the rounding.
+        simplex_result _patch();
+
+        /// @brief Branch and bound over the integer variables.
+        /// @param nodes The number of nodes explored so far.
+        /// @return The result of the search.
+        simplex_result _branch(size_t & nodes);
+    };
+
+}
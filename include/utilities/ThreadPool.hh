@@ -0,0 +1,107 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chase {
+
+    /// @brief Task executed by the thread pool.
+    typedef std::function< void() > pool_task;
+
+    /// @brief Pool of worker threads with work stealing. Every worker owns
+    /// a queue of tasks: the tasks submitted by a worker are pushed in its
+    /// own queue and executed in LIFO order, so that recursive searches
+    /// proceed depth first, while idle workers steal the oldest tasks (the
+    /// largest sub-problems) from the other queues.
+    /// Exceptions escaping from a task are reported as warnings.
+    class ThreadPool {
+    public:
+        /// @brief Constructor.
+        /// @param threads The number of workers, 0 to use the number of
+        /// hardware threads.
+        explicit ThreadPool(unsigned int threads = 0);
+
+        /// @brief Destructor. It waits for the pending tasks.
+        ~ThreadPool();
+
+        /// @brief Function submitting a task. It can be called by the
+        /// tasks themselves.
+        /// @param task The task.
+        void submit(pool_task task);
+
+        /// @brief Function waiting until all the submitted tasks, and the
+        /// tasks they submitted, are completed. It must not be called by a
+        /// task.
+        void wait();
+
+        /// @brief Getter of the number of workers.
+        /// @return The number of workers.
+        unsigned int getThreadsCount() const;
+
+        /// @brief Getter of the number of tasks stolen by the workers.
+        /// @return The number of steals.
+        size_t getStealsCount() const;
+
+        /// @brief Function returning the index of the worker running the
+        /// calling thread.
+        /// @return The index of the worker, or -1 if the caller is not a
+        /// worker of this pool.
+        int getWorkerIndex() const;
+
+    protected:
+
+        /// @brief Queue of the tasks of a worker.
+        typedef struct worker_queue {
+            /// @brief The mutex protecting the queue.
+            std::mutex mutex;
+            /// @brief The tasks.
+            std::deque< pool_task > tasks;
+        } worker_queue;
+
+        /// @brief The queues, one for each worker.
+        std::vector< std::unique_ptr< worker_queue > > _queues;
+        /// @brief The workers.
+        std::vector< std::thread > _threads;
+        /// @brief The mutex protecting the sleeping and waiting workers.
+        std::mutex _mutex;
+        /// @brief Condition signaled when tasks are submitted.
+        std::condition_variable _available;
+        /// @brief Condition signaled when all the tasks are completed.
+        std::condition_variable _idle;
+        /// @brief Number of tasks in the queues.
+        std::atomic< size_t > _queued;
+        /// @brief Number of tasks submitted and not completed.
+        std::atomic< size_t > _pending;
+        /// @brief Number of steals.
+        std::atomic< size_t > _steals;
+        /// @brief Queue receiving the next task submitted from outside.
+        std::atomic< unsigned int > _next;
+        /// @brief True when the pool is destroyed.
+        bool _stopping;
+
+        /// @brief Function extracting a task, from the own queue first and
+        /// then from the other ones.
+        /// @param index The index of the worker.
+        /// @param task The extracted task.
+        /// @return True if a task was found.
+        bool _pop(unsigned int index, pool_task & task);
+
+        /// @brief Main loop of a worker.
+        /// @param index The index of the worker.
+        void _run(unsigned int index);
+    };
+
+}
@@ -15,10 +15,19 @@
 namespace chase
 {
 
-/// \todo Document it!!!
+/// @deprecated Use CombinationIterator, which enumerates the combinations
+/// lazily instead of materializing all of them.
+/// @brief Function computing all the combinations of a given size.
+/// @param elements The elements to combine.
+/// @param size The number of elements to consider.
+/// @param left The number of elements still to be selected.
+/// @param index The first element that can be selected.
+/// @param combination The elements already selected. They are prepended to
+/// each combination.
+/// @param results The list receiving the combinations.
 template< typename T >
 void getSubsetBySize(
-        std::vector< T > elements,
+        const std::vector< T > & elements,
         unsigned int size,
         unsigned int left,
         unsigned int index,
@@ -28,7 +37,7 @@ void getSubsetBySize(
 
     template<>
     void getSubsetBySize(
-            std::vector< std::string > elements,
+            const std::vector< std::string > & elements,
             unsigned int size,
             unsigned int left,
             unsigned int index,
@@ -8,6 +8,7 @@
 #pragma once
 #include "GuideVisitor.hh"
 #include "representation/LogicFormula.hh"
+#include "representation/DataDeclaration.hh"
 
 #include <map>
 
@@ -51,6 +52,14 @@ namespace chase
         /// to their usage.
         void _fixVarsCausality();
 
+        /// @brief Procedure recording the usage of a declaration.
+        /// @param d The declaration.
+        /// @param occurrences Number of identifiers referring to it.
+        /// @param inAssumptions True if they are in the assumptions, false if
+        /// they are in the guarantees.
+        void _markUsage(
+                DataDeclaration * d, size_t occurrences, bool inAssumptions);
+
 
 
     };
@@ -0,0 +1,195 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#pragma once
+
+#include "representation/Contract.hh"
+#include "representation/Graph.hh"
+#include "representation/LogicFormula.hh"
+#include "representation/System.hh"
+#include "representation/Variable.hh"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace chase {
+
+    /// @brief List of edges, as pairs of source and target indexes.
+    typedef std::vector< std::pair< unsigned int, unsigned int > >
+            edge_list;
+
+    /// @brief Structure of options for the generation of systems.
+    typedef struct workload_options {
+        /// @brief Number of contracts of the system.
+        unsigned int contracts;
+        /// @brief Number of variables of each contract.
+        unsigned int variables;
+        /// @brief Number of variables of the system. The variables of the
+        /// contracts are drawn from them, so that contracts share names.
+        /// 0 to use the number of variables of each contract.
+        unsigned int pool;
+        /// @brief Depth of each conjunct of the formulas.
+        unsigned int depth;
+        /// @brief Number of conjuncts of the formulas.
+        unsigned int width;
+        /// @brief Probability that an operator of a formula is temporal.
+        double temporal;
+        /// @brief Relative weights of the temporal operators: always,
+        /// eventually, next and until.
+        double always, eventually, next, until;
+        /// @brief Probability that a variable is an output.
+        double outputs;
+
+        /// @brief Constructor.
+        /// @param _contracts Set the contracts option.
+        /// @param _variables Set the variables option.
+        /// @param _depth Set the depth option.
+        /// @param _width Set the width option.
+        workload_options(
+                unsigned int _contracts = 4,
+                unsigned int _variables = 8,
+                unsigned int _depth = 3,
+                unsigned int _width = 2 );
+    } workload_options;
+
+    /// @brief Seeded generator of random inputs for benchmarks and tests:
+    /// formulas, contracts, systems and graphs. The generator uses its own
+    /// pseudo-random engine (xoshiro256**) and distributions, so that the
+    /// same seed gives the same inputs on every platform.
+    class WorkloadGenerator {
+    public:
+        /// @brief Constructor.
+        /// @param seed The seed.
+        explicit WorkloadGenerator(uint64_t seed = 0);
+
+        /// @brief Destructor.
+        ~WorkloadGenerator();
+
+        /// @brief Function resetting the state of the engine.
+        /// @param seed The seed.
+        void setSeed(uint64_t seed);
+
+        /// @brief Function drawing 64 random bits.
+        /// @return The random bits.
+        uint64_t next();
+
+        /// @brief Function drawing an integer uniformly in [0, bound).
+        /// @param bound The bound. It must be positive.
+        /// @return The random integer.
+        uint64_t uniform(uint64_t bound);
+
+        /// @brief Function drawing a real number uniformly in [0, 1).
+        /// @return The random number.
+        double uniformReal();
+
+        /// @brief Function generating a random string of alphanumeric
+        /// characters.
+        /// @param len The length of the random part.
+        /// @param prefix The prefix.
+        /// @param suffix The suffix.
+        /// @return The string.
+        std::string generateString(unsigned int len,
+                                   const std::string & prefix = "",
+                                   const std::string & suffix = "");
+
+        /// @brief Function generating a random formula.
+        /// @param variables The variables of the propositions.
+        /// @param depth The depth of each conjunct.
+        /// @param width The number of conjuncts.
+        /// @param options The mix of the operators.
+        /// @return The formula.
+        LogicFormula * generateFormula(
+                const std::vector< Variable * > & variables,
+                unsigned int depth, unsigned int width = 1,
+                const workload_options & options = workload_options());
+
+        /// @brief Function generating a random contract, whose variables
+        /// are named v0 ... v(pool - 1).
+        /// @param name The name of the contract.
+        /// @param options The options.
+        /// @return The contract.
+        Contract * generateContract(
+                const std::string & name,
+                const workload_options & options = workload_options());
+
+        /// @brief Function generating a random system of contracts. The
+        /// system declares all the variables of the pool.
+        /// @param options The options.
+        /// @return The system.
+        System * generateSystem(
+                const workload_options & options = workload_options());
+
+        /// @brief Function generating the edges of a scale-free graph by
+        /// preferential attachment (Barabasi-Albert): each new vertex is
+        /// connected to edgesPerVertex vertexes chosen with probability
+        /// proportional to their degree. It runs in linear time.
+        /// @param size The number of vertexes.
+        /// @param edgesPerVertex The number of edges of each new vertex.
+        /// @param edges The list receiving the edges.
+        void generatePowerLawEdges(unsigned int size,
+                                   unsigned int edgesPerVertex,
+                                   edge_list & edges);
+
+        /// @brief Function generating the edges of a grid, connecting each
+        /// vertex (r, c), of index r * columns + c, to the vertexes on its
+        /// right and below.
+        /// @param rows The number of rows.
+        /// @param columns The number of columns.
+        /// @param edges The list receiving the edges.
+        void generateGridEdges(unsigned int rows, unsigned int columns,
+                               edge_list & edges);
+
+        /// @brief Function generating a scale-free graph.
+        /// @param size The number of vertexes.
+        /// @param edgesPerVertex The number of edges of each new vertex.
+        /// @param directed True for a directed graph, with edges from the
+        /// new vertexes to the old ones.
+        /// @param named True to associate to each vertex a Vertex named
+        /// n<index>.
+        /// @return The graph.
+        Graph * generatePowerLawGraph(unsigned int size,
+                                      unsigned int edgesPerVertex,
+                                      bool directed = false,
+                                      bool named = true);
+
+        /// @brief Function generating a grid graph.
+        /// @param rows The number of rows.
+        /// @param columns The number of columns.
+        /// @param directed True for a directed graph.
+        /// @param named True to associate to each vertex a Vertex named
+        /// n<index>.
+        /// @return The graph.
+        Graph * generateGridGraph(unsigned int rows, unsigned int columns,
+                                  bool directed = false, bool named = true);
+
+        /// @brief Function building a graph from a list of edges.
+        /// @param size The number of vertexes.
+        /// @param edges The edges.
+        /// @param directed True for a directed graph.
+        /// @param named True to associate to each vertex a Vertex named
+        /// n<index>.
+        /// @return The graph.
+        static Graph * buildGraph(unsigned int size, const edge_list & edges,
+                                  bool directed, bool named);
+
+    protected:
+        /// @brief State of the engine.
+        uint64_t _state[4];
+
+        /// @brief Function generating a random subformula.
+        /// @param variables The variables of the propositions.
+        /// @param depth The depth.
+        /// @param options The mix of the operators.
+        /// @return The formula.
+        LogicFormula * _formula(const std::vector< Variable * > & variables,
+                                unsigned int depth,
+                                const workload_options & options);
+    };
+
+}
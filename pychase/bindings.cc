@@ -1,8 +1,12 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
 #include "chase-core.hh"
 
+#include <fstream>
+#include <sstream>
+
 namespace py = pybind11;
 using namespace chase;
 
@@ -843,6 +847,14 @@ PYBIND11_MODULE(pychase, k) {
             py::arg("size").none(false), 
             py::arg("directed")=false,
             py::arg("name")=new Name("GenericGraph"))
+        .def(py::init<unsigned int, std::vector<unsigned int>,
+            std::vector<unsigned int>, std::vector<double>, bool, Name *>(),
+            py::arg("size"),
+            py::arg("sources"),
+            py::arg("targets"),
+            py::arg("weights")=std::vector<double>(),
+            py::arg("directed")=false,
+            py::arg("name")=new Name("GenericGraph"))
         .def("accept_visitor", &Graph::accept_visitor,
             py::arg("v").none(false))
         .def("getString", &Graph::getString)
@@ -866,6 +878,19 @@ PYBIND11_MODULE(pychase, k) {
         .def("getGraphViz", &Graph::getGraphViz)
         .def("getAdjacentNodes", &Graph::getAdjacentNodes,
             py::arg("id").none(false))
+        .def("getIncidentEdges", &Graph::getIncidentEdges,
+            py::return_value_policy::reference,
+            py::arg("id"))
+        .def("getEdgesCount", &Graph::getEdgesCount)
+        .def("getEdgeAt", &Graph::getEdgeAt,
+            py::return_value_policy::reference,
+            py::arg("index"))
+        .def("getEdgeSource", &Graph::getEdgeSource, py::arg("index"))
+        .def("getEdgeTarget", &Graph::getEdgeTarget, py::arg("index"))
+        .def("getBulkEdgesCount", &Graph::getBulkEdgesCount)
+        .def("getBulkWeights", &Graph::getBulkWeights)
+        .def("getAdjacency", &Graph::getAdjacency,
+            py::return_value_policy::reference_internal)
         .def("clone", &Graph::clone);
 
     m.def("getSubGraph", &chase::getSubGraph,
@@ -898,6 +923,19 @@ PYBIND11_MODULE(pychase, k) {
             py::arg("v").none(false))
         .def("getString", &System::getString)
         .def("clone", &System::clone)
+        .def("lazyClone", &System::lazyClone,
+            py::return_value_policy::reference)
+        .def("isShared", &System::isShared,
+            py::arg("object").none(false))
+        .def("getMutableContract", &System::getMutableContract,
+            py::arg("contract").none(false),
+            py::return_value_policy::reference)
+        .def("getMutableComponent", &System::getMutableComponent,
+            py::arg("component").none(false),
+            py::return_value_policy::reference)
+        .def("getMutableDeclaration", &System::getMutableDeclaration,
+            py::arg("declaration").none(false),
+            py::return_value_policy::reference)
         .def("getName", &System::getName,
             py::return_value_policy::reference)
         .def("setName", &System::setName,
@@ -925,6 +963,16 @@ PYBIND11_MODULE(pychase, k) {
             py::arg("spec").none(false))
         .def("accept_visitor", &Contract::accept_visitor,
             py::arg("v").none(false))
+        .def("enableOccurrenceIndex", &Contract::enableOccurrenceIndex)
+        .def("disableOccurrenceIndex", &Contract::disableOccurrenceIndex)
+        .def("hasOccurrenceIndex", &Contract::hasOccurrenceIndex)
+        .def("getOccurrences", &Contract::getOccurrences,
+            py::return_value_policy::reference,
+            py::arg("declaration").none(false),
+            py::arg("inAssumptions"))
+        .def("renameOccurrences", &Contract::renameOccurrences,
+            py::arg("from").none(false),
+            py::arg("to").none(false))
         .def("getString", &Contract::getString)
         .def("clone", &Contract::clone)
         .def_static("saturate", &Contract::saturate,
@@ -1313,6 +1361,655 @@ PYBIND11_MODULE(pychase, k) {
             py::arg("contract").none(false))
         .def("visitIdentifier", &VarsCausalityVisitor::visitIdentifier,
             py::arg("identifier").none(false));
+
+    // LTL to Buchi automata translation.
+    py::class_<LtlFormulaTable, std::unique_ptr<LtlFormulaTable,
+        py::nodelete>>(u, "LtlFormulaTable")
+        .def(py::init<>())
+        .def("intern", &LtlFormulaTable::intern,
+            py::arg("formula").none(false),
+            py::arg("negated")=false)
+        .def("negate", &LtlFormulaTable::negate,
+            py::arg("id"))
+        .def("getSize", &LtlFormulaTable::getSize)
+        .def("getAtomsCount", &LtlFormulaTable::getAtomsCount)
+        .def("getAtomName", &LtlFormulaTable::getAtomName,
+            py::arg("atom"))
+        .def("getUntilsCount", &LtlFormulaTable::getUntilsCount)
+        .def("getString", &LtlFormulaTable::getString,
+            py::arg("id"));
+
+    py::class_<BuchiAutomaton, std::unique_ptr<BuchiAutomaton,
+        py::nodelete>>(u, "BuchiAutomaton")
+        .def(py::init<LogicFormula *, bool>(),
+            py::arg("formula").none(false),
+            py::arg("negated")=false)
+        .def("getInitialState", &BuchiAutomaton::getInitialState)
+        .def("explore", &BuchiAutomaton::explore)
+        .def("getStatesCount", &BuchiAutomaton::getStatesCount)
+        .def("getAcceptanceSetsCount",
+            &BuchiAutomaton::getAcceptanceSetsCount)
+        .def("getStateFormulas", &BuchiAutomaton::getStateFormulas,
+            py::arg("state"))
+        .def("isEmpty", &BuchiAutomaton::isEmpty)
+        .def("getTable", &BuchiAutomaton::getTable,
+            py::return_value_policy::reference)
+        .def("getString", &BuchiAutomaton::getString);
+
+    u.def("isSatisfiableLTL", &chase::isSatisfiableLTL,
+        py::arg("formula").none(false));
+    u.def("isValidLTL", &chase::isValidLTL,
+        py::arg("formula").none(false));
+    u.def("checkRefinementLTL", &chase::checkRefinementLTL,
+        py::arg("c1").none(false),
+        py::arg("c2").none(false),
+        py::arg("correspondences").none(false));
+
+    // Bytecode compilation of expressions.
+    py::class_<ExpressionProgram, std::unique_ptr<ExpressionProgram,
+        py::nodelete>>(u, "ExpressionProgram")
+        .def(py::init<>())
+        .def("addVariable", &ExpressionProgram::addVariable,
+            py::arg("declaration").none(false))
+        .def("compile", py::overload_cast<Expression *>(
+            &ExpressionProgram::compile),
+            py::arg("expression").none(false))
+        .def("compile", py::overload_cast<Constraint *>(
+            &ExpressionProgram::compile),
+            py::arg("constraint").none(false))
+        .def("evaluate", py::overload_cast<const std::vector<double> &>(
+            &ExpressionProgram::evaluate, py::const_),
+            py::arg("assignment"))
+        .def("evaluateBatch",
+            [](const ExpressionProgram & p,
+               const std::vector<std::vector<double>> & columns) {
+                size_t count = columns.empty() ? 0 : columns[0].size();
+                std::vector<const double *> ptrs;
+                for(const auto & c : columns)
+                {
+                    if(c.size() != count)
+                        throw py::value_error("columns of different sizes");
+                    ptrs.push_back(c.data());
+                }
+                std::vector<double> results(count);
+                p.evaluateBatch(ptrs, count, results.data());
+                return results;
+            },
+            py::arg("columns"))
+        .def("getVariables", &ExpressionProgram::getVariables,
+            py::return_value_policy::reference)
+        .def("getRegistersCount", &ExpressionProgram::getRegistersCount)
+        .def("getString", &ExpressionProgram::getString);
+
+    u.def("compileExpression", &chase::compileExpression,
+        py::arg("expression").none(false),
+        py::return_value_policy::reference);
+    u.def("compileConstraints", &chase::compileConstraints,
+        py::arg("constraints"),
+        py::return_value_policy::reference);
+
+    // Interval constraint propagation.
+    py::class_<interval_domain>(u, "interval_domain")
+        .def_readwrite("lower", &interval_domain::lower)
+        .def_readwrite("upper", &interval_domain::upper)
+        .def("isEmpty", &interval_domain::isEmpty);
+
+    py::class_<IntervalPropagator, std::unique_ptr<IntervalPropagator,
+        py::nodelete>>(u, "IntervalPropagator")
+        .def(py::init<>())
+        .def("addVariable", py::overload_cast<DataDeclaration *>(
+            &IntervalPropagator::addVariable),
+            py::arg("declaration").none(false))
+        .def("addVariable", py::overload_cast<DataDeclaration *, Value *>(
+            &IntervalPropagator::addVariable),
+            py::arg("declaration").none(false),
+            py::arg("domain").none(false))
+        .def("setDomain", &IntervalPropagator::setDomain,
+            py::arg("declaration").none(false),
+            py::arg("lower"),
+            py::arg("upper"))
+        .def("addConstraint", py::overload_cast<Constraint *>(
+            &IntervalPropagator::addConstraint),
+            py::arg("constraint").none(false))
+        .def("addConstraint", py::overload_cast<Expression *>(
+            &IntervalPropagator::addConstraint),
+            py::arg("expression").none(false))
+        .def("addContract", &IntervalPropagator::addContract,
+            py::arg("contract").none(false))
+        .def("propagate", &IntervalPropagator::propagate)
+        .def("isConsistent", &IntervalPropagator::isConsistent)
+        .def("getDomain", &IntervalPropagator::getDomain,
+            py::arg("declaration").none(false))
+        .def("getInterval", &IntervalPropagator::getInterval,
+            py::arg("declaration").none(false),
+            py::return_value_policy::reference)
+        .def("setPrecision", &IntervalPropagator::setPrecision,
+            py::arg("precision"))
+        .def("getRevisionsCount", &IntervalPropagator::getRevisionsCount)
+        .def("getString", &IntervalPropagator::getString);
+
+    // Linear arithmetic.
+    py::class_<Rational>(u, "Rational")
+        .def(py::init<int64_t, int64_t>(),
+            py::arg("numerator")=0,
+            py::arg("denominator")=1)
+        .def_static("fromDouble", &Rational::fromDouble,
+            py::arg("value"))
+        .def("getNumerator", &Rational::getNumerator)
+        .def("getDenominator", &Rational::getDenominator)
+        .def("toDouble", &Rational::toDouble)
+        .def("isInteger", &Rational::isInteger)
+        .def("getString", &Rational::getString)
+        .def("__float__", &Rational::toDouble)
+        .def("__str__", &Rational::getString)
+        .def("__eq__", [](const Rational & a, const Rational & b) {
+            return a == b; })
+        .def("__lt__", [](const Rational & a, const Rational & b) {
+            return a < b; });
+
+    py::enum_<chase::simplex_result>(u, "simplex_result")
+        .value("simplex_sat", chase::simplex_sat)
+        .value("simplex_unsat", chase::simplex_unsat)
+        .value("simplex_unknown", chase::simplex_unknown)
+        .export_values();
+
+    py::class_<SimplexSolver, std::unique_ptr<SimplexSolver,
+        py::nodelete>>(u, "SimplexSolver")
+        .def(py::init<>())
+        .def("addVariable", &SimplexSolver::addVariable,
+            py::arg("declaration").none(false))
+        .def("addConstraint", py::overload_cast<Constraint *>(
+            &SimplexSolver::addConstraint),
+            py::arg("constraint").none(false))
+        .def("addConstraint", py::overload_cast<Expression *>(
+            &SimplexSolver::addConstraint),
+            py::arg("expression").none(false))
+        .def("addContract", &SimplexSolver::addContract,
+            py::arg("contract").none(false))
+        .def("push", &SimplexSolver::push)
+        .def("pop", &SimplexSolver::pop)
+        .def("check", &SimplexSolver::check)
+        .def("getValue", &SimplexSolver::getValue,
+            py::arg("declaration").none(false))
+        .def("setFastPath", &SimplexSolver::setFastPath,
+            py::arg("enabled"))
+        .def("setBranchLimit", &SimplexSolver::setBranchLimit,
+            py::arg("limit"))
+        .def("getExactPivotsCount", &SimplexSolver::getExactPivotsCount)
+        .def("getString", &SimplexSolver::getString);
+
+    // Lazy combinations.
+    py::class_<CombinationIterator, std::unique_ptr<CombinationIterator,
+        py::nodelete>>(u, "CombinationIterator")
+        .def(py::init([](unsigned int n, unsigned int k,
+                uint64_t begin, uint64_t end,
+                std::function<bool(std::vector<unsigned int>)> filter) {
+                combination_filter f = nullptr;
+                if(filter)
+                    f = [filter](const unsigned int * indexes,
+                                 unsigned int size) {
+                        return filter(std::vector<unsigned int>(
+                                indexes, indexes + size));
+                    };
+                return new CombinationIterator(n, k, begin, end, f);
+            }),
+            py::arg("n"),
+            py::arg("k"),
+            py::arg("begin")=0,
+            py::arg("end")=std::numeric_limits<uint64_t>::max(),
+            py::arg("filter")=nullptr)
+        .def("isDone", &CombinationIterator::isDone)
+        .def("next", &CombinationIterator::next)
+        .def("getIndexes", &CombinationIterator::getIndexes)
+        .def("getRank", &CombinationIterator::getRank)
+        .def_static("binomial", &CombinationIterator::binomial,
+            py::arg("n"),
+            py::arg("k"))
+        .def_static("rank", &CombinationIterator::rank,
+            py::arg("n"),
+            py::arg("indexes"))
+        .def_static("unrank", [](unsigned int n, unsigned int k,
+                uint64_t rank) {
+                std::vector<unsigned int> indexes(k);
+                CombinationIterator::unrank(n, rank, indexes);
+                return indexes;
+            },
+            py::arg("n"),
+            py::arg("k"),
+            py::arg("rank"))
+        .def_static("nextMask", &CombinationIterator::nextMask,
+            py::arg("mask"));
+
+    // Design space exploration.
+    py::class_<ThreadPool, std::unique_ptr<ThreadPool, py::nodelete>>(
+        u, "ThreadPool")
+        .def(py::init<unsigned int>(),
+            py::arg("threads")=0)
+        .def("submit", &ThreadPool::submit,
+            py::arg("task"))
+        .def("wait", &ThreadPool::wait,
+            py::call_guard<py::gil_scoped_release>())
+        .def("getThreadsCount", &ThreadPool::getThreadsCount)
+        .def("getStealsCount", &ThreadPool::getStealsCount);
+
+    py::class_<exploration_result>(u, "ExplorationResult")
+        .def_readonly("components", &exploration_result::components)
+        .def_readonly("cost", &exploration_result::cost)
+        .def_readonly("contract", &exploration_result::contract);
+
+    py::class_<DesignExploration, std::unique_ptr<DesignExploration,
+        py::nodelete>>(u, "DesignExploration")
+        .def(py::init<DesignProblem *, std::string, unsigned int>(),
+            py::arg("problem").none(false),
+            py::arg("view")=std::string(),
+            py::arg("threads")=0)
+        .def("addSlot", &DesignExploration::addSlot,
+            py::arg("library").none(false),
+            py::arg("count")=1)
+        .def("setCostFunction", &DesignExploration::setCostFunction,
+            py::arg("cost"))
+        .def("setPruneDominated", &DesignExploration::setPruneDominated,
+            py::arg("enabled"))
+        .def("setFilter", &DesignExploration::setFilter,
+            py::arg("filter"))
+        .def("setChecker", &DesignExploration::setChecker,
+            py::arg("checker"))
+        .def("setMemoLimit", &DesignExploration::setMemoLimit,
+            py::arg("size"))
+        .def("start", &DesignExploration::start)
+        .def("next", [](DesignExploration & e) -> py::object {
+                exploration_result result;
+                bool found;
+                {
+                    py::gil_scoped_release release;
+                    found = e.next(result);
+                }
+                if(!found) return py::none();
+                return py::cast(result);
+            })
+        .def("stop", &DesignExploration::stop)
+        .def("wait", &DesignExploration::wait,
+            py::call_guard<py::gil_scoped_release>())
+        .def("run", [](DesignExploration & e,
+                std::function<void(exploration_result)> callback) {
+                py::gil_scoped_release release;
+                e.run([&callback](exploration_result & result) {
+                    callback(result);
+                });
+            },
+            py::arg("callback"))
+        .def("getVisitedCount", &DesignExploration::getVisitedCount)
+        .def("getPrunedCount", &DesignExploration::getPrunedCount)
+        .def("getMemoHitsCount", &DesignExploration::getMemoHitsCount)
+        .def("getFailedCount", &DesignExploration::getFailedCount);
+
+    // Diagnostics.
+    py::register_exception<ChaseError>(u, "ChaseError", PyExc_RuntimeError);
+
+    py::enum_<chase::message_severity>(u, "message_severity")
+        .value("severity_info", chase::severity_info)
+        .value("severity_warning", chase::severity_warning)
+        .value("severity_error", chase::severity_error)
+        .export_values();
+
+    py::class_<diagnostic_message>(u, "diagnostic_message")
+        .def_readonly("severity", &diagnostic_message::severity)
+        .def_readonly("text", &diagnostic_message::text)
+        .def_readonly("time", &diagnostic_message::time);
+
+    u.def("setDiagnosticSink", &setDiagnosticSink,
+        py::arg("sink"));
+    u.def("getDiagnosticsCount", &getDiagnosticsCount,
+        py::arg("severity"));
+    u.def("resetDiagnosticsCounters", &resetDiagnosticsCounters);
+
+    // Workload generation.
+    py::class_<workload_options>(u, "workload_options")
+        .def(py::init<unsigned int, unsigned int, unsigned int,
+                unsigned int>(),
+            py::arg("contracts")=4,
+            py::arg("variables")=8,
+            py::arg("depth")=3,
+            py::arg("width")=2)
+        .def_readwrite("contracts", &workload_options::contracts)
+        .def_readwrite("variables", &workload_options::variables)
+        .def_readwrite("pool", &workload_options::pool)
+        .def_readwrite("depth", &workload_options::depth)
+        .def_readwrite("width", &workload_options::width)
+        .def_readwrite("temporal", &workload_options::temporal)
+        .def_readwrite("always", &workload_options::always)
+        .def_readwrite("eventually", &workload_options::eventually)
+        .def_readwrite("next", &workload_options::next)
+        .def_readwrite("until", &workload_options::until)
+        .def_readwrite("outputs", &workload_options::outputs);
+
+    py::class_<WorkloadGenerator>(u, "WorkloadGenerator")
+        .def(py::init<uint64_t>(),
+            py::arg("seed")=0)
+        .def("setSeed", &WorkloadGenerator::setSeed,
+            py::arg("seed"))
+        .def("next", &WorkloadGenerator::next)
+        .def("uniform", &WorkloadGenerator::uniform,
+            py::arg("bound"))
+        .def("uniformReal", &WorkloadGenerator::uniformReal)
+        .def("generateString", &WorkloadGenerator::generateString,
+            py::arg("len"),
+            py::arg("prefix")="",
+            py::arg("suffix")="")
+        .def("generateContract", &WorkloadGenerator::generateContract,
+            py::arg("name"),
+            py::arg("options")=workload_options(),
+            py::return_value_policy::reference)
+        .def("generateSystem", &WorkloadGenerator::generateSystem,
+            py::arg("options")=workload_options(),
+            py::return_value_policy::reference)
+        .def("generatePowerLawEdges", [](WorkloadGenerator & g,
+                unsigned int size, unsigned int edgesPerVertex) {
+                edge_list edges;
+                g.generatePowerLawEdges(size, edgesPerVertex, edges);
+                return edges;
+            },
+            py::arg("size"),
+            py::arg("edgesPerVertex"))
+        .def("generateGridEdges", [](WorkloadGenerator & g,
+                unsigned int rows, unsigned int columns) {
+                edge_list edges;
+                g.generateGridEdges(rows, columns, edges);
+                return edges;
+            },
+            py::arg("rows"),
+            py::arg("columns"))
+        .def("generatePowerLawGraph", &WorkloadGenerator::generatePowerLawGraph,
+            py::arg("size"),
+            py::arg("edgesPerVertex"),
+            py::arg("directed")=false,
+            py::arg("named")=true,
+            py::return_value_policy::reference)
+        .def("generateGridGraph", &WorkloadGenerator::generateGridGraph,
+            py::arg("rows"),
+            py::arg("columns"),
+            py::arg("directed")=false,
+            py::arg("named")=true,
+            py::return_value_policy::reference)
+        .def_static("buildGraph", &WorkloadGenerator::buildGraph,
+            py::arg("size"),
+            py::arg("edges"),
+            py::arg("directed")=false,
+            py::arg("named")=true,
+            py::return_value_policy::reference);
+
+    // Statistics of the representation.
+    py::class_<ast_statistics>(u, "ast_statistics")
+        .def_readonly("nodes", &ast_statistics::nodes)
+        .def_readonly("total", &ast_statistics::total)
+        .def_readonly("leaves", &ast_statistics::leaves)
+        .def_readonly("max_depth", &ast_statistics::max_depth)
+        .def_readonly("average_depth", &ast_statistics::average_depth)
+        .def_readonly("shared", &ast_statistics::shared)
+        .def_readonly("unique_subtrees", &ast_statistics::unique_subtrees)
+        .def_readonly("bytes", &ast_statistics::bytes)
+        .def_readonly("names", &ast_statistics::names)
+        .def("getJSON", &getStatisticsJSON);
+
+    u.def("computeStatistics", &computeStatistics,
+        py::arg("root").none(false));
+    u.def("getStatisticsJSON", &getStatisticsJSON,
+        py::arg("statistics"));
+    u.def("getNodeTypeName", &getNodeTypeName,
+        py::arg("type"));
+
+    // Profiling.
+    py::class_<profile_entry>(u, "profile_entry")
+        .def_readonly("name", &profile_entry::name)
+        .def_readonly("calls", &profile_entry::calls)
+        .def_readonly("total", &profile_entry::total)
+        .def_readonly("self", &profile_entry::self);
+
+    u.def("setProfilingEnabled", &setProfilingEnabled,
+        py::arg("enabled"),
+        py::arg("trace")=false);
+    u.def("isProfilingEnabled", &isProfilingEnabled);
+    u.def("resetProfile", &resetProfile);
+    u.def("getProfileSummary", &getProfileSummary);
+    u.def("getProfileCounters", &getProfileCounters);
+    u.def("printProfileSummary", []() {
+            std::ostringstream out;
+            printProfileSummary(out);
+            py::print(out.str());
+        });
+    u.def("writeChromeTrace", [](const std::string & path) {
+            std::ofstream out(path);
+            if(!out) messageError("Cannot open file: " + path);
+            writeChromeTrace(out);
+        },
+        py::arg("path"));
+
+    // Graph views.
+    py::class_<compact_adjacency>(u, "compact_adjacency")
+        .def(py::init<>())
+        .def_readwrite("offsets", &compact_adjacency::offsets)
+        .def_readwrite("targets", &compact_adjacency::targets)
+        .def_readwrite("edges", &compact_adjacency::edges)
+        .def("getSize", &compact_adjacency::getSize);
+
+    py::class_<GraphView>(u, "GraphView")
+        .def(py::init<Graph *>(),
+            py::arg("graph").none(false),
+            py::keep_alive<1, 2>())
+        .def(py::init<Graph *, const std::vector<unsigned int> &>(),
+            py::arg("graph").none(false),
+            py::arg("nodes"),
+            py::keep_alive<1, 2>())
+        .def(py::init<Graph *, const std::set<Vertex *> &>(),
+            py::arg("graph").none(false),
+            py::arg("vertexes"),
+            py::keep_alive<1, 2>())
+        .def("getGraph", &GraphView::getGraph,
+            py::return_value_policy::reference)
+        .def("isDirected", &GraphView::isDirected)
+        .def("getSize", &GraphView::getSize)
+        .def("getNode", &GraphView::getNode, py::arg("local"))
+        .def("contains", &GraphView::contains, py::arg("node"))
+        .def("getLocalIndex", &GraphView::getLocalIndex, py::arg("node"))
+        .def("getNeighbors", &GraphView::getNeighbors, py::arg("local"))
+        .def("getAdjacency", &GraphView::getAdjacency)
+        .def("materialize", &GraphView::materialize);
+
+    // Reachability.
+    py::class_<ReachabilityIndex>(u, "ReachabilityIndex")
+        .def(py::init<Graph *, size_t, unsigned int>(),
+            py::arg("graph").none(false),
+            py::arg("maxMatrixBytes")=size_t(1) << 28,
+            py::arg("labelings")=3)
+        .def(py::init<const compact_adjacency &, size_t, unsigned int>(),
+            py::arg("adjacency"),
+            py::arg("maxMatrixBytes")=size_t(1) << 28,
+            py::arg("labelings")=3)
+        .def("reaches", &ReachabilityIndex::reaches,
+            py::arg("source"), py::arg("target"))
+        .def("getComponent", &ReachabilityIndex::getComponent,
+            py::arg("node"))
+        .def("getComponentsCount", &ReachabilityIndex::getComponentsCount)
+        .def("isDense", &ReachabilityIndex::isDense)
+        .def("getBytes", &ReachabilityIndex::getBytes);
+
+    // Strongly connected components and topological order.
+    py::enum_<chase::scc_algorithm>(u, "scc_algorithm")
+        .value("tarjan_scc", chase::tarjan_scc)
+        .value("kosaraju_scc", chase::kosaraju_scc)
+        .export_values();
+
+    u.def("getStronglyConnectedComponents",
+        [](const compact_adjacency &adjacency, scc_algorithm algorithm) {
+            std::vector<unsigned int> component;
+            unsigned int count = chase::getStronglyConnectedComponents(
+                adjacency, component, algorithm);
+            return py::make_tuple(count, component);
+        },
+        py::arg("adjacency"),
+        py::arg("algorithm")=chase::tarjan_scc);
+    u.def("getReverseAdjacency", &chase::getReverseAdjacency,
+        py::arg("adjacency"));
+    u.def("getCondensation", &chase::getCondensation,
+        py::arg("adjacency"), py::arg("component"), py::arg("count"));
+    u.def("getTopologicalOrder",
+        [](const compact_adjacency &adjacency) {
+            std::vector<unsigned int> order, cycle;
+            bool acyclic = chase::getTopologicalOrder(adjacency, order, cycle);
+            return py::make_tuple(acyclic, order, cycle);
+        },
+        py::arg("adjacency"));
+
+    // Shortest paths.
+    py::enum_<chase::dijkstra_heap>(u, "dijkstra_heap")
+        .value("binary_heap", chase::binary_heap)
+        .value("radix_heap", chase::radix_heap)
+        .export_values();
+
+    py::class_<shortest_paths>(u, "shortest_paths")
+        .def(py::init<>())
+        .def_readwrite("source", &shortest_paths::source)
+        .def_readwrite("distances", &shortest_paths::distances)
+        .def_readwrite("parents", &shortest_paths::parents)
+        .def_readwrite("edges", &shortest_paths::edges)
+        .def("getPath", &shortest_paths::getPath, py::arg("target"));
+
+    py::class_<weighted_path>(u, "weighted_path")
+        .def(py::init<>())
+        .def_readwrite("length", &weighted_path::length)
+        .def_readwrite("nodes", &weighted_path::nodes)
+        .def_readwrite("edges", &weighted_path::edges);
+
+    u.def("getEdgeWeights", &chase::getEdgeWeights,
+        py::arg("graph").none(false),
+        py::arg("unweighted")=1.0);
+    u.def("findShortestPaths", &chase::findShortestPaths,
+        py::arg("adjacency"), py::arg("weights"), py::arg("source"),
+        py::arg("heap")=chase::binary_heap);
+    u.def("findShortestPathsBellmanFord",
+        [](const compact_adjacency &adjacency,
+           const std::vector<double> &weights, unsigned int source) {
+            shortest_paths result;
+            bool valid = chase::findShortestPathsBellmanFord(
+                adjacency, weights, source, result);
+            return py::make_tuple(valid, result);
+        },
+        py::arg("adjacency"), py::arg("weights"), py::arg("source"));
+    u.def("findKShortestPaths", &chase::findKShortestPaths,
+        py::arg("adjacency"), py::arg("weights"), py::arg("source"),
+        py::arg("target"), py::arg("k"));
+    u.def("findShortestPathsFromSources",
+        &chase::findShortestPathsFromSources,
+        py::arg("adjacency"), py::arg("weights"), py::arg("sources"),
+        py::arg("pool"), py::arg("heap")=chase::binary_heap,
+        py::call_guard<py::gil_scoped_release>());
+
+    // Disjoint paths and minimum cuts.
+    py::class_<minimum_cut>(u, "minimum_cut")
+        .def(py::init<>())
+        .def_readwrite("sourceSide", &minimum_cut::sourceSide)
+        .def_readwrite("nodes", &minimum_cut::nodes)
+        .def_readwrite("edges", &minimum_cut::edges);
+
+    u.def("countEdgeDisjointPaths",
+        [](const compact_adjacency &adjacency, unsigned int source,
+           unsigned int target) {
+            minimum_cut cut;
+            unsigned int count = chase::countEdgeDisjointPaths(
+                adjacency, source, target, &cut);
+            return py::make_tuple(count, cut);
+        },
+        py::arg("adjacency"), py::arg("source"), py::arg("target"));
+    u.def("countVertexDisjointPaths",
+        [](const compact_adjacency &adjacency, unsigned int source,
+           unsigned int target) {
+            minimum_cut cut;
+            unsigned int count = chase::countVertexDisjointPaths(
+                adjacency, source, target, &cut);
+            return py::make_tuple(count, cut);
+        },
+        py::arg("adjacency"), py::arg("source"), py::arg("target"));
+
+    // Graph writers.
+    u.def("writeGraphViz",
+        [](Graph *graph, const std::string &path,
+           const std::vector<unsigned int> &clusters) {
+            std::ofstream out(path);
+            if(!out) messageError("Cannot open file: " + path);
+            writeGraphViz(graph, out, clusters.empty() ? nullptr : &clusters);
+        },
+        py::arg("graph").none(false), py::arg("path"),
+        py::arg("clusters")=std::vector<unsigned int>());
+    u.def("writeGraphML",
+        [](Graph *graph, const std::string &path,
+           const std::vector<unsigned int> &clusters) {
+            std::ofstream out(path);
+            if(!out) messageError("Cannot open file: " + path);
+            writeGraphML(graph, out, clusters.empty() ? nullptr : &clusters);
+        },
+        py::arg("graph").none(false), py::arg("path"),
+        py::arg("clusters")=std::vector<unsigned int>());
+
+    // Graph readers.
+    u.def("readEdgeList",
+        py::overload_cast<const std::string &, bool>(&chase::readEdgeList),
+        py::arg("path"), py::arg("directed")=false,
+        py::return_value_policy::reference);
+
+    // Breadth-first searches.
+    py::class_<BreadthFirstSearch>(u, "BreadthFirstSearch")
+        .def(py::init<Graph *, ThreadPool *>(),
+            py::arg("graph").none(false),
+            py::arg("pool")=nullptr,
+            py::keep_alive<1, 2>(), py::keep_alive<1, 3>())
+        .def(py::init<const compact_adjacency &, bool, ThreadPool *>(),
+            py::arg("adjacency"), py::arg("symmetric"),
+            py::arg("pool")=nullptr,
+            py::keep_alive<1, 2>(), py::keep_alive<1, 4>())
+        .def("getDistances",
+            py::overload_cast<unsigned int>(
+                &BreadthFirstSearch::getDistances, py::const_),
+            py::arg("source"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("getDistances",
+            py::overload_cast<const std::vector<unsigned int> &>(
+                &BreadthFirstSearch::getDistances, py::const_),
+            py::arg("sources"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("getReachedSets", &BreadthFirstSearch::getReachedSets,
+            py::arg("sources"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("getSize", &BreadthFirstSearch::getSize);
+
+    // Graph partitioning.
+    u.def("partitionGraph", &chase::partitionGraph,
+        py::arg("adjacency"), py::arg("weights")=std::vector<double>(),
+        py::arg("parts")=2, py::arg("imbalance")=0.03,
+        py::arg("nodeWeights")=std::vector<unsigned int>(),
+        py::arg("seed")=0,
+        py::call_guard<py::gil_scoped_release>());
+    u.def("getCutWeight", &chase::getCutWeight,
+        py::arg("adjacency"), py::arg("weights"), py::arg("partition"));
+
+    // Variable-interaction graphs of systems.
+    py::class_<interaction_graph>(u, "interaction_graph")
+        .def(py::init<>())
+        .def_readwrite("graph", &interaction_graph::graph,
+            py::return_value_policy::reference)
+        .def_readwrite("contracts", &interaction_graph::contracts)
+        .def_readwrite("shared", &interaction_graph::shared);
+    py::class_<system_partition>(u, "system_partition")
+        .def(py::init<>())
+        .def_readwrite("clusters", &system_partition::clusters)
+        .def_readwrite("interface", &system_partition::interface)
+        .def_readwrite("cut", &system_partition::cut);
+    u.def("buildInteractionGraph", &chase::buildInteractionGraph,
+        py::arg("system").none(false),
+        py::arg("correspondences")=system_correspondences());
+    u.def("partitionSystem", &chase::partitionSystem,
+        py::arg("system").none(false), py::arg("clusters"),
+        py::arg("correspondences")=system_correspondences(),
+        py::arg("imbalance")=0.03, py::arg("seed")=0);
     
 }
 
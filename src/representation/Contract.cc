@@ -8,9 +8,35 @@
 
 #include "representation/Contract.hh"
 #include "utilities/ClonedDeclarationVisitor.hh"
+#include "utilities/Profiler.hh"
 
 using namespace chase;
 
+namespace {
+
+    /// @brief Visitor collecting the identifiers of a tree.
+    class IdentifiersVisitor : public GuideVisitor {
+    public:
+        explicit IdentifiersVisitor(std::vector< Identifier * > & identifiers) :
+            GuideVisitor(1),
+            _identifiers(identifiers)
+        {
+        }
+
+        int visitIdentifier(Identifier & o) override
+        {
+            _identifiers.push_back(&o);
+            return 1;
+        }
+
+    protected:
+        std::vector< Identifier * > & _identifiers;
+    };
+
+    const std::vector< Identifier * > noOccurrences;
+
+}
+
 Contract::Contract( std::string name ) :
     _name(new Name(name))
 {
@@ -64,33 +90,37 @@ void Contract::setName(Name * name)
 void Contract::addAssumptions(semantic_domain domain, Specification *spec)
 {
     std::pair< semantic_domain, Specification * > a(domain, spec);
-    assumptions.insert(a);
+    bool inserted = assumptions.insert(a).second;
     spec->setParent(this);
+    if(inserted) _indexOccurrences(spec, true);
 }
 
 void Contract::addGuarantees(semantic_domain domain, Specification *spec)
 {
     std::pair< semantic_domain, Specification * > g(domain, spec);
-    guarantees.insert(g);
+    bool inserted = guarantees.insert(g).second;
     spec->setParent(this);
+    if(inserted) _indexOccurrences(spec, false);
 }
 
 
 
 /// \todo Implement the clone method.
 Contract *Contract::clone() {
+    CHASE_PROFILE_SCOPE("Contract::clone");
     auto ret = new Contract(_name->getString());
+    IdentifierRecorder recorder;
 
     // Corresponences maps.
-    std::map< Declaration *, Declaration * > declaration_map;
+    FlatPointerMap< Declaration, Declaration > declaration_map(
+            declarations.size());
 
     // Declarations.
     for(auto it : declarations )
     {
         auto dec = it->clone();
-        std::pair< Declaration *, Declaration * > p(it, dec);
         ret->addDeclaration(dec);
-        declaration_map.insert(p);
+        declaration_map.insert(it, dec);
     }
 
     // Assumptions.
@@ -107,19 +137,94 @@ Contract *Contract::clone() {
         ret->addGuarantees(guarantee.first, spec);
     }
 
-    ClonedDeclarationVisitor c(declaration_map);
-    ret->accept_visitor(c);
+    {
+        CHASE_PROFILE_SCOPE("ClonedDeclarationVisitor");
+        ClonedDeclarationVisitor c(declaration_map);
+        c.remap(recorder.getIdentifiers());
+    }
+    if(_occurrences != nullptr) ret->enableOccurrenceIndex();
 
     return ret;
 }
 
+void Contract::enableOccurrenceIndex()
+{
+    CHASE_PROFILE_SCOPE("Contract::enableOccurrenceIndex");
+    _occurrences.reset(new occurrence_index());
+    for(auto & assumption : assumptions)
+        _indexOccurrences(assumption.second, true);
+    for(auto & guarantee : guarantees)
+        _indexOccurrences(guarantee.second, false);
+}
 
+void Contract::disableOccurrenceIndex()
+{
+    _occurrences.reset();
+}
 
+bool Contract::hasOccurrenceIndex() const
+{
+    return _occurrences != nullptr;
+}
 
+const std::vector< Identifier * > & Contract::getOccurrences(
+        DataDeclaration * declaration, bool inAssumptions) const
+{
+    const occurrences_map & occurrences = inAssumptions ?
+            getOccurrenceIndex().assumptions : getOccurrenceIndex().guarantees;
+    auto found = occurrences.find(declaration);
+    if(found == occurrences.end()) return noOccurrences;
+    return found->second;
+}
 
+const occurrence_index & Contract::getOccurrenceIndex() const
+{
+    if(_occurrences == nullptr)
+        messageError("The occurrence index of the contract is not enabled: "
+                     + _name->getString());
+    return *_occurrences;
+}
 
+void Contract::renameOccurrences(DataDeclaration * from, DataDeclaration * to)
+{
+    if(_occurrences == nullptr)
+        messageError("The occurrence index of the contract is not enabled: "
+                     + _name->getString());
+    if(from == to) return;
 
+    for(auto occurrences : {&_occurrences->assumptions,
+                            &_occurrences->guarantees})
+    {
+        auto found = occurrences->find(from);
+        if(found == occurrences->end()) continue;
+        std::vector< Identifier * > moved;
+        moved.swap(found->second);
+        occurrences->erase(found);
+
+        for(auto identifier : moved) identifier->setDeclaration(to);
+        auto & target = (*occurrences)[to];
+        target.insert(target.end(), moved.begin(), moved.end());
+    }
+}
 
+void Contract::_indexOccurrences(
+        const std::vector< Identifier * > & identifiers, bool inAssumptions)
+{
+    if(_occurrences == nullptr) return;
+    occurrences_map & occurrences = inAssumptions ?
+            _occurrences->assumptions : _occurrences->guarantees;
+    for(auto identifier : identifiers)
+    {
+        if(identifier->getDeclaration() == nullptr) continue;
+        occurrences[identifier->getDeclaration()].push_back(identifier);
+    }
+}
 
-
-
+void Contract::_indexOccurrences(Specification * spec, bool inAssumptions)
+{
+    if(_occurrences == nullptr || spec == nullptr) return;
+    std::vector< Identifier * > identifiers;
+    IdentifiersVisitor v(identifiers);
+    spec->accept_visitor(v);
+    _indexOccurrences(identifiers, inAssumptions);
+}
@@ -9,6 +9,7 @@
 #include "representation/Contract.hh"
 #include "utilities/ClonedDeclarationVisitor.hh"
 #include "utilities/Factory.hh"
+#include "utilities/Profiler.hh"
 
 using namespace chase;
 
@@ -20,6 +21,9 @@ void Contract:: mergeDeclarations(
         std::map< Declaration *, Declaration * >& declaration_map
         )
 {
+    CHASE_PROFILE_SCOPE("Contract::mergeDeclarations");
+    CHASE_PROFILE_COUNT("Contract::mergeDeclarations::declarations",
+                        c1->declarations.size() + c2->declarations.size());
     /// \todo Implement the type checking.
 
     for(auto original : c1->declarations) {
@@ -67,7 +71,10 @@ Contract * Contract::composition(
         names_projection_map & correspondences,
         std::string name)
 {
+    CHASE_PROFILE_SCOPE("Contract::composition");
     auto composed = new Contract(name);
+    // Identifiers created from here on are the ones of the result.
+    IdentifierRecorder recorder;
 
     std::map< Declaration *, Declaration * > declaration_map;
     mergeDeclarations(c1, c2, composed, correspondences, declaration_map);
@@ -75,36 +82,30 @@ Contract * Contract::composition(
     // Fix variables causality.
     // If it is output in at least of the composing contracts, then it must be
     // output (i.e., controlled) variable.
-    for(auto & dit : composed->declarations)
+    // Every entry of the map links an original declaration to the one of the
+    // composed contract, hence a single pass over the map is enough.
+    for(auto & mit : declaration_map )
     {
-        if(dit->IsA() == variable_node)
+        if(mit.first->IsA() != variable_node ||
+           mit.second->IsA() != variable_node)
+            continue;
+        auto var = reinterpret_cast< Variable * >(mit.second);
+        auto original = reinterpret_cast< Variable * >(mit.first);
+        if(original->getCausality() == output && var->getCausality() == input)
         {
-            std::vector< Declaration * > originals;
-            for(auto & mit : declaration_map )
-            {
-                if(mit.second == dit)
-                    originals.push_back(mit.first);
-            }
-            for(auto & vit : originals)
-            {
-                if(vit->IsA() == variable_node)
-                {
-                    auto var = reinterpret_cast< Variable * >(dit);
-                    auto original =
-                            reinterpret_cast< Variable * >(vit);
-                    if(original->getCausality() == output && var->getCausality() == input)
-                    {
-                        var->setCausality(output);
-                    }
-                }
-            }
+            var->setCausality(output);
         }
     }
 
     composeLogic(c1, c2, composed);
 
-    ClonedDeclarationVisitor v(declaration_map);
-    composed->accept_visitor(v);
+    {
+        CHASE_PROFILE_SCOPE("ClonedDeclarationVisitor");
+        ClonedDeclarationVisitor v(declaration_map);
+        v.remap(recorder.getIdentifiers());
+    }
+    if(c1->hasOccurrenceIndex() || c2->hasOccurrenceIndex())
+        composed->enableOccurrenceIndex();
 
     return composed;
 }
@@ -114,6 +115,7 @@ void Contract::composeLogic(
         Contract * c2,
         Contract * r)
 {
+    CHASE_PROFILE_SCOPE("Contract::composeLogic");
     LogicFormula * a1 = nullptr;
     LogicFormula * a2 = nullptr;
     LogicFormula * g1 = nullptr;
@@ -180,15 +182,23 @@ Contract * Contract::conjunction(
         names_projection_map &correspondences,
         std::string name)
 {
+    CHASE_PROFILE_SCOPE("Contract::conjunction");
     auto res = new Contract(name);
+    // Identifiers created from here on are the ones of the result.
+    IdentifierRecorder recorder;
 
     std::map< Declaration *, Declaration * > declaration_map;
     mergeDeclarations(c1, c2, res, correspondences, declaration_map);
 
     conjoinLogic(c1, c2, res);
 
-    ClonedDeclarationVisitor v(declaration_map);
-    res->accept_visitor(v);
+    {
+        CHASE_PROFILE_SCOPE("ClonedDeclarationVisitor");
+        ClonedDeclarationVisitor v(declaration_map);
+        v.remap(recorder.getIdentifiers());
+    }
+    if(c1->hasOccurrenceIndex() || c2->hasOccurrenceIndex())
+        res->enableOccurrenceIndex();
 
     return res;
 }
@@ -198,6 +208,7 @@ Contract * Contract::conjunction(
 
 void Contract::conjoinLogic(Contract *c1, Contract *c2, Contract *r)
 {
+    CHASE_PROFILE_SCOPE("Contract::conjoinLogic");
     LogicFormula * a1 = nullptr;
     LogicFormula * a2 = nullptr;
     LogicFormula * g1 = nullptr;
@@ -266,7 +277,10 @@ Contract * Contract::quotient(
         names_projection_map &correspondences,
         std::string name, bool synthesizable)
 {
+    CHASE_PROFILE_SCOPE("Contract::quotient");
     auto res = new Contract(name);
+    // Identifiers created from here on are the ones of the result.
+    IdentifierRecorder recorder;
 
     std::map< Declaration *, Declaration * > declaration_map;
     mergeDeclarations(c1, c2, res,
@@ -274,8 +288,13 @@ Contract * Contract::quotient(
 
     quotientLogic(c1, c2, res, synthesizable);
 
-    ClonedDeclarationVisitor v(declaration_map);
-    res->accept_visitor(v);
+    {
+        CHASE_PROFILE_SCOPE("ClonedDeclarationVisitor");
+        ClonedDeclarationVisitor v(declaration_map);
+        v.remap(recorder.getIdentifiers());
+    }
+    if(c1->hasOccurrenceIndex() || c2->hasOccurrenceIndex())
+        res->enableOccurrenceIndex();
 
     return res;
 }
@@ -284,6 +303,7 @@ Contract * Contract::quotient(
 
 void Contract::quotientLogic(
         Contract *c1, Contract *c2, Contract *r, bool synthesizable) {
+    CHASE_PROFILE_SCOPE("Contract::quotientLogic");
     LogicFormula *a1 = nullptr;
     LogicFormula *a2 = nullptr;
     LogicFormula *g1 = nullptr;
@@ -321,9 +341,9 @@ void Contract::quotientLogic(
     else if (a1 == nullptr && g2 == nullptr)
         assumptions = True();
     else if (a1 == nullptr && g2 != nullptr)
-        assumptions = a1->clone();
-    else
         assumptions = g2->clone();
+    else
+        assumptions = a1->clone();
 
     if (a2 != nullptr && g1 != nullptr)
         guarantees = And(a2->clone(), g1->clone());
@@ -352,11 +372,13 @@ void Contract::quotientLogic(
 
 void Contract::saturate(Contract *c)
 {
+    CHASE_PROFILE_SCOPE("Contract::saturate");
     saturateLogic(c);
 }
 
 void Contract::saturateLogic(Contract * c )
 {
+    CHASE_PROFILE_SCOPE("Contract::saturateLogic");
     auto a = c->assumptions.find(logic);
     auto g = c->guarantees.find(logic);
 
@@ -377,32 +399,37 @@ void Contract::saturateLogic(Contract * c )
             messageError("Non logic formula in temporal logic domain");
     }
 
-    if(assumptions != nullptr ) {
-        guarantees = Or(Not(assumptions->clone()), guarantees);
-    }else{
+    if(assumptions == nullptr)
         return; // No saturation necessary.
-    }
+
+    // The identifiers of the negated assumptions join the guarantees.
+    IdentifierRecorder recorder;
+    auto negated = Not(assumptions->clone());
 
     if( guarantees == nullptr )
         // Then, create new guarantees negating the
         // assumptions.
     {
-        std::pair< semantic_domain, Specification * > p(
-                logic, Not(assumptions->clone()));
+        std::pair< semantic_domain, Specification * > p(logic, negated);
         c->guarantees.insert(p);
+        negated->setParent(c);
     }
     else
     {
-        auto parent = guarantees->getParent();
+        guarantees = Or(negated, guarantees);
         g->second = guarantees;
-        guarantees->setParent(parent);
+        guarantees->setParent(c);
     }
+    c->_indexOccurrences(recorder.getIdentifiers(), false);
 }
 
 
 Contract *Contract::refinementCheck(Contract *c1, Contract *c2, names_projection_map &correspondences,
                                std::string name) {
+    CHASE_PROFILE_SCOPE("Contract::refinementCheck");
     auto rcheck = new Contract(name);
+    // Identifiers created from here on are the ones of the result.
+    IdentifierRecorder recorder;
 
     std::map< Declaration *, Declaration * > declaration_map;
     mergeDeclarations(c1, c2, rcheck, correspondences, declaration_map);
@@ -411,13 +438,19 @@ Contract *Contract::refinementCheck(Contract *c1, Contract *c2, names_projection
 
     refinementCheckLogic(c1, c2, rcheck);
 
-    ClonedDeclarationVisitor v(declaration_map);
-    rcheck->accept_visitor(v);
+    {
+        CHASE_PROFILE_SCOPE("ClonedDeclarationVisitor");
+        ClonedDeclarationVisitor v(declaration_map);
+        v.remap(recorder.getIdentifiers());
+    }
+    if(c1->hasOccurrenceIndex() || c2->hasOccurrenceIndex())
+        rcheck->enableOccurrenceIndex();
 
     return rcheck;
 }
 
 void Contract::refinementCheckLogic(Contract *c1, Contract *c2, Contract *r) {
+    CHASE_PROFILE_SCOPE("Contract::refinementCheckLogic");
     LogicFormula * a1 = nullptr;
     LogicFormula * a2 = nullptr;
     LogicFormula * g1 = nullptr;
@@ -452,17 +485,16 @@ void Contract::refinementCheckLogic(Contract *c1, Contract *c2, Contract *r) {
     }
 
 
+    // The formulas of the inputs are cloned: the result must not share
+    // nodes with them, since building it re-parents the nodes and the
+    // declarations visitor rewrites its identifiers.
     /// \todo Reason about correctness in the case one is a nullptr.
-    if( a1 == nullptr )
-        a1 = True();
-    if( a2 == nullptr )
-        a2 = True();
+    a1 = a1 == nullptr ? True() : a1->clone();
+    a2 = a2 == nullptr ? True() : a2->clone();
     auto assumptions = Implies(a2, a1);
 
-    if( g1 == nullptr )
-        g1 = True();
-    if( g2 == nullptr )
-        g2 = True();
+    g1 = g1 == nullptr ? True() : g1->clone();
+    g2 = g2 == nullptr ? True() : g2->clone();
 
     g1 = Or(g1, Not(a1->clone()));
     g2 = Or(g2, Not(a2->clone()));
@@ -19,8 +19,6 @@ Expression::Expression() :
     _op2(nullptr)
 {
     _node_type = expression_node;
-    _op1->setParent(this);
-    _op2->setParent(this);
 }
 
 Expression::Expression(Operator op, Value *op1, Value *op2 ) :
@@ -30,8 +28,8 @@ Expression::Expression(Operator op, Value *op1, Value *op2 ) :
     _op2(op2)
 {
     _node_type = expression_node;
-    _op1->setParent(this);
-    _op2->setParent(this);
+    if(_op1 != nullptr) _op1->setParent(this);
+    if(_op2 != nullptr) _op2->setParent(this);
 }
 
 Expression::~Expression()
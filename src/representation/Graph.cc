@@ -6,7 +6,13 @@
  */
 
 #include "representation/Graph.hh"
+#include "representation/RealValue.hh"
+#include "utilities/GraphWriters.hh"
 #include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+
+#include <sstream>
+#include <utility>
 
 using namespace chase;
 
@@ -14,16 +20,60 @@ Graph::Graph( unsigned int size, bool directed, Name * name ) :
     _vertexes(size, nullptr), // Initialize the vertexes vector.
     _size(size),
     _directed(directed),
-    _name(name)
+    _name(name),
+    _incident(size),
+    _edgeList(),
+    _edgeSources(),
+    _edgeTargets(),
+    _bulkEdges(0),
+    _bulkWeights(),
+    _edgesMaterialized(true),
+    _edgesMutex(),
+    _adjacency(),
+    _adjacencyValid(false),
+    _adjacencyMutex()
 {
     _node_type = graph_node;
+}
 
-    // Initialize the adjacency matrix.
-    for (unsigned int i = 0; i < _size; ++i)
-        for (unsigned int j = 0; j < _size; ++j) {
-            AdjMatrixElement e(
-                    std::pair<unsigned int, unsigned int>(i,j), nullptr);
-        }
+Graph::Graph( unsigned int size,
+              std::vector< unsigned int > sources,
+              std::vector< unsigned int > targets,
+              std::vector< double > weights,
+              bool directed, Name * name ) :
+    _vertexes(size, nullptr),
+    _size(size),
+    _directed(directed),
+    _name(name),
+    _incident(),
+    _edgeList(),
+    _edgeSources(std::move(sources)),
+    _edgeTargets(std::move(targets)),
+    _bulkEdges(0),
+    _bulkWeights(std::move(weights)),
+    _edgesMaterialized(false),
+    _edgesMutex(),
+    _adjacency(),
+    _adjacencyValid(false),
+    _adjacencyMutex()
+{
+    _node_type = graph_node;
+    CHASE_PROFILE_SCOPE("Graph::bulkLoad");
+    if( _edgeSources.size() != _edgeTargets.size() )
+        messageError("Error creating the graph. Sources and targets differ.");
+    if( ! _bulkWeights.empty() && _bulkWeights.size() != _edgeSources.size() )
+        messageError("Error creating the graph. Weights and edges differ.");
+    for( size_t e = 0; e < _edgeSources.size(); ++e )
+    {
+        if( _edgeSources[e] >= _size || _edgeTargets[e] >= _size )
+            messageError("Error creating the graph. Edge out of size: " +
+                         std::to_string(e));
+    }
+    _bulkEdges = static_cast< unsigned int >(_edgeSources.size());
+    // The objects of the edges are created on request.
+    _edgeList.assign(_bulkEdges, nullptr);
+    _buildAdjacency();
+    _adjacencyValid.store(true, std::memory_order_release);
 }
 
 int Graph::accept_visitor(chase::BaseVisitor &v)
@@ -48,6 +98,7 @@ std::string Graph::getString() {
 
     // Print edges.
     ret += "Edges:\n";
+    _materializeEdges();
     std::set< Edge * >::iterator it;
     for( it = _edges.begin(); it != _edges.end(); ++it )
     {
@@ -62,31 +113,33 @@ std::string Graph::getString() {
 
 void Graph::associateVertex(unsigned int index, Vertex *vertex) {
     if(index < _size) {
+        if(_vertexes[index] != nullptr)
+            _unindexVertexName(_vertexes[index]->getName()->getString(), index);
         _vertexes[index] = vertex;
         vertex->setParent(this);
+        _indexVertexName(vertex->getName()->getString(), index);
     }
     else messageError("Error creating the graph. Index out of size.");
 
 }
 
 void Graph::addEdge(Edge *edge) {
-    _edges.insert(edge);
-    edge->setParent(this);
-
-    // Update the adjacency matrix.
     unsigned int s = edge->getSource();
     unsigned int t = edge->getTarget();
-    AdjMatrix::iterator it;
+    if(s >= _size || t >= _size)
+        messageError("Error creating the graph. Edge out of size.", edge);
 
-    // Find the entry in the matrix.
-    it = _matrix.find(std::pair<unsigned int, unsigned int>(s,t));
-    // Set the edge as the edge in the matrix.
-    if(it != _matrix.end()) it->second = edge;
+    _edgeList.push_back(edge);
+    _edgeSources.push_back(s);
+    _edgeTargets.push_back(t);
+    edge->setParent(this);
+    _adjacencyValid.store(false);
 
-    if( ! _directed ) {
-        it = _matrix.find(std::pair<unsigned int, unsigned int>(t, s));
-        if(it != _matrix.end()) it->second = edge;
-    }
+    // Without the objects of the bulk edges, the indexes are built later.
+    if( ! _edgesMaterialized.load() ) return;
+    _edges.insert(edge);
+    _incident[s].push_back(edge);
+    if( ! _directed && s != t ) _incident[t].push_back(edge);
 }
 
 bool Graph::isDirected() const {
@@ -94,16 +147,123 @@ bool Graph::isDirected() const {
 }
 
 Edge * Graph::getEdge(unsigned int source, unsigned int target) {
-
-    for(auto it = _edges.begin(); it != _edges.end(); ++it )
+    if( source >= _size ) return nullptr;
+    _materializeEdges();
+    for(auto edge : _incident[source])
     {
-        Edge * edge = *it;
         if(edge->getSource() == source && edge->getTarget() == target)
             return edge;
     }
     return nullptr;
 }
 
+const std::set< Edge * > & Graph::getEdges() const {
+    _materializeEdges();
+    return _edges;
+}
+
+unsigned int Graph::getEdgesCount() const {
+    return static_cast< unsigned int >(_edgeList.size());
+}
+
+Edge * Graph::getEdgeAt(unsigned int index) const {
+    if( index >= _edgeList.size() )
+        messageError("Edge out of the graph: " + std::to_string(index));
+    if( index < _bulkEdges ) _materializeEdges();
+    return _edgeList[index];
+}
+
+unsigned int Graph::getEdgeSource(unsigned int index) const {
+    if( index >= _edgeSources.size() )
+        messageError("Edge out of the graph: " + std::to_string(index));
+    return _edgeSources[index];
+}
+
+unsigned int Graph::getEdgeTarget(unsigned int index) const {
+    if( index >= _edgeTargets.size() )
+        messageError("Edge out of the graph: " + std::to_string(index));
+    return _edgeTargets[index];
+}
+
+unsigned int Graph::getBulkEdgesCount() const {
+    return _bulkEdges;
+}
+
+const std::vector< double > & Graph::getBulkWeights() const {
+    return _bulkWeights;
+}
+
+void Graph::_materializeEdges() const {
+    if( _edgesMaterialized.load(std::memory_order_acquire) ) return;
+    std::lock_guard< std::mutex > lock(_edgesMutex);
+    if( _edgesMaterialized.load(std::memory_order_relaxed) ) return;
+    CHASE_PROFILE_SCOPE("Graph::materializeEdges");
+
+    auto self = const_cast< Graph * >(this);
+    for( unsigned int e = 0; e < _bulkEdges; ++e )
+    {
+        Edge * edge;
+        if( _bulkWeights.empty() )
+            edge = new Edge(_edgeSources[e], _edgeTargets[e]);
+        else
+            edge = new WeightedEdge(_edgeSources[e], _edgeTargets[e],
+                                    new RealValue(_bulkWeights[e]));
+        edge->setParent(self);
+        _edgeList[e] = edge;
+    }
+
+    // The indexes of the edges, in insertion order.
+    _incident.assign(_size, std::vector< Edge * >());
+    for( auto edge : _edgeList )
+    {
+        unsigned int s = edge->getSource();
+        unsigned int t = edge->getTarget();
+        _edges.insert(edge);
+        _incident[s].push_back(edge);
+        if( ! _directed && s != t ) _incident[t].push_back(edge);
+    }
+    _edgesMaterialized.store(true, std::memory_order_release);
+}
+
+const compact_adjacency & Graph::getAdjacency() {
+    if( _adjacencyValid.load(std::memory_order_acquire) ) return _adjacency;
+    std::lock_guard< std::mutex > lock(_adjacencyMutex);
+    if( _adjacencyValid.load(std::memory_order_relaxed) ) return _adjacency;
+    _buildAdjacency();
+    _adjacencyValid.store(true, std::memory_order_release);
+    return _adjacency;
+}
+
+void Graph::_buildAdjacency() {
+    CHASE_PROFILE_SCOPE("Graph::getAdjacency");
+
+    // Counting sort of the edges by node.
+    std::vector< unsigned int > & offsets = _adjacency.offsets;
+    offsets.assign(_size + 1, 0);
+    auto edges = static_cast< unsigned int >(_edgeSources.size());
+    for( unsigned int e = 0; e < edges; ++e )
+    {
+        ++offsets[_edgeSources[e] + 1];
+        if( ! _directed && _edgeSources[e] != _edgeTargets[e] )
+            ++offsets[_edgeTargets[e] + 1];
+    }
+    for( unsigned int i = 0; i < _size; ++i ) offsets[i + 1] += offsets[i];
+
+    _adjacency.targets.resize(offsets[_size]);
+    _adjacency.edges.resize(offsets[_size]);
+    std::vector< unsigned int > next(offsets.begin(), offsets.end() - 1);
+    for( unsigned int e = 0; e < edges; ++e )
+    {
+        unsigned int s = _edgeSources[e];
+        unsigned int t = _edgeTargets[e];
+        _adjacency.targets[next[s]] = t;
+        _adjacency.edges[next[s]++] = e;
+        if( _directed || s == t ) continue;
+        _adjacency.targets[next[t]] = s;
+        _adjacency.edges[next[t]++] = e;
+    }
+}
+
 Vertex *Graph::getVertex(unsigned int vertex_id) {
     if( vertex_id >= _size ) return nullptr;
     return _vertexes[vertex_id];
@@ -118,35 +278,27 @@ void Graph::setName(Name *name) {
 }
 
 std::string Graph::getGraphViz() {
-    std::string ret;
-    if( _directed )
-        ret = "digraph ";
-    else
-        ret = "graph ";
-    ret += _name->getString() + "{\n";
-
-    std::set< Edge * >::iterator it;
-    for(it = _edges.begin(); it != _edges.end(); ++it)
-    {
-        Edge * e = *it;
-        unsigned int s = e->getSource();
-        unsigned int t = e->getTarget();
-        ret += "\t" + std::to_string(s);
-        if( _directed ) ret += "->";
-        else ret += "--";
-        ret += std::to_string(t) + ";\n";
-    }
-    ret += "}";
-
-    return ret;
+    std::ostringstream out;
+    writeGraphViz(this, out);
+    return out.str();
 }
 
 std::set<unsigned int> Graph::getAdjacentNodes(unsigned int id) {
     std::set< unsigned int> adjList;
+    if( id >= _size ) return adjList;
 
-    for(auto it = _edges.begin(); it != _edges.end(); ++it)
+    // Graphs loaded in bulk are read from the compact adjacency, to avoid
+    // creating the objects of the edges.
+    if( ! _edgesMaterialized.load(std::memory_order_acquire) )
+    {
+        const compact_adjacency & adjacency = getAdjacency();
+        adjList.insert(adjacency.targets.begin() + adjacency.offsets[id],
+                       adjacency.targets.begin() + adjacency.offsets[id + 1]);
+        return adjList;
+    }
+
+    for(auto edge : _incident[id])
     {
-        Edge * edge = *it;
         if(edge->getSource() == id)
             adjList.insert(edge->getTarget());
         if(! _directed && edge->getTarget() == id )
@@ -156,15 +308,56 @@ std::set<unsigned int> Graph::getAdjacentNodes(unsigned int id) {
     return adjList;
 }
 
-int Graph::getVertexIndex(std::string name)
+const std::vector< Edge * > & Graph::getIncidentEdges(unsigned int id) const
 {
+    if( id >= _size )
+        messageError("Node out of the graph: " + std::to_string(id));
+    _materializeEdges();
+    return _incident[id];
+}
 
-    for (size_t i = 0; i < _vertexes.size(); ++i)
+int Graph::getVertexIndex(const std::string & name)
+{
+    auto found = _vertexNames.find(name);
+    if( found == _vertexNames.end() ) return -1;
+    return static_cast< int >(found->second);
+}
+
+void Graph::_indexVertexName(const std::string & name, unsigned int index)
+{
+    auto inserted = _vertexNames.emplace(name, index);
+    if( inserted.second ) return;
+    // Keep the lowest index in the main index.
+    unsigned int & first = inserted.first->second;
+    if( index < first ) std::swap(index, first);
+    _duplicateNames.emplace(name, index);
+}
+
+void Graph::_unindexVertexName(const std::string & name, unsigned int index)
+{
+    auto range = _duplicateNames.equal_range(name);
+    auto found = _vertexNames.find(name);
+    if( found != _vertexNames.end() && found->second == index )
+    {
+        if( range.first == range.second )
+        {
+            _vertexNames.erase(found);
+            return;
+        }
+        // Promote the lowest of the other indexes.
+        auto lowest = range.first;
+        for( auto it = range.first; it != range.second; ++it )
+            if( it->second < lowest->second ) lowest = it;
+        found->second = lowest->second;
+        _duplicateNames.erase(lowest);
+        return;
+    }
+    for( auto it = range.first; it != range.second; ++it )
     {
-        if( name == _vertexes[i]->getName()->getString() )
-            return i;
+        if( it->second != index ) continue;
+        _duplicateNames.erase(it);
+        return;
     }
-    return -1;
 }
 
 unsigned int Graph::getSize() const {
@@ -175,21 +368,28 @@ Graph::~Graph() = default;
 
 
 Graph *Graph::clone() {
+    CHASE_PROFILE_SCOPE("Graph::clone");
     /// \todo Manage the graph copy with correspondences.
-    auto ret = new Graph(_size, _name->clone());
+    // The edges loaded in bulk are copied as arrays.
+    std::vector< unsigned int > sources(_edgeSources.begin(),
+                                        _edgeSources.begin() + _bulkEdges);
+    std::vector< unsigned int > targets(_edgeTargets.begin(),
+                                        _edgeTargets.begin() + _bulkEdges);
+    auto ret = _bulkEdges == 0 ?
+               new Graph(_size, _directed, _name->clone()) :
+               new Graph(_size, std::move(sources), std::move(targets),
+                         _bulkWeights, _directed, _name->clone());
 
     // Clone all the vertexes.
     for( size_t n = 0; n < _vertexes.size(); ++n )
     {
+        if( _vertexes[n] == nullptr ) continue;
         auto v = _vertexes[n]->clone();
         ret->associateVertex(n, v);
     }
 
-    for(auto v = _edges.begin(); v != _edges.end(); ++v )
-    {
-        auto edge = *v;
-        ret->addEdge(edge->clone());
-    }
+    for( unsigned int e = _bulkEdges; e < _edgeList.size(); ++e )
+        ret->addEdge(_edgeList[e]->clone());
 
     return ret;
 }
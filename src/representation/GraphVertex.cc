@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "representation/Graph.hh"
+#include "utilities/GraphWriters.hh"
 using namespace chase;
 
 Vertex::Vertex(Name *name) :
@@ -30,7 +31,28 @@ Name *Vertex::getName() const {
 }
 
 void Vertex::setName(std::string name) {
+    auto graph = dynamic_cast< Graph * >(getParent());
+    int index = -1;
+    if( graph != nullptr )
+    {
+        // Search the node of the vertex among the ones having its name.
+        const std::string & old = _name->getString();
+        index = graph->getVertexIndex(old);
+        if( index >= 0 && graph->getVertex(index) != this )
+        {
+            index = -1;
+            auto range = graph->_duplicateNames.equal_range(old);
+            for( auto it = range.first; it != range.second; ++it )
+                if( graph->getVertex(it->second) == this )
+                    index = static_cast< int >(it->second);
+        }
+        if( index >= 0 )
+            graph->_unindexVertexName(old, index);
+    }
+    delete _name;
     _name = new Name(std::move(name));
+    if( index >= 0 )
+        graph->_indexVertexName(_name->getString(), index);
 }
 
 int Vertex::accept_visitor(chase::BaseVisitor &v) {
@@ -43,7 +65,7 @@ std::string Vertex::getString() {
 
 
 std::string Vertex::getGraphViz() {
-    return std::string();
+    return "label=\"" + escapeGraphViz(_name->getString()) + "\"";
 }
 
 Vertex *Vertex::clone() {
@@ -11,33 +11,48 @@
 #include "representation/Identifier.hh"
 #include "utilities/IOUtils.hh"
 
+#include <iterator>
+
 using namespace chase;
 
+namespace {
+
+    thread_local IdentifierRecorder * currentRecorder = nullptr;
+
+}
+
 Identifier::Identifier( DataDeclaration * d, bool primed ) :
     Value(),
     _declaration(d),
-    _primed(primed)
+    _primed(primed),
+    _recorded(false)
 {
     _node_type = identifier_node;
     // ASSUMPTION: The declaration must already have a parent.
-    if(d->IsA() != variable_node && _primed)
+    if(d != nullptr && d->IsA() != variable_node && _primed)
         messageWarning("Primed identifier may refer only to variables.");
+    IdentifierRecorder::recordCreation(this);
 }
 
 Identifier::Identifier( const Identifier &i ) :
     Value(),
-    _declaration(i._declaration)
+    _declaration(i._declaration),
+    _primed(i._primed),
+    _recorded(false)
 {
     _node_type = identifier_node;
+    IdentifierRecorder::recordCreation(this);
 }
 
 Identifier::~Identifier()
 {
+    IdentifierRecorder::recordDeletion(this);
 }
 
 Identifier & Identifier::operator=( const Identifier &i )
 {
     _declaration = i._declaration;
+    _primed = i._primed;
     return *this;
 }
 
@@ -70,7 +85,7 @@ Type *Identifier::getType() {
 Identifier *Identifier::clone() {
     /// \todo Fix later in the clone method of Contract the potential
     /// inconsistencies due to cloned declarations.
-    return new Identifier(_declaration);
+    return new Identifier(*this);
 }
 
 bool Identifier::isPrimed() const {
@@ -81,3 +96,48 @@ void Identifier::setPrimed(bool primed) {
     _primed = primed;
 }
 
+IdentifierRecorder::IdentifierRecorder() :
+    _parent(currentRecorder),
+    _identifiers()
+{
+    currentRecorder = this;
+}
+
+IdentifierRecorder::~IdentifierRecorder()
+{
+    currentRecorder = _parent;
+    if(_parent != nullptr)
+        _parent->_identifiers.insert(_parent->_identifiers.end(),
+                                     _identifiers.begin(), _identifiers.end());
+    else
+        for(auto i : _identifiers) i->_recorded = false;
+}
+
+const std::vector< Identifier * > & IdentifierRecorder::getIdentifiers() const
+{
+    return _identifiers;
+}
+
+void IdentifierRecorder::recordCreation( Identifier * i )
+{
+    if(currentRecorder == nullptr) return;
+    currentRecorder->_identifiers.push_back(i);
+    i->_recorded = true;
+}
+
+void IdentifierRecorder::recordDeletion( Identifier * i )
+{
+    if(!i->_recorded) return;
+    // Deleted identifiers are usually the temporaries created last: the
+    // search starts from the end.
+    for(auto r = currentRecorder; r != nullptr; r = r->_parent)
+    {
+        auto & ids = r->_identifiers;
+        for(auto it = ids.rbegin(); it != ids.rend(); ++it)
+        {
+            if(*it != i) continue;
+            ids.erase(std::next(it).base());
+            return;
+        }
+    }
+}
@@ -32,7 +32,8 @@ IntegerValue::IntegerValue( const IntegerValue & o ) :
     NumericValue(),
     _value(o._value)
 {
-    _node_type = integer_node;
+    _node_type = integerValue_node;
+    setType(new Integer());
 }
 
 IntegerValue & IntegerValue::operator=( const IntegerValue &o )
@@ -5,26 +5,55 @@
  *
  */
 
+#include <algorithm>
 #include <utility>
 
 #include "representation/System.hh"
 #include "utilities/ClonedDeclarationVisitor.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
 
 using namespace chase;
 
+namespace {
+
+/// @brief Visitor checking whether an object refers to a declaration.
+class ReferenceVisitor : public GuideVisitor {
+public:
+  explicit ReferenceVisitor(Declaration *declaration)
+      : found(false), _declaration(declaration) {}
+
+  int visitIdentifier(Identifier &o) override {
+    if (o.getDeclaration() == _declaration)
+      found = true;
+    return 0;
+  }
+
+  bool found;
+
+protected:
+  Declaration *_declaration;
+};
+
+} // namespace
+
 System::System(std::string name) : Scope(std::move(name)) {
   _node_type = system_node;
 }
 
 System::~System() {
+  // Objects shared with other systems are deleted by the last holder.
   for (auto declaration : declarations) {
-    delete declaration;
+    if (_release(declaration))
+      delete declaration;
   }
   for (auto contract : _contracts) {
-    delete contract;
+    if (_release(contract))
+      delete contract;
   }
   for (auto component : _components) {
-    delete component;
+    if (_release(component))
+      delete component;
   }
 }
 
@@ -66,16 +95,19 @@ std::string System::getString() {
 }
 
 System *System::clone() {
+  CHASE_PROFILE_SCOPE("System::clone");
   auto ret = new System(_name->getString());
+  // Also the identifiers of the cloned contracts are recorded.
+  IdentifierRecorder recorder;
 
-  std::map<Declaration *, Declaration *> declaration_map;
+  FlatPointerMap<Declaration, Declaration> declaration_map(
+      declarations.size());
 
   for (auto it = declarations.begin(); it != declarations.end(); ++it) {
     Declaration *current = *it;
     auto dec = current->clone();
-    std::pair<Declaration *, Declaration *> p(current, dec);
     ret->addDeclaration(dec);
-    declaration_map.insert(p);
+    declaration_map.insert(current, dec);
   }
 
   for (auto it = _contracts.begin(); it != _contracts.end(); ++it) {
@@ -86,8 +118,11 @@ System *System::clone() {
     ret->addComponent((*it)->clone());
   }
 
-  ClonedDeclarationVisitor c(declaration_map);
-  ret->accept_visitor(c);
+  {
+    CHASE_PROFILE_SCOPE("ClonedDeclarationVisitor");
+    ClonedDeclarationVisitor c(declaration_map);
+    c.remap(recorder.getIdentifiers());
+  }
 
   return ret;
 }
@@ -98,3 +133,134 @@ void System::addComponent(Component *component) {
 }
 
 std::set<Component *> &System::getComponentsSet() { return _components; }
+
+System *System::lazyClone() {
+  CHASE_PROFILE_SCOPE("System::lazyClone");
+  if (_shared == nullptr)
+    _shared = std::make_shared<shared_objects>();
+
+  auto ret = new System(_name->getString());
+  ret->_shared = _shared;
+
+  std::lock_guard<std::mutex> lock(_shared->mutex);
+  for (auto declaration : declarations) {
+    _share(declaration, ret);
+    ret->declarations.push_back(declaration);
+  }
+  for (auto contract : _contracts) {
+    _share(contract, ret);
+    ret->_contracts.insert(contract);
+  }
+  for (auto component : _components) {
+    _share(component, ret);
+    ret->_components.insert(component);
+  }
+  return ret;
+}
+
+bool System::isShared(ChaseObject *object) { return _mustCopy(object); }
+
+Contract *System::getMutableContract(Contract *contract) {
+  if (_contracts.find(contract) == _contracts.end())
+    messageError("The contract is not in the system.", contract);
+
+  if (_mustCopy(contract)) {
+    CHASE_PROFILE_SCOPE("System::getMutableContract");
+    Contract *copy = contract->clone();
+    // Another system may have released the contract meanwhile.
+    if (!_release(contract)) {
+      _contracts.erase(contract);
+      addContract(copy);
+      return copy;
+    }
+    delete copy;
+  }
+  contract->setParent(this);
+  return contract;
+}
+
+Component *System::getMutableComponent(Component *component) {
+  if (_components.find(component) == _components.end())
+    messageError("The component is not in the system.", component);
+
+  if (_mustCopy(component)) {
+    Component *copy = component->clone();
+    if (!_release(component)) {
+      _components.erase(component);
+      addComponent(copy);
+      return copy;
+    }
+    delete copy;
+  }
+  component->setParent(this);
+  return component;
+}
+
+Declaration *System::getMutableDeclaration(Declaration *declaration) {
+  auto it = std::find(declarations.begin(), declarations.end(), declaration);
+  if (it == declarations.end())
+    messageError("The declaration is not in the system.", declaration);
+
+  if (_mustCopy(declaration)) {
+    Declaration *copy = declaration->clone();
+    if (!_release(declaration)) {
+      *it = copy;
+      copy->setParent(this);
+
+      // Redirect the identifiers of the contracts of this system.
+      std::vector<Contract *> referring;
+      for (auto contract : _contracts) {
+        ReferenceVisitor v(declaration);
+        contract->accept_visitor(v);
+        if (v.found)
+          referring.push_back(contract);
+      }
+      std::map<Declaration *, Declaration *> declaration_map;
+      declaration_map[declaration] = copy;
+      ClonedDeclarationVisitor c(declaration_map);
+      for (auto contract : referring)
+        getMutableContract(contract)->accept_visitor(c);
+      return copy;
+    }
+    delete copy;
+  }
+  declaration->setParent(this);
+  return declaration;
+}
+
+void System::_share(ChaseObject *object, System *system) {
+  // An object missing from the holders is held only by this system.
+  std::vector<System *> &holders = _shared->holders[object];
+  if (holders.empty())
+    holders.push_back(this);
+  holders.push_back(system);
+}
+
+bool System::_mustCopy(ChaseObject *object) {
+  if (_shared == nullptr)
+    return false;
+  std::lock_guard<std::mutex> lock(_shared->mutex);
+  auto it = _shared->holders.find(object);
+  return it != _shared->holders.end() && it->second.size() > 1;
+}
+
+bool System::_release(ChaseObject *object) {
+  if (_shared == nullptr)
+    return true;
+  std::lock_guard<std::mutex> lock(_shared->mutex);
+  auto it = _shared->holders.find(object);
+  if (it == _shared->holders.end())
+    return true;
+  std::vector<System *> &holders = it->second;
+  holders.erase(std::find(holders.begin(), holders.end(), this));
+  if (holders.empty()) {
+    _shared->holders.erase(it);
+    return true;
+  }
+  // The parent must outlive the object: it is moved to a remaining holder.
+  if (object->getParent() == this)
+    object->setParent(holders.front());
+  if (holders.size() == 1)
+    _shared->holders.erase(it);
+  return false;
+}
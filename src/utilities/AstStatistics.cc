@@ -0,0 +1,627 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/AstStatistics.hh"
+#include "representation.hh"
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace chase;
+
+namespace {
+
+    /// @brief Approximate sizes of the nodes of the standard containers.
+    const size_t list_node = 3 * sizeof(void *);
+    const size_t tree_node = 4 * sizeof(void *);
+
+    /// @brief Bytes of a string beyond the small-string buffer.
+    size_t stringBytes(const std::string & s)
+    {
+        return s.size() > 15 ? s.size() + 1 : 0;
+    }
+
+    template< typename T >
+    void pushList(const std::list< T * > & l,
+                  std::vector< ChaseObject * > & children)
+    {
+        for(auto o : l) children.push_back(o);
+    }
+
+    template< typename T >
+    void pushSet(const std::set< T * > & s,
+                 std::vector< ChaseObject * > & children)
+    {
+        for(auto o : s) children.push_back(o);
+    }
+
+    template< typename K, typename T >
+    void pushMap(const std::map< K, T * > & m,
+                 std::vector< ChaseObject * > & children)
+    {
+        for(auto & o : m) children.push_back(o.second);
+    }
+
+    /// @brief Function collecting the children of a node: the objects it
+    /// owns and the ones it references (e.g., the declaration of an
+    /// identifier).
+    void collectChildren(ChaseObject * o,
+                         std::vector< ChaseObject * > & children)
+    {
+        children.clear();
+        switch(o->IsA())
+        {
+            case system_node: {
+                auto s = static_cast< System * >(o);
+                children.push_back(s->getName());
+                pushList(s->declarations, children);
+                pushSet(s->getContractsSet(), children);
+                pushSet(s->getComponentsSet(), children);
+                break;
+            }
+            case design_problem_node: {
+                auto p = static_cast< DesignProblem * >(o);
+                children.push_back(p->getSystem());
+                pushSet(p->libraries, children);
+                pushSet(p->requirements, children);
+                break;
+            }
+            case contract_node: {
+                auto c = static_cast< Contract * >(o);
+                children.push_back(c->getName());
+                pushList(c->declarations, children);
+                pushMap(c->assumptions, children);
+                pushMap(c->guarantees, children);
+                break;
+            }
+            case library_node: {
+                auto l = static_cast< Library * >(o);
+                children.push_back(l->getName());
+                pushList(l->declarations, children);
+                break;
+            }
+            case componentDefinition_node: {
+                auto d = static_cast< ComponentDefinition * >(o);
+                children.push_back(d->getName());
+                pushList(d->declarations, children);
+                pushMap(d->views, children);
+                pushSet(d->subcomponents, children);
+                break;
+            }
+            case component_node: {
+                auto c = static_cast< Component * >(o);
+                children.push_back(c->getName());
+                auto definition = c->getDefinition();
+                children.push_back(definition);
+                if(definition == nullptr) break;
+                // Parameters are declared in the views of the definition.
+                for(auto & view : definition->views)
+                    for(auto d : view.second->declarations)
+                        if(d->IsA() == parameter_node)
+                            children.push_back(c->getParameterValue(
+                                    view.first,
+                                    d->getName()->getString()));
+                break;
+            }
+            case declaration_node:
+                children.push_back(static_cast< Declaration * >(o)
+                                           ->getName());
+                break;
+            case variable_node:
+            case parameter_node:
+            case dataDeclaration_node: {
+                auto d = static_cast< DataDeclaration * >(o);
+                children.push_back(d->getName());
+                children.push_back(d->getType());
+                auto f = dynamic_cast< Function * >(o);
+                if(f != nullptr)
+                    for(unsigned int i = 0; i < f->getArity(); ++i)
+                        children.push_back(f->getDomainOfParameter(i));
+                break;
+            }
+            case constant_node: {
+                auto c = static_cast< Constant * >(o);
+                children.push_back(c->getName());
+                children.push_back(c->getType());
+                children.push_back(c->getValue());
+                break;
+            }
+            case distribution_node: {
+                auto d = static_cast< Distribution * >(o);
+                children.push_back(d->getName());
+                children.push_back(d->getType());
+                pushMap(d->parameters, children);
+                break;
+            }
+            case enumeration_node: {
+                auto e = static_cast< Enumeration * >(o);
+                children.push_back(e->getName());
+                for(size_t i = 0; e->getItemInPosition(i) != nullptr; ++i)
+                    children.push_back(e->getItemInPosition(i));
+                break;
+            }
+            case customType_node: {
+                auto t = static_cast< CustomType * >(o);
+                children.push_back(t->getName());
+                children.push_back(t->getType());
+                break;
+            }
+            case integerValue_node:
+            case realValue_node:
+            case booleanValue_node:
+            case stringValue_node:
+                children.push_back(static_cast< Value * >(o)->getType());
+                break;
+            case expression_node: {
+                auto e = static_cast< Expression * >(o);
+                children.push_back(e->getOp1());
+                children.push_back(e->getOp2());
+                break;
+            }
+            case identifier_node:
+                children.push_back(static_cast< Identifier * >(o)
+                                           ->getDeclaration());
+                break;
+            case interval_node: {
+                auto i = static_cast< Interval * >(o);
+                children.push_back(i->getLeftBound());
+                children.push_back(i->getRightBound());
+                break;
+            }
+            case matrix_node: {
+                auto m = static_cast< Matrix * >(o);
+                for(unsigned int i = 1; i <= m->getRows(); ++i)
+                    for(unsigned int j = 1; j <= m->getColumns(); ++j)
+                        children.push_back(m->at(i, j));
+                break;
+            }
+            case functionCall_node: {
+                auto c = static_cast< FunctionCall * >(o);
+                children.push_back(c->getFunction());
+                if(c->getFunction() == nullptr) break;
+                for(unsigned int i = 0; i < c->getFunction()->getArity(); ++i)
+                    children.push_back(c->parameter(i));
+                break;
+            }
+            case probabilityFunction_node:
+                children.push_back(static_cast< ProbabilityFunction * >(o)
+                                           ->getSpecification());
+                break;
+            case constraint_node:
+                children.push_back(static_cast< Constraint * >(o)
+                                           ->getExpression());
+                break;
+            case proposition_node: {
+                auto p = static_cast< Proposition * >(o);
+                children.push_back(p->getName());
+                children.push_back(p->getType());
+                children.push_back(p->getValue());
+                break;
+            }
+            case unaryBooleanOperation_node:
+                children.push_back(static_cast< UnaryBooleanFormula * >(o)
+                                           ->getOp1());
+                break;
+            case binaryBooleanOperation_node: {
+                auto f = static_cast< BinaryBooleanFormula * >(o);
+                children.push_back(f->getOp1());
+                children.push_back(f->getOp2());
+                break;
+            }
+            case largeBooleanFormula_node:
+                for(auto f : static_cast< LargeBooleanFormula * >(o)->operands)
+                    children.push_back(f);
+                break;
+            case modalFormula_node:
+                children.push_back(static_cast< ModalFormula * >(o)
+                                           ->getFormula());
+                break;
+            case unaryTemporalOperation_node: {
+                auto f = static_cast< UnaryTemporalFormula * >(o);
+                children.push_back(f->getInterval());
+                children.push_back(f->getFormula());
+                break;
+            }
+            case binaryTemporalOperation_node: {
+                auto f = static_cast< BinaryTemporalFormula * >(o);
+                children.push_back(f->getInterval());
+                children.push_back(f->getFormula1());
+                children.push_back(f->getFormula2());
+                break;
+            }
+            case quantifiedFormula_node: {
+                auto f = static_cast< QuantifiedFormula * >(o);
+                children.push_back(f->getVariable());
+                children.push_back(f->getFormula());
+                break;
+            }
+            case graph_node: {
+                auto g = static_cast< Graph * >(o);
+                children.push_back(g->getName());
+                for(unsigned int i = 0; i < g->getSize(); ++i)
+                    children.push_back(g->getVertex(i));
+                pushSet(g->getEdges(), children);
+                break;
+            }
+            case graphVertex_node:
+                children.push_back(static_cast< Vertex * >(o)->getName());
+                break;
+            case graphEdge_node: {
+                auto w = dynamic_cast< WeightedEdge * >(o);
+                if(w != nullptr) children.push_back(w->getWeight());
+                break;
+            }
+            default:
+                break;
+        }
+        children.erase(std::remove(children.begin(), children.end(),
+                                   nullptr), children.end());
+    }
+
+    /// @brief Function estimating the bytes allocated for a node, with the
+    /// strings and the containers it owns.
+    size_t footprint(ChaseObject * o)
+    {
+        switch(o->IsA())
+        {
+            case system_node: {
+                auto s = static_cast< System * >(o);
+                return sizeof(System) +
+                       s->declarations.size() * list_node +
+                       s->getContractsSet().size() * tree_node +
+                       s->getComponentsSet().size() * tree_node;
+            }
+            case design_problem_node: {
+                auto p = static_cast< DesignProblem * >(o);
+                return sizeof(DesignProblem) +
+                       (p->libraries.size() + p->requirements.size()) *
+                       tree_node;
+            }
+            case contract_node: {
+                auto c = static_cast< Contract * >(o);
+                return sizeof(Contract) +
+                       c->declarations.size() * list_node +
+                       (c->assumptions.size() + c->guarantees.size()) *
+                       (tree_node + 2 * sizeof(void *));
+            }
+            case library_node:
+                return sizeof(Library) + static_cast< Library * >(o)
+                        ->declarations.size() * list_node;
+            case componentDefinition_node: {
+                auto d = static_cast< ComponentDefinition * >(o);
+                size_t bytes = sizeof(ComponentDefinition) +
+                               d->declarations.size() * list_node +
+                               d->subcomponents.size() * tree_node;
+                for(auto & v : d->views)
+                    bytes += tree_node + sizeof(v) + stringBytes(v.first);
+                return bytes;
+            }
+            case component_node: return sizeof(Component);
+            case declaration_node: return sizeof(Declaration);
+            case variable_node: return sizeof(Variable);
+            case parameter_node: return sizeof(Parameter);
+            case dataDeclaration_node: {
+                auto f = dynamic_cast< Function * >(o);
+                if(f == nullptr) return sizeof(DataDeclaration);
+                size_t bytes = sizeof(Function) +
+                               f->getArity() * sizeof(void *);
+                for(auto & p : f->parameters)
+                    bytes += sizeof(p) + stringBytes(p);
+                return bytes;
+            }
+            case constant_node: return sizeof(Constant);
+            case distribution_node: {
+                auto d = static_cast< Distribution * >(o);
+                size_t bytes = sizeof(Distribution);
+                for(auto & p : d->parameters)
+                    bytes += tree_node + sizeof(p) + stringBytes(p.first);
+                return bytes;
+            }
+            case enumeration_node: {
+                auto e = static_cast< Enumeration * >(o);
+                size_t bytes = sizeof(Enumeration);
+                for(size_t i = 0; e->getItemInPosition(i) != nullptr; ++i)
+                    bytes += sizeof(void *);
+                return bytes;
+            }
+            case customType_node: return sizeof(CustomType);
+            case integer_node: return sizeof(Integer);
+            case real_node: return sizeof(Real);
+            case boolean_node: return sizeof(Boolean);
+            case string_node: return sizeof(String);
+            case integerValue_node: return sizeof(IntegerValue);
+            case realValue_node: return sizeof(RealValue);
+            case booleanValue_node: return sizeof(BooleanValue);
+            case stringValue_node:
+                return sizeof(StringValue) + stringBytes(
+                        static_cast< StringValue * >(o)->getValue());
+            case expression_node: return sizeof(Expression);
+            case identifier_node: return sizeof(Identifier);
+            case range_node: return sizeof(Range);
+            case interval_node: return sizeof(Interval);
+            case matrix_node: {
+                auto m = static_cast< Matrix * >(o);
+                return sizeof(Matrix) +
+                       m->getRows() * m->getColumns() * sizeof(void *);
+            }
+            case functionCall_node: {
+                auto c = static_cast< FunctionCall * >(o);
+                size_t arity = c->getFunction() != nullptr ?
+                               c->getFunction()->getArity() : 0;
+                return sizeof(FunctionCall) + arity * sizeof(void *);
+            }
+            case probabilityFunction_node: return sizeof(ProbabilityFunction);
+            case constraint_node: return sizeof(Constraint);
+            case name_node:
+                return sizeof(Name) + stringBytes(o->getString());
+            case proposition_node: return sizeof(Proposition);
+            case booleanConstant_node: return sizeof(BooleanConstant);
+            case unaryBooleanOperation_node:
+                return sizeof(UnaryBooleanFormula);
+            case binaryBooleanOperation_node:
+                return sizeof(BinaryBooleanFormula);
+            case largeBooleanFormula_node:
+                return sizeof(LargeBooleanFormula) +
+                       static_cast< LargeBooleanFormula * >(o)
+                               ->operands.capacity() * sizeof(void *);
+            case modalFormula_node: return sizeof(ModalFormula);
+            case unaryTemporalOperation_node:
+                return sizeof(UnaryTemporalFormula);
+            case binaryTemporalOperation_node:
+                return sizeof(BinaryTemporalFormula);
+            case quantifiedFormula_node: return sizeof(QuantifiedFormula);
+            case graph_node: {
+                auto g = static_cast< Graph * >(o);
+                return sizeof(Graph) + g->getSize() * sizeof(void *) +
+                       g->getEdges().size() * tree_node;
+            }
+            case graphVertex_node: return sizeof(Vertex);
+            case graphEdge_node:
+                return dynamic_cast< WeightedEdge * >(o) != nullptr ?
+                       sizeof(WeightedEdge) : sizeof(Edge);
+            default:
+                return sizeof(ChaseObject);
+        }
+    }
+
+    size_t combine(size_t seed, size_t value)
+    {
+        return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) +
+                       (seed >> 2));
+    }
+
+    /// @brief Function hashing the content of a node, excluding its
+    /// children.
+    size_t localHash(ChaseObject * o)
+    {
+        size_t h = std::hash< int >()(o->IsA());
+        switch(o->IsA())
+        {
+            case name_node:
+                return combine(h, std::hash< std::string >()(o->getString()));
+            case stringValue_node:
+                return combine(h, std::hash< std::string >()(
+                        static_cast< StringValue * >(o)->getValue()));
+            case integerValue_node:
+                return combine(h, std::hash< int64_t >()(
+                        static_cast< IntegerValue * >(o)->getValue()));
+            case realValue_node:
+                return combine(h, std::hash< double >()(
+                        static_cast< RealValue * >(o)->getValue()));
+            case booleanValue_node:
+                return combine(h, static_cast< BooleanValue * >(o)
+                        ->getValue());
+            case booleanConstant_node:
+                return combine(h, static_cast< BooleanConstant * >(o)
+                        ->getValue());
+            case range_node: {
+                auto r = static_cast< Range * >(o);
+                h = combine(h, std::hash< int >()(r->getLeftValue()));
+                return combine(h, std::hash< int >()(r->getRightValue()));
+            }
+            case integer_node: {
+                auto t = static_cast< Integer * >(o);
+                h = combine(h, std::hash< int64_t >()(t->getMin()));
+                return combine(h, std::hash< int64_t >()(t->getMax()));
+            }
+            case real_node: {
+                auto t = static_cast< Real * >(o);
+                h = combine(h, std::hash< double >()(t->getMin()));
+                return combine(h, std::hash< double >()(t->getMax()));
+            }
+            case variable_node:
+                return combine(h, static_cast< Variable * >(o)
+                        ->getCausality());
+            case expression_node:
+                return combine(h, static_cast< Expression * >(o)
+                        ->getOperator());
+            case unaryBooleanOperation_node:
+                return combine(h, static_cast< UnaryBooleanFormula * >(o)
+                        ->getOp());
+            case binaryBooleanOperation_node:
+                return combine(h, static_cast< BinaryBooleanFormula * >(o)
+                        ->getOp());
+            case largeBooleanFormula_node:
+                return combine(h, static_cast< LargeBooleanFormula * >(o)
+                        ->getOp());
+            case modalFormula_node:
+                return combine(h, static_cast< ModalFormula * >(o)
+                        ->getOperator());
+            case unaryTemporalOperation_node:
+                return combine(h, static_cast< UnaryTemporalFormula * >(o)
+                        ->getOp());
+            case binaryTemporalOperation_node:
+                return combine(h, static_cast< BinaryTemporalFormula * >(o)
+                        ->getOp());
+            case quantifiedFormula_node:
+                return combine(h, static_cast< QuantifiedFormula * >(o)
+                        ->getQuantifier());
+            case graphEdge_node: {
+                auto e = static_cast< Edge * >(o);
+                h = combine(h, e->getSource());
+                return combine(h, e->getTarget());
+            }
+            default:
+                return h;
+        }
+    }
+
+    typedef struct node_info {
+        size_t hash;
+        unsigned int parents;
+        bool done;
+    } node_info;
+
+    typedef struct frame {
+        ChaseObject * object;
+        unsigned int depth;
+        bool expanded;
+    } frame;
+
+    const char * node_type_names[] = {
+        "object", "system", "design_problem", "specification", "contract",
+        "boolean", "booleanValue", "constant", "dataDeclaration",
+        "declaration", "componentDefinition", "component", "expression",
+        "identifier", "integer", "integerValue", "interval", "name",
+        "numericValue", "range", "real", "realValue", "string", "stringValue",
+        "simpleType", "customType", "enumeration", "type", "value", "matrix",
+        "variable", "parameter", "distribution", "proposition",
+        "unaryBooleanOperation", "binaryBooleanOperation", "booleanConstant",
+        "modalFormula", "largeBooleanFormula", "unaryTemporalOperation",
+        "binaryTemporalOperation", "quantifiedFormula", "graphEdge",
+        "graphVertex", "graph", "library", "functionCall",
+        "probabilityFunction", "relation", "constraint"
+    };
+    static_assert(sizeof(node_type_names) / sizeof(*node_type_names) ==
+                  constraint_node + 1, "Missing names of node types.");
+
+}
+
+ast_statistics::ast_statistics() :
+    nodes(),
+    total(0),
+    leaves(0),
+    max_depth(0),
+    average_depth(0),
+    shared(0),
+    unique_subtrees(0),
+    bytes(0),
+    names(0)
+{
+}
+
+ast_statistics chase::computeStatistics(ChaseObject * root)
+{
+    ast_statistics statistics;
+    if(root == nullptr) return statistics;
+
+    std::unordered_map< ChaseObject *, node_info > info;
+    std::unordered_set< size_t > subtrees;
+    std::unordered_set< std::string > names;
+    std::vector< ChaseObject * > children;
+    std::vector< frame > stack;
+    size_t depths = 0;
+
+    info.emplace(root, node_info{0, 0, false});
+    stack.push_back(frame{root, 0, false});
+
+    while(!stack.empty())
+    {
+        frame & top = stack.back();
+        ChaseObject * o = top.object;
+
+        if(!top.expanded)
+        {
+            // First visit: account the node and discover its children.
+            top.expanded = true;
+            unsigned int depth = top.depth;
+            ++statistics.nodes[o->IsA()];
+            ++statistics.total;
+            statistics.bytes += footprint(o);
+            if(depth > statistics.max_depth) statistics.max_depth = depth;
+            if(o->IsA() == name_node) names.insert(o->getString());
+
+            collectChildren(o, children);
+            if(children.empty())
+            {
+                ++statistics.leaves;
+                depths += depth;
+            }
+            for(auto it = children.rbegin(); it != children.rend(); ++it)
+            {
+                auto inserted = info.emplace(*it, node_info{0, 0, false});
+                if(++inserted.first->second.parents == 2)
+                    ++statistics.shared;
+                if(inserted.second)
+                    stack.push_back(frame{*it, depth + 1, false});
+            }
+            continue;
+        }
+
+        // Second visit: all the children are done, hash the subtree.
+        stack.pop_back();
+        collectChildren(o, children);
+        size_t h = localHash(o);
+        for(auto child : children)
+        {
+            node_info & c = info[child];
+            // A child still open is an ancestor: cut the cycle.
+            h = combine(h, c.done ? c.hash :
+                           std::hash< int >()(child->IsA()));
+        }
+        node_info & n = info[o];
+        n.hash = h;
+        n.done = true;
+        subtrees.insert(h);
+    }
+
+    statistics.unique_subtrees = subtrees.size();
+    statistics.names = names.size();
+    if(statistics.leaves > 0)
+        statistics.average_depth =
+                static_cast< double >(depths) / statistics.leaves;
+    return statistics;
+}
+
+std::string chase::getStatisticsJSON(const ast_statistics & statistics)
+{
+    std::ostringstream out;
+    out << "{\n";
+    out << "  \"total\": " << statistics.total << ",\n";
+    out << "  \"leaves\": " << statistics.leaves << ",\n";
+    out << "  \"max_depth\": " << statistics.max_depth << ",\n";
+    out << "  \"average_depth\": " << std::setprecision(6)
+        << statistics.average_depth << ",\n";
+    out << "  \"shared\": " << statistics.shared << ",\n";
+    out << "  \"unique_subtrees\": " << statistics.unique_subtrees << ",\n";
+    out << "  \"bytes\": " << statistics.bytes << ",\n";
+    out << "  \"names\": " << statistics.names << ",\n";
+    out << "  \"nodes\": {";
+    bool first = true;
+    for(auto & n : statistics.nodes)
+    {
+        out << (first ? "\n" : ",\n") << "    \""
+            << getNodeTypeName(n.first) << "\": " << n.second;
+        first = false;
+    }
+    out << (first ? "}\n" : "\n  }\n");
+    out << "}";
+    return out.str();
+}
+
+std::string chase::getNodeTypeName(nodeType type)
+{
+    const size_t count = sizeof(node_type_names) / sizeof(*node_type_names);
+    auto index = static_cast< size_t >(type);
+    if(index >= count) return "unknown";
+    return node_type_names[index];
+}
@@ -0,0 +1,416 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/BreadthFirstSearch.hh"
+#include "utilities/GraphUtilities.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+using namespace chase;
+
+namespace {
+
+    const unsigned int none = std::numeric_limits< unsigned int >::max();
+
+    /// @brief Switch to bottom-up when the edges of the frontier are more
+    /// than the unexplored edges divided by this factor.
+    const size_t topDownFactor = 14;
+    /// @brief Switch back to top-down when the frontier shrinks below the
+    /// nodes divided by this factor.
+    const size_t bottomUpFactor = 24;
+    /// @brief Minimum number of items of a task.
+    const size_t grain = 1024;
+
+    unsigned int countTasks( ThreadPool * pool, size_t items )
+    {
+        if( pool == nullptr || items <= grain ) return 1;
+        size_t tasks = std::min< size_t >((items + grain - 1) / grain,
+                                          4 * pool->getThreadsCount());
+        return static_cast< unsigned int >(tasks);
+    }
+
+    /// @brief Tasks submitted by a call of forEachRange. The state is
+    /// shared with the tasks, which may be dequeued after the call returns.
+    struct range_tasks {
+        explicit range_tasks( unsigned int count ) :
+            claimed(new std::atomic< bool >[count]),
+            left(count)
+        {
+            for( unsigned int t = 0; t < count; ++t ) claimed[t].store(false);
+        }
+
+        /// @brief Function running a task, unless it was already claimed.
+        template< typename F >
+        void run( unsigned int t, size_t begin, size_t end, F * f )
+        {
+            if( claimed[t].exchange(true) ) return;
+            // The task is completed even if f throws.
+            struct completion {
+                range_tasks & tasks;
+                ~completion()
+                {
+                    std::lock_guard< std::mutex > lock(tasks.mutex);
+                    if( --tasks.left == 0 ) tasks.done.notify_all();
+                }
+            } guard{*this};
+            (*f)(t, begin, end);
+        }
+
+        std::unique_ptr< std::atomic< bool >[] > claimed;
+        std::mutex mutex;
+        std::condition_variable done;
+        unsigned int left;
+    };
+
+    /// @brief Function calling f(task, begin, end) on consecutive ranges of
+    /// items, one for each task, in the pool if any. The caller runs the
+    /// tasks not yet started by the workers, and then waits only for the
+    /// ones they are running, so that it never waits for other tasks of the
+    /// pool and can itself be a task of the pool.
+    template< typename F >
+    void forEachRange( ThreadPool * pool, unsigned int tasks, size_t items,
+                       F f )
+    {
+        if( tasks == 1 )
+        {
+            f(0, 0, items);
+            return;
+        }
+        size_t chunk = (items + tasks - 1) / tasks;
+        auto state = std::make_shared< range_tasks >(tasks);
+        F * body = &f;
+        for( unsigned int t = 1; t < tasks; ++t )
+        {
+            size_t begin = std::min(items, t * chunk);
+            size_t end = std::min(items, begin + chunk);
+            pool->submit([state, body, t, begin, end] {
+                state->run(t, begin, end, body);
+            });
+        }
+        // The workers may be using f until all the tasks are completed.
+        std::exception_ptr error;
+        for( unsigned int t = 0; t < tasks; ++t )
+        {
+            size_t begin = std::min(items, t * chunk);
+            size_t end = std::min(items, begin + chunk);
+            try
+            {
+                state->run(t, begin, end, body);
+            }
+            catch( ... )
+            {
+                if( ! error ) error = std::current_exception();
+            }
+        }
+        std::unique_lock< std::mutex > lock(state->mutex);
+        state->done.wait(lock, [&state] { return state->left == 0; });
+        if( error ) std::rethrow_exception(error);
+    }
+
+    unsigned int degree( const compact_adjacency & adjacency, unsigned int v )
+    {
+        return adjacency.offsets[v + 1] - adjacency.offsets[v];
+    }
+
+}
+
+BreadthFirstSearch::BreadthFirstSearch( Graph * graph, ThreadPool * pool ) :
+    _adjacency(&graph->getAdjacency()),
+    _reverse(),
+    _predecessors(_adjacency),
+    _pool(pool)
+{
+    if( graph->isDirected() )
+    {
+        _reverse = getReverseAdjacency(*_adjacency);
+        _predecessors = &_reverse;
+    }
+}
+
+BreadthFirstSearch::BreadthFirstSearch( const compact_adjacency & adjacency,
+                                        bool symmetric, ThreadPool * pool ) :
+    _adjacency(&adjacency),
+    _reverse(),
+    _predecessors(_adjacency),
+    _pool(pool)
+{
+    if( ! symmetric )
+    {
+        _reverse = getReverseAdjacency(adjacency);
+        _predecessors = &_reverse;
+    }
+}
+
+unsigned int BreadthFirstSearch::getSize() const
+{
+    return _adjacency->getSize();
+}
+
+std::vector< unsigned int >
+BreadthFirstSearch::getDistances( unsigned int source ) const
+{
+    CHASE_PROFILE_SCOPE("BreadthFirstSearch::getDistances");
+    _checkSources(std::vector< unsigned int >(1, source));
+    const compact_adjacency & adjacency = *_adjacency;
+    const compact_adjacency & predecessors = *_predecessors;
+    unsigned int size = getSize();
+    size_t words = (size + 63) / 64;
+
+    std::vector< unsigned int > distances(size, none);
+    // Visited nodes, claimed atomically by the top-down steps.
+    std::unique_ptr< std::atomic< uint64_t >[] > visited(
+            new std::atomic< uint64_t >[words]);
+    for( size_t w = 0; w < words; ++w ) visited[w].store(0);
+
+    distances[source] = 0;
+    visited[source / 64].store(uint64_t(1) << (source % 64));
+    std::vector< unsigned int > frontier(1, source);
+    size_t frontierEdges = degree(adjacency, source);
+    size_t unexplored = adjacency.targets.size();
+    unsigned int level = 0;
+    size_t bottomUpSteps = 0;
+
+    while( ! frontier.empty() )
+    {
+        if( frontierEdges > unexplored / topDownFactor )
+        {
+            // Bottom-up steps, on bitsets of the frontier. Every task owns a
+            // range of words, and writes only the nodes in it.
+            std::vector< uint64_t > current(words, 0);
+            std::vector< uint64_t > next(words, 0);
+            for( auto v : frontier )
+                current[v / 64] |= uint64_t(1) << (v % 64);
+            size_t awake = frontier.size();
+            size_t previous;
+            unsigned int tasks = countTasks(_pool, words * 64);
+            std::vector< size_t > counts(tasks);
+            do {
+                previous = awake;
+                std::fill(counts.begin(), counts.end(), 0);
+                forEachRange(_pool, tasks, words,
+                             [&](unsigned int t, size_t begin, size_t end) {
+                    for( size_t w = begin; w < end; ++w )
+                    {
+                        uint64_t found = 0;
+                        size_t last = std::min< size_t >(size, 64 * w + 64);
+                        for( auto v = static_cast< unsigned int >(64 * w);
+                             v < last; ++v )
+                        {
+                            if( distances[v] != none ) continue;
+                            for( unsigned int i = predecessors.offsets[v];
+                                 i < predecessors.offsets[v + 1]; ++i )
+                            {
+                                unsigned int u = predecessors.targets[i];
+                                if( current[u / 64] & (uint64_t(1) << (u % 64)) )
+                                {
+                                    distances[v] = level + 1;
+                                    found |= uint64_t(1) << (v % 64);
+                                    break;
+                                }
+                            }
+                        }
+                        next[w] = found;
+                        visited[w].fetch_or(found);
+                        counts[t] += static_cast< size_t >(
+                                __builtin_popcountll(found));
+                    }
+                });
+                awake = 0;
+                for( auto c : counts ) awake += c;
+                current.swap(next);
+                ++level;
+                ++bottomUpSteps;
+            } while( awake != 0 &&
+                     (awake >= previous || awake > size / bottomUpFactor) );
+
+            frontier.clear();
+            frontierEdges = 0;
+            for( size_t w = 0; w < words; ++w )
+            {
+                for( uint64_t bits = current[w]; bits != 0; bits &= bits - 1 )
+                {
+                    auto v = static_cast< unsigned int >(
+                            64 * w + __builtin_ctzll(bits));
+                    frontier.push_back(v);
+                    frontierEdges += degree(adjacency, v);
+                }
+            }
+            continue;
+        }
+
+        // Top-down step: every task expands a range of the frontier, and
+        // claims the new nodes on the visited bitset.
+        unexplored -= std::min(unexplored, frontierEdges);
+        unsigned int tasks = countTasks(_pool, frontier.size());
+        std::vector< std::vector< unsigned int > > found(tasks);
+        std::vector< size_t > edges(tasks, 0);
+        forEachRange(_pool, tasks, frontier.size(),
+                     [&](unsigned int t, size_t begin, size_t end) {
+            for( size_t f = begin; f < end; ++f )
+            {
+                unsigned int v = frontier[f];
+                for( unsigned int i = adjacency.offsets[v];
+                     i < adjacency.offsets[v + 1]; ++i )
+                {
+                    unsigned int w = adjacency.targets[i];
+                    uint64_t bit = uint64_t(1) << (w % 64);
+                    if( visited[w / 64].load(std::memory_order_relaxed) & bit )
+                        continue;
+                    if( visited[w / 64].fetch_or(bit) & bit ) continue;
+                    distances[w] = level + 1;
+                    found[t].push_back(w);
+                    edges[t] += degree(adjacency, w);
+                }
+            }
+        });
+        frontier.clear();
+        frontierEdges = 0;
+        for( unsigned int t = 0; t < tasks; ++t )
+        {
+            frontier.insert(frontier.end(), found[t].begin(), found[t].end());
+            frontierEdges += edges[t];
+        }
+        ++level;
+    }
+    CHASE_PROFILE_COUNT("BreadthFirstSearch::bottomUpSteps", bottomUpSteps);
+    return distances;
+}
+
+template< typename F >
+void BreadthFirstSearch::_searchBatch( const unsigned int * sources,
+                                       unsigned int count, F visit ) const
+{
+    const compact_adjacency & adjacency = *_adjacency;
+    unsigned int size = getSize();
+    // Bits of the sources that reached each node, that reached it at the
+    // last level, and that reach it at the next one.
+    std::vector< uint64_t > seen(size, 0);
+    std::vector< uint64_t > current(size, 0);
+    std::vector< uint64_t > next(size, 0);
+    std::vector< unsigned int > active;
+    std::vector< unsigned int > reached;
+
+    for( unsigned int j = 0; j < count; ++j )
+    {
+        unsigned int s = sources[j];
+        if( current[s] == 0 ) active.push_back(s);
+        current[s] |= uint64_t(1) << j;
+    }
+    for( auto s : active )
+    {
+        seen[s] = current[s];
+        visit(s, current[s], 0u);
+    }
+
+    for( unsigned int level = 1; ! active.empty(); ++level )
+    {
+        reached.clear();
+        for( auto v : active )
+        {
+            uint64_t bits = current[v];
+            for( unsigned int i = adjacency.offsets[v];
+                 i < adjacency.offsets[v + 1]; ++i )
+            {
+                unsigned int w = adjacency.targets[i];
+                uint64_t fresh = bits & ~seen[w];
+                if( fresh == 0 ) continue;
+                if( next[w] == 0 ) reached.push_back(w);
+                next[w] |= fresh;
+                seen[w] |= fresh;
+            }
+        }
+        for( auto v : active ) current[v] = 0;
+        for( auto w : reached )
+        {
+            visit(w, next[w], level);
+            current[w] = next[w];
+            next[w] = 0;
+        }
+        active.swap(reached);
+    }
+}
+
+std::vector< unsigned int > BreadthFirstSearch::getDistances(
+        const std::vector< unsigned int > & sources ) const
+{
+    CHASE_PROFILE_SCOPE("BreadthFirstSearch::getMultiSourceDistances");
+    _checkSources(sources);
+    size_t size = getSize();
+    std::vector< unsigned int > distances(sources.size() * size, none);
+    size_t batches = (sources.size() + 63) / 64;
+    unsigned int tasks = _pool == nullptr ? 1 : static_cast< unsigned int >(
+            std::max< size_t >(batches, 1));
+
+    // Every batch writes only the rows of its own sources.
+    forEachRange(_pool, tasks, batches,
+                 [&](unsigned int, size_t begin, size_t end) {
+        for( size_t b = begin; b < end; ++b )
+        {
+            size_t first = 64 * b;
+            auto count = static_cast< unsigned int >(
+                    std::min< size_t >(64, sources.size() - first));
+            _searchBatch(&sources[first], count,
+                         [&](unsigned int v, uint64_t bits,
+                             unsigned int distance) {
+                for( ; bits != 0; bits &= bits - 1 )
+                {
+                    size_t j = first + __builtin_ctzll(bits);
+                    distances[j * size + v] = distance;
+                }
+            });
+        }
+    });
+    return distances;
+}
+
+std::vector< uint64_t > BreadthFirstSearch::getReachedSets(
+        const std::vector< unsigned int > & sources ) const
+{
+    CHASE_PROFILE_SCOPE("BreadthFirstSearch::getReachedSets");
+    _checkSources(sources);
+    size_t size = getSize();
+    size_t batches = (sources.size() + 63) / 64;
+    std::vector< uint64_t > reached(batches * size, 0);
+    unsigned int tasks = _pool == nullptr ? 1 : static_cast< unsigned int >(
+            std::max< size_t >(batches, 1));
+
+    forEachRange(_pool, tasks, batches,
+                 [&](unsigned int, size_t begin, size_t end) {
+        for( size_t b = begin; b < end; ++b )
+        {
+            size_t first = 64 * b;
+            auto count = static_cast< unsigned int >(
+                    std::min< size_t >(64, sources.size() - first));
+            uint64_t * row = &reached[b * size];
+            _searchBatch(&sources[first], count,
+                         [row](unsigned int v, uint64_t bits, unsigned int) {
+                row[v] |= bits;
+            });
+        }
+    });
+    return reached;
+}
+
+void BreadthFirstSearch::_checkSources(
+        const std::vector< unsigned int > & sources ) const
+{
+    // Checked before the tasks, whose exceptions would only be reported as
+    // warnings.
+    for( auto source : sources )
+    {
+        if( source >= getSize() )
+            messageError("Node out of the graph: " + std::to_string(source));
+    }
+}
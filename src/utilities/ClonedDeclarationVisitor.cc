@@ -7,21 +7,66 @@
 
 #include "utilities/ClonedDeclarationVisitor.hh"
 
+#include <utility>
+
 using namespace chase;
 
 ClonedDeclarationVisitor::ClonedDeclarationVisitor(
         std::map< Declaration *, Declaration * > &m ) :
-        GuideVisitor(1)
+        GuideVisitor(1),
+        _owned(m.size())
+{
+    for(auto & entry : m)
+        _owned.insert(entry.first, entry.second);
+    _map = &_owned;
+}
+
+ClonedDeclarationVisitor::ClonedDeclarationVisitor(
+        FlatPointerMap< Declaration, Declaration > &m ) :
+        GuideVisitor(1),
+        _owned()
 {
     _map = &m;
 }
 
 int ClonedDeclarationVisitor::visitIdentifier(Identifier &o) {
-    auto it = _map->find(o.getDeclaration());
-    auto dec = dynamic_cast< DataDeclaration* >(it->second);
+    auto found = _map->find(o.getDeclaration());
+    // Identifiers of declarations outside the map are left untouched.
+    if( found == nullptr )
+        return 1;
+    auto dec = dynamic_cast< DataDeclaration* >(found);
     if( dec != nullptr )
         o.setDeclaration(dec);
     return 1;
 }
 
+int ClonedDeclarationVisitor::visitContract(Contract &o) {
+    if( !o.hasOccurrenceIndex() )
+        return GuideVisitor::visitContract(o);
+
+    // The declarations may contain identifiers as well (e.g., values).
+    visitList(o.declarations);
 
+    std::vector< std::pair< DataDeclaration *, DataDeclaration * > > renames;
+    const occurrence_index & index = o.getOccurrenceIndex();
+    for( auto occurrences : {&index.assumptions, &index.guarantees} )
+    {
+        for( auto & entry : *occurrences )
+        {
+            auto dec = dynamic_cast< DataDeclaration* >(
+                    _map->find(entry.first));
+            if( dec != nullptr )
+                renames.emplace_back(entry.first, dec);
+        }
+    }
+    for( auto & rename : renames )
+        o.renameOccurrences(rename.first, rename.second);
+    return 1;
+}
+
+void ClonedDeclarationVisitor::remap(
+        const std::vector< Identifier * > &identifiers)
+{
+    for(auto identifier : identifiers)
+        visitIdentifier(*identifier);
+}
@@ -0,0 +1,185 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/Combinations.hh"
+#include "utilities/IOUtils.hh"
+
+#include <algorithm>
+#include <limits>
+
+using namespace chase;
+
+CombinationIterator::CombinationIterator(
+        unsigned int n, unsigned int k, combination_filter filter) :
+    _n(n),
+    _k(k),
+    _indexes(k),
+    _bounded(false),
+    _done(k > n),
+    _filter(std::move(filter))
+{
+    if(_done) return;
+    for(unsigned int i = 0; i < k; ++i)
+        _indexes[i] = i;
+    _seek(0, true);
+}
+
+CombinationIterator::CombinationIterator(
+        unsigned int n, unsigned int k, uint64_t begin, uint64_t end,
+        combination_filter filter) :
+    _n(n),
+    _k(k),
+    _indexes(k),
+    _bounded(false),
+    _done(k > n),
+    _filter(std::move(filter))
+{
+    if(_done) return;
+    uint64_t total = binomial(n, k);
+    if(begin >= std::min(end, total))
+    {
+        _done = true;
+        return;
+    }
+    unrank(n, begin, _indexes);
+    if(end < total)
+    {
+        _bounded = true;
+        _end.resize(k);
+        unrank(n, end, _end);
+    }
+    _seek(0, true);
+}
+
+CombinationIterator::~CombinationIterator() = default;
+
+bool CombinationIterator::isDone() const
+{
+    return _done;
+}
+
+bool CombinationIterator::next()
+{
+    if(_done) return false;
+    if(_k == 0)
+    {
+        _done = true;
+        return false;
+    }
+    ++_indexes[_k - 1];
+    _seek(static_cast< int >(_k) - 1, false);
+    return !_done;
+}
+
+void CombinationIterator::_seek(int level, bool keep)
+{
+    const int k = static_cast< int >(_k);
+    while(true)
+    {
+        if(level == k)
+        {
+            if(_bounded && !std::lexicographical_compare(
+                    _indexes.begin(), _indexes.end(),
+                    _end.begin(), _end.end()))
+                _done = true;
+            return;
+        }
+
+        // Position level can hold at most n - k + level.
+        if(_indexes[level] > _n - _k + static_cast< unsigned int >(level))
+        {
+            if(--level < 0)
+            {
+                _done = true;
+                return;
+            }
+            ++_indexes[level];
+            keep = false;
+            continue;
+        }
+
+        if(_filter && !_filter(_indexes.data(),
+                               static_cast< unsigned int >(level) + 1))
+        {
+            ++_indexes[level];
+            keep = false;
+            continue;
+        }
+
+        if(level + 1 < k && !keep)
+            _indexes[level + 1] = _indexes[level] + 1;
+        ++level;
+    }
+}
+
+const std::vector< unsigned int > & CombinationIterator::getIndexes() const
+{
+    return _indexes;
+}
+
+uint64_t CombinationIterator::getRank() const
+{
+    return rank(_n, _indexes);
+}
+
+uint64_t CombinationIterator::binomial(unsigned int n, unsigned int k)
+{
+    if(k > n) return 0;
+    k = std::min(k, n - k);
+    __extension__ typedef unsigned __int128 wide;
+    wide result = 1;
+    for(unsigned int i = 1; i <= k; ++i)
+    {
+        // The product of i consecutive integers is divisible by i!.
+        result = result * (n - k + i) / i;
+        if(result > std::numeric_limits< uint64_t >::max())
+            messageError("Combinations: the number of combinations does "
+                         "not fit in 64 bits.");
+    }
+    return static_cast< uint64_t >(result);
+}
+
+void CombinationIterator::unrank(unsigned int n, uint64_t rank,
+                                 std::vector< unsigned int > & indexes)
+{
+    auto k = static_cast< unsigned int >(indexes.size());
+    unsigned int x = 0;
+    for(unsigned int i = 0; i < k; ++i)
+    {
+        while(true)
+        {
+            // Number of combinations having x at position i.
+            uint64_t c = binomial(n - x - 1, k - i - 1);
+            if(rank < c) break;
+            rank -= c;
+            ++x;
+        }
+        indexes[i] = x++;
+    }
+}
+
+uint64_t CombinationIterator::rank(
+        unsigned int n, const std::vector< unsigned int > & indexes)
+{
+    auto k = static_cast< unsigned int >(indexes.size());
+    uint64_t r = 0;
+    unsigned int start = 0;
+    for(unsigned int i = 0; i < k; ++i)
+    {
+        for(unsigned int x = start; x < indexes[i]; ++x)
+            r += binomial(n - x - 1, k - i - 1);
+        start = indexes[i] + 1;
+    }
+    return r;
+}
+
+uint64_t CombinationIterator::nextMask(uint64_t mask)
+{
+    uint64_t lowest = mask & (~mask + 1);
+    uint64_t ripple = mask + lowest;
+    return (((ripple ^ mask) >> 2) / lowest) | ripple;
+}
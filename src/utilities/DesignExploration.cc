@@ -0,0 +1,380 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/DesignExploration.hh"
+#include "utilities/Combinations.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/LtlToBuchi.hh"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+using namespace chase;
+
+namespace {
+
+    /// @brief Function building the correspondences of the names shared by
+    /// two contracts, so that they are merged by the algebra.
+    /// @param c1 The first contract.
+    /// @param c2 The second contract.
+    /// @param correspondences The map receiving the correspondences.
+    void matchNames(Contract * c1, Contract * c2,
+                    names_projection_map & correspondences)
+    {
+        std::set< std::string > names;
+        for(auto declaration : c1->declarations)
+            names.insert(declaration->getName()->getString());
+        for(auto declaration : c2->declarations)
+        {
+            std::string name = declaration->getName()->getString();
+            if(names.find(name) != names.end())
+                correspondences[name] = name;
+        }
+    }
+
+    /// @brief Default refinement check, in the logic domain.
+    bool checkLogicRefinement(Contract * composition, Contract * requirement)
+    {
+        names_projection_map correspondences;
+        matchNames(composition, requirement, correspondences);
+        return checkRefinementLTL(composition, requirement, correspondences);
+    }
+
+}
+
+DesignExploration::DesignExploration(DesignProblem * problem,
+                                     std::string view,
+                                     unsigned int threads) :
+    _problem(problem),
+    _view(std::move(view)),
+    _checker(checkLogicRefinement),
+    _pruneDominated(false),
+    _bound(std::numeric_limits< double >::infinity()),
+    _threads(threads),
+    _memoLimit(1u << 16),
+    _active(0),
+    _started(false),
+    _stopped(false),
+    _visited(0),
+    _pruned(0),
+    _memoHits(0),
+    _failed(0)
+{
+    if(problem == nullptr)
+        messageError("DesignExploration: the design problem is missing.");
+}
+
+DesignExploration::~DesignExploration()
+{
+    stop();
+    wait();
+    for(auto & result : _results)
+        delete result.contract;
+}
+
+void DesignExploration::addSlot(Library * library, unsigned int count)
+{
+    if(_started)
+        messageError("DesignExploration: the exploration already started.");
+
+    exploration_slot slot;
+    slot.count = count;
+    for(auto declaration : library->declarations)
+    {
+        if(declaration->IsA() != componentDefinition_node) continue;
+        auto component = reinterpret_cast< ComponentDefinition * >(
+                declaration);
+        if(_getView(component) != nullptr)
+            slot.candidates.push_back(component);
+    }
+    _slots.push_back(slot);
+}
+
+void DesignExploration::setCostFunction(component_cost cost)
+{
+    _cost = std::move(cost);
+}
+
+void DesignExploration::setPruneDominated(bool enabled)
+{
+    _pruneDominated = enabled;
+}
+
+void DesignExploration::setFilter(selection_filter filter)
+{
+    _filter = std::move(filter);
+}
+
+void DesignExploration::setChecker(refinement_checker checker)
+{
+    _checker = std::move(checker);
+}
+
+void DesignExploration::setMemoLimit(size_t size)
+{
+    _memoLimit = size;
+}
+
+void DesignExploration::start()
+{
+    if(_started)
+        messageError("DesignExploration: the exploration already started.");
+    if(_slots.empty())
+    {
+        for(auto library : _problem->libraries)
+            addSlot(library);
+    }
+    _started = true;
+    _pool.reset(new ThreadPool(_threads));
+
+    exploration_node root;
+    root.cost = 0;
+    _schedule(root, 0);
+}
+
+bool DesignExploration::next(exploration_result & result)
+{
+    std::unique_lock< std::mutex > lock(_resultsMutex);
+    _resultsAvailable.wait(lock, [this] {
+        return !_results.empty() || _active == 0; });
+    if(_results.empty()) return false;
+    result = _results.front();
+    _results.pop_front();
+    return true;
+}
+
+void DesignExploration::stop()
+{
+    _stopped = true;
+}
+
+void DesignExploration::wait()
+{
+    if(_pool) _pool->wait();
+}
+
+void DesignExploration::run(
+        const std::function< void(exploration_result &) > & callback)
+{
+    start();
+    exploration_result result;
+    while(next(result))
+        callback(result);
+    wait();
+}
+
+size_t DesignExploration::getVisitedCount() const
+{
+    return _visited;
+}
+
+size_t DesignExploration::getPrunedCount() const
+{
+    return _pruned;
+}
+
+size_t DesignExploration::getMemoHitsCount() const
+{
+    return _memoHits;
+}
+
+size_t DesignExploration::getFailedCount() const
+{
+    return _failed;
+}
+
+Contract * DesignExploration::_getView(ComponentDefinition * component) const
+{
+    if(component->views.empty()) return nullptr;
+    if(_view.empty()) return component->views.begin()->second;
+    auto it = component->views.find(_view);
+    return it == component->views.end() ? nullptr : it->second;
+}
+
+Contract * DesignExploration::_compose(Contract * c1, Contract * c2)
+{
+    names_projection_map correspondences;
+    matchNames(c1, c2, correspondences);
+    return Contract::composition(c1, c2, correspondences);
+}
+
+bool DesignExploration::_isConsistent(
+        std::vector< ComponentDefinition * > components, Contract * contract)
+{
+    std::sort(components.begin(), components.end());
+    {
+        std::lock_guard< std::mutex > lock(_memoMutex);
+        auto it = _memo.find(components);
+        if(it != _memo.end())
+        {
+            ++_memoHits;
+            return it->second;
+        }
+    }
+
+    // The check runs outside the lock: two workers may compute the same
+    // set, which is cheaper than serializing all the checks.
+    std::unique_ptr< Contract > owned;
+    if(contract == nullptr)
+    {
+        owned.reset(_getView(components[0])->clone());
+        for(size_t i = 1; i < components.size(); ++i)
+            owned.reset(_compose(owned.get(), _getView(components[i])));
+        contract = owned.get();
+    }
+
+    bool consistent = true;
+    auto g = contract->guarantees.find(logic);
+    if(g != contract->guarantees.end())
+    {
+        auto f = dynamic_cast< LogicFormula * >(g->second);
+        if(f == nullptr) messageError("Wrong format in Logic.");
+        consistent = isSatisfiableLTL(f);
+    }
+
+    std::lock_guard< std::mutex > lock(_memoMutex);
+    if(_memo.size() < _memoLimit)
+        _memo.emplace(components, consistent);
+    return consistent;
+}
+
+void DesignExploration::_schedule(exploration_node node, size_t slot)
+{
+    {
+        std::lock_guard< std::mutex > lock(_resultsMutex);
+        ++_active;
+    }
+    _pool->submit([this, node, slot] {
+        try
+        {
+            if(!_stopped) _expand(node, slot);
+        }
+        catch(ChaseError &)
+        {
+            // The error has already been reported by the diagnostics.
+            ++_failed;
+        }
+        catch(std::exception & e)
+        {
+            // Errors of the callbacks are counted as well: the node must
+            // be completed, or the exploration would never end.
+            messageWarning(std::string("DesignExploration: ") + e.what());
+            ++_failed;
+        }
+        catch(...)
+        {
+            messageWarning("DesignExploration: unknown error.");
+            ++_failed;
+        }
+        _done();
+    });
+}
+
+void DesignExploration::_expand(const exploration_node & node, size_t slot)
+{
+    ++_visited;
+    if(slot == _slots.size())
+    {
+        _check(node);
+        return;
+    }
+
+    const exploration_slot & s = _slots[slot];
+    std::vector< ComponentDefinition * > selection(node.components);
+
+    // Partial combinations are pruned as soon as their last component is
+    // already selected, conflicts with a selected component, or makes the
+    // selection rejected or dominated.
+    auto filter = [&](const unsigned int * indexes, unsigned int size) {
+        ComponentDefinition * last = s.candidates[indexes[size - 1]];
+        selection.resize(node.components.size());
+        double cost = node.cost;
+        for(unsigned int i = 0; i < size; ++i)
+        {
+            selection.push_back(s.candidates[indexes[i]]);
+            if(_cost) cost += _cost(s.candidates[indexes[i]]);
+        }
+
+        bool keep = std::find(node.components.begin(),
+                              node.components.end(), last) ==
+                    node.components.end();
+        for(size_t i = 0; keep && i + 1 < selection.size(); ++i)
+        {
+            keep = _isConsistent(std::vector< ComponentDefinition * >{
+                    selection[i], last}, nullptr);
+        }
+        if(keep && _pruneDominated)
+            keep = cost <= _bound;
+        if(keep && _filter)
+            keep = _filter(selection);
+        if(!keep) ++_pruned;
+        return keep;
+    };
+
+    for(CombinationIterator it(
+            static_cast< unsigned int >(s.candidates.size()), s.count,
+            filter); !it.isDone() && !_stopped; it.next())
+    {
+        exploration_node child;
+        child.components = node.components;
+        child.contract = node.contract;
+        child.cost = node.cost;
+        for(auto index : it.getIndexes())
+        {
+            ComponentDefinition * component = s.candidates[index];
+            child.components.push_back(component);
+            if(_cost) child.cost += _cost(component);
+            Contract * view = _getView(component);
+            child.contract.reset(child.contract ?
+                                 _compose(child.contract.get(), view) :
+                                 view->clone());
+        }
+
+        if(child.components.size() > 1 &&
+           !_isConsistent(child.components, child.contract.get()))
+        {
+            ++_pruned;
+            continue;
+        }
+        _schedule(child, slot + 1);
+    }
+}
+
+void DesignExploration::_check(const exploration_node & node)
+{
+    if(!node.contract) return;
+    if(_pruneDominated && node.cost > _bound) return;
+
+    for(auto requirement : _problem->requirements)
+    {
+        if(!_checker(node.contract.get(), requirement)) return;
+    }
+
+    if(_pruneDominated)
+    {
+        double bound = _bound;
+        while(node.cost < bound &&
+              !_bound.compare_exchange_weak(bound, node.cost));
+    }
+
+    exploration_result result;
+    result.components = node.components;
+    result.cost = node.cost;
+    result.contract = node.contract->clone();
+    {
+        std::lock_guard< std::mutex > lock(_resultsMutex);
+        _results.push_back(result);
+    }
+    _resultsAvailable.notify_all();
+}
+
+void DesignExploration::_done()
+{
+    std::lock_guard< std::mutex > lock(_resultsMutex);
+    if(--_active == 0) _resultsAvailable.notify_all();
+}
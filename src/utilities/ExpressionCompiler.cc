@@ -0,0 +1,483 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/ExpressionCompiler.hh"
+#include "representation.hh"
+#include "utilities/IOUtils.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+
+using namespace chase;
+
+namespace {
+
+    bytecode_opcode toOpcode(Operator op)
+    {
+        switch(op)
+        {
+            case op_plus: return bc_add;
+            case op_minus: return bc_sub;
+            case op_multiply: return bc_mul;
+            case op_divide: return bc_div;
+            case op_mod: return bc_mod;
+            case op_eq: return bc_eq;
+            case op_neq: return bc_neq;
+            case op_lt: return bc_lt;
+            case op_gt: return bc_gt;
+            case op_le: return bc_le;
+            case op_ge: return bc_ge;
+            default:
+                messageError("Expression compiler: unsupported operator.");
+                break;
+        }
+        return bc_add;
+    }
+
+    double apply(bytecode_opcode op, double x, double y)
+    {
+        switch(op)
+        {
+            case bc_negate: return -x;
+            case bc_add: return x + y;
+            case bc_sub: return x - y;
+            case bc_mul: return x * y;
+            case bc_div: return x / y;
+            case bc_mod: return std::fmod(x, y);
+            case bc_eq: return x == y ? 1.0 : 0.0;
+            case bc_neq: return x != y ? 1.0 : 0.0;
+            case bc_lt: return x < y ? 1.0 : 0.0;
+            case bc_gt: return x > y ? 1.0 : 0.0;
+            case bc_le: return x <= y ? 1.0 : 0.0;
+            case bc_ge: return x >= y ? 1.0 : 0.0;
+            case bc_and: return (x != 0.0 && y != 0.0) ? 1.0 : 0.0;
+            default: break;
+        }
+        return 0.0;
+    }
+
+    const char * opcodeName(bytecode_opcode op)
+    {
+        static const char * names[] = {
+                "const", "load", "neg", "add", "sub", "mul", "div", "mod",
+                "eq", "neq", "lt", "gt", "le", "ge", "and"};
+        return names[op];
+    }
+}
+
+// ---------------------------------------------------------------------------
+// ExpressionProgram
+// ---------------------------------------------------------------------------
+
+ExpressionProgram::ExpressionProgram() :
+    _registers(0),
+    _hasResult(false)
+{
+}
+
+ExpressionProgram::~ExpressionProgram() = default;
+
+unsigned int ExpressionProgram::addVariable(DataDeclaration * declaration)
+{
+    auto it = _variablesIndex.find(declaration);
+    if(it != _variablesIndex.end()) return it->second;
+
+    auto index = static_cast< unsigned int >(_variables.size());
+    _variables.push_back(declaration);
+    _variablesIndex.insert(std::make_pair(declaration, index));
+    return index;
+}
+
+void ExpressionProgram::compile(Expression * expression)
+{
+    if(expression == nullptr)
+        messageError("Expression compiler: missing expression.");
+
+    // The first expression is computed directly in the result register,
+    // the following ones are computed above it and then conjoined.
+    unsigned int base = _hasResult ? 1 : 0;
+    ExpressionCompiler compiler(*this, base);
+    int r = expression->accept_visitor(compiler);
+
+    if(_hasResult)
+        _code.push_back({bc_and, 0, 0, static_cast< uint32_t >(r)});
+    _hasResult = true;
+}
+
+void ExpressionProgram::compile(Constraint * constraint)
+{
+    compile(constraint->getExpression());
+}
+
+double ExpressionProgram::evaluate(
+        const double * assignment, double * registers) const
+{
+    for(const auto & i : _code)
+    {
+        switch(i.opcode)
+        {
+            case bc_load_constant:
+                registers[i.dst] = _constants[i.a];
+                break;
+            case bc_load_variable:
+                registers[i.dst] = assignment[i.a];
+                break;
+            default:
+                registers[i.dst] =
+                        apply(i.opcode, registers[i.a], registers[i.b]);
+                break;
+        }
+    }
+    return _code.empty() ? 1.0 : registers[0];
+}
+
+double ExpressionProgram::evaluate(
+        const std::vector< double > & assignment) const
+{
+    if(assignment.size() < _variables.size())
+        messageError("Expression program: incomplete assignment.");
+    std::vector< double > registers(std::max(_registers, 1u));
+    return evaluate(assignment.data(), registers.data());
+}
+
+void ExpressionProgram::evaluateBatch(
+        const std::vector< const double * > & columns,
+        size_t count, double * results) const
+{
+    if(columns.size() < _variables.size())
+        messageError("Expression program: missing columns.");
+
+    if(_code.empty())
+    {
+        std::fill(results, results + count, 1.0);
+        return;
+    }
+
+    const size_t block = batch_block;
+    std::vector< double > registers(_registers * block);
+    double * regs = registers.data();
+
+    for(size_t start = 0; start < count; start += block)
+    {
+        const size_t n = std::min(block, count - start);
+        for(const auto & i : _code)
+        {
+            double * d = regs + i.dst * block;
+            const double * x = regs + i.a * block;
+            const double * y = regs + i.b * block;
+            // Each case is a simple loop over contiguous arrays, which the
+            // compiler turns into SIMD code.
+            switch(i.opcode)
+            {
+                case bc_load_constant:
+                    std::fill(d, d + n, _constants[i.a]);
+                    break;
+                case bc_load_variable:
+                    std::memcpy(d, columns[i.a] + start, n * sizeof(double));
+                    break;
+                case bc_negate:
+                    for(size_t k = 0; k < n; ++k) d[k] = -x[k];
+                    break;
+                case bc_add:
+                    for(size_t k = 0; k < n; ++k) d[k] = x[k] + y[k];
+                    break;
+                case bc_sub:
+                    for(size_t k = 0; k < n; ++k) d[k] = x[k] - y[k];
+                    break;
+                case bc_mul:
+                    for(size_t k = 0; k < n; ++k) d[k] = x[k] * y[k];
+                    break;
+                case bc_div:
+                    for(size_t k = 0; k < n; ++k) d[k] = x[k] / y[k];
+                    break;
+                case bc_mod:
+                    for(size_t k = 0; k < n; ++k) d[k] = std::fmod(x[k], y[k]);
+                    break;
+                case bc_eq:
+                    for(size_t k = 0; k < n; ++k)
+                        d[k] = x[k] == y[k] ? 1.0 : 0.0;
+                    break;
+                case bc_neq:
+                    for(size_t k = 0; k < n; ++k)
+                        d[k] = x[k] != y[k] ? 1.0 : 0.0;
+                    break;
+                case bc_lt:
+                    for(size_t k = 0; k < n; ++k)
+                        d[k] = x[k] < y[k] ? 1.0 : 0.0;
+                    break;
+                case bc_gt:
+                    for(size_t k = 0; k < n; ++k)
+                        d[k] = x[k] > y[k] ? 1.0 : 0.0;
+                    break;
+                case bc_le:
+                    for(size_t k = 0; k < n; ++k)
+                        d[k] = x[k] <= y[k] ? 1.0 : 0.0;
+                    break;
+                case bc_ge:
+                    for(size_t k = 0; k < n; ++k)
+                        d[k] = x[k] >= y[k] ? 1.0 : 0.0;
+                    break;
+                case bc_and:
+                    for(size_t k = 0; k < n; ++k)
+                        d[k] = (x[k] != 0.0 && y[k] != 0.0) ? 1.0 : 0.0;
+                    break;
+            }
+        }
+        std::memcpy(results + start, regs, n * sizeof(double));
+    }
+}
+
+const std::vector< DataDeclaration * > &
+ExpressionProgram::getVariables() const
+{
+    return _variables;
+}
+
+const std::vector< bytecode_instruction > & ExpressionProgram::getCode() const
+{
+    return _code;
+}
+
+unsigned int ExpressionProgram::getRegistersCount() const
+{
+    return _registers;
+}
+
+std::string ExpressionProgram::getString() const
+{
+    std::string ret;
+    for(const auto & i : _code)
+    {
+        ret += opcodeName(i.opcode);
+        ret += "\tr" + std::to_string(i.dst);
+        switch(i.opcode)
+        {
+            case bc_load_constant:
+                ret += ", " + std::to_string(_constants[i.a]);
+                break;
+            case bc_load_variable:
+                ret += ", " + _variables[i.a]->getName()->getString();
+                break;
+            case bc_negate:
+                ret += ", r" + std::to_string(i.a);
+                break;
+            default:
+                ret += ", r" + std::to_string(i.a) +
+                       ", r" + std::to_string(i.b);
+                break;
+        }
+        ret += "\n";
+    }
+    return ret;
+}
+
+// ---------------------------------------------------------------------------
+// ExpressionCompiler
+// ---------------------------------------------------------------------------
+
+ExpressionCompiler::ExpressionCompiler(
+        ExpressionProgram & program, unsigned int base) :
+    _program(program),
+    _top(base)
+{
+}
+
+ExpressionCompiler::~ExpressionCompiler() = default;
+
+int ExpressionCompiler::_loadConstant(double value)
+{
+    unsigned int r = _top++;
+    _program._registers = std::max(_program._registers, _top);
+
+    auto index = static_cast< uint32_t >(_program._constants.size());
+    _program._constants.push_back(value);
+    _program._code.push_back({bc_load_constant, r, index, 0});
+    return static_cast< int >(r);
+}
+
+int ExpressionCompiler::visitExpression(Expression & o)
+{
+    if(o.getOp1() == nullptr)
+        messageError("Expression compiler: missing operand.", &o);
+
+    auto & code = _program._code;
+    auto & constants = _program._constants;
+
+    int a = o.getOp1()->accept_visitor(*this);
+
+    // Unary minus.
+    if(o.getOp2() == nullptr)
+    {
+        if(o.getOperator() != op_minus)
+            messageError("Expression compiler: missing operand.", &o);
+        if(! code.empty() && code.back().opcode == bc_load_constant &&
+           code.back().dst == static_cast< uint32_t >(a))
+        {
+            constants[code.back().a] = -constants[code.back().a];
+            return a;
+        }
+        code.push_back({bc_negate, static_cast< uint32_t >(a),
+                        static_cast< uint32_t >(a), 0});
+        return a;
+    }
+
+    int b = o.getOp2()->accept_visitor(*this);
+    bytecode_opcode op = toOpcode(o.getOperator());
+
+    // Constant folding: both operands have just been loaded as constants.
+    size_t size = code.size();
+    if(size >= 2 &&
+       code[size - 2].opcode == bc_load_constant &&
+       code[size - 2].dst == static_cast< uint32_t >(a) &&
+       code[size - 1].opcode == bc_load_constant &&
+       code[size - 1].dst == static_cast< uint32_t >(b))
+    {
+        double v = apply(op, constants[code[size - 2].a],
+                         constants[code[size - 1].a]);
+        constants[code[size - 2].a] = v;
+        constants.pop_back();
+        code.pop_back();
+    }
+    else
+    {
+        code.push_back({op, static_cast< uint32_t >(a),
+                        static_cast< uint32_t >(a),
+                        static_cast< uint32_t >(b)});
+    }
+
+    // Release the register of the second operand.
+    _top = static_cast< unsigned int >(a) + 1;
+    return a;
+}
+
+int ExpressionCompiler::visitIdentifier(Identifier & o)
+{
+    unsigned int r = _top++;
+    _program._registers = std::max(_program._registers, _top);
+
+    unsigned int index = _program.addVariable(o.getDeclaration());
+    _program._code.push_back({bc_load_variable, r, index, 0});
+    return static_cast< int >(r);
+}
+
+int ExpressionCompiler::visitIntegerValue(IntegerValue & o)
+{
+    return _loadConstant(static_cast< double >(o.getValue()));
+}
+
+int ExpressionCompiler::visitRealValue(RealValue & o)
+{
+    return _loadConstant(o.getValue());
+}
+
+int ExpressionCompiler::visitBooleanValue(BooleanValue & o)
+{
+    return _loadConstant(o.getValue() ? 1.0 : 0.0);
+}
+
+int ExpressionCompiler::visitConstraint(Constraint & o)
+{
+    return o.getExpression()->accept_visitor(*this);
+}
+
+int ExpressionCompiler::visitRange(Range & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitStringValue(StringValue & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitInterval(Interval & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitMatrix(Matrix & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitProbabilityFunction(ProbabilityFunction & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitFunctionCall(FunctionCall & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitProposition(Proposition & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitBooleanConstant(BooleanConstant & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitBinaryBooleanOperation(BinaryBooleanFormula & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitUnaryBooleanOperation(UnaryBooleanFormula & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitLargeBooleanFormula(LargeBooleanFormula & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitQuantifiedFormula(QuantifiedFormula & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitModalFormula(ModalFormula & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitUnaryTemporalOperation(UnaryTemporalFormula & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+int ExpressionCompiler::visitBinaryTemporalOperation(BinaryTemporalFormula & o)
+{
+    messageError("Expression compiler: unsupported operand.", &o);
+}
+
+// ---------------------------------------------------------------------------
+// Factories.
+// ---------------------------------------------------------------------------
+
+ExpressionProgram * chase::compileExpression(Expression * expression)
+{
+    // The program is released only once compiled, as compiling may throw.
+    std::unique_ptr< ExpressionProgram > ret(new ExpressionProgram());
+    ret->compile(expression);
+    return ret.release();
+}
+
+ExpressionProgram * chase::compileConstraints(
+        std::vector< Constraint * > & constraints)
+{
+    std::unique_ptr< ExpressionProgram > ret(new ExpressionProgram());
+    for(auto c : constraints)
+        ret->compile(c);
+    return ret.release();
+}
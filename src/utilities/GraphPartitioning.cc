@@ -0,0 +1,592 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/GraphPartitioning.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+using namespace chase;
+
+namespace {
+
+    const unsigned int none = std::numeric_limits< unsigned int >::max();
+
+    /// @brief Coarsening stops below this number of nodes.
+    const unsigned int coarsestSize = 64;
+    /// @brief Number of bisections grown on the coarsest graph.
+    const unsigned int initialTries = 8;
+    /// @brief Maximum number of refinement passes per level.
+    const unsigned int refinementPasses = 8;
+
+    /// @brief Undirected graph with weighted nodes and edges, without
+    /// self loops and parallel edges. Every edge appears in both rows.
+    typedef struct weighted_graph {
+        std::vector< unsigned int > offsets;
+        std::vector< unsigned int > targets;
+        std::vector< double > weights;
+        std::vector< unsigned int > nodeWeights;
+
+        unsigned int getSize() const
+        {
+            return static_cast< unsigned int >(nodeWeights.size());
+        }
+
+        double getTotalWeight() const
+        {
+            double total = 0;
+            for( auto w : nodeWeights ) total += w;
+            return total;
+        }
+    } weighted_graph;
+
+    /// @brief SplitMix64 generator, so that the partitions depend only on
+    /// the seed.
+    class Random {
+    public:
+        explicit Random( uint64_t seed ) : _state(seed) {}
+
+        uint64_t next()
+        {
+            uint64_t z = (_state += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        unsigned int uniform( unsigned int bound )
+        {
+            return static_cast< unsigned int >(next() % bound);
+        }
+
+        std::vector< unsigned int > permutation( unsigned int size )
+        {
+            std::vector< unsigned int > order(size);
+            for( unsigned int i = 0; i < size; ++i ) order[i] = i;
+            for( unsigned int i = size; i > 1; --i )
+                std::swap(order[i - 1], order[uniform(i)]);
+            return order;
+        }
+
+    protected:
+        uint64_t _state;
+    };
+
+    /// @brief Weighted arc, before the rows are built.
+    typedef struct weighted_arc {
+        unsigned int source;
+        unsigned int target;
+        double weight;
+    } weighted_arc;
+
+    /// @brief Function filling the rows of a graph with a list of arcs,
+    /// bucketed by source, merging the parallel ones.
+    void buildRows( weighted_graph & g,
+                    const std::vector< weighted_arc > & arcs )
+    {
+        unsigned int size = g.getSize();
+        std::vector< unsigned int > start(size + 1, 0);
+        for( auto & arc : arcs ) ++start[arc.source + 1];
+        for( unsigned int v = 0; v < size; ++v ) start[v + 1] += start[v];
+        std::vector< unsigned int > order(arcs.size());
+        std::vector< unsigned int > next(start.begin(), start.end() - 1);
+        for( unsigned int a = 0; a < arcs.size(); ++a )
+            order[next[arcs[a].source]++] = a;
+
+        std::vector< unsigned int > last(size, none);
+        std::vector< unsigned int > position(size);
+        g.offsets.assign(1, 0);
+        g.targets.clear();
+        g.weights.clear();
+        for( unsigned int v = 0; v < size; ++v )
+        {
+            for( unsigned int k = start[v]; k < start[v + 1]; ++k )
+            {
+                const weighted_arc & arc = arcs[order[k]];
+                if( last[arc.target] == v )
+                {
+                    g.weights[position[arc.target]] += arc.weight;
+                    continue;
+                }
+                last[arc.target] = v;
+                position[arc.target] = static_cast< unsigned int >(
+                        g.targets.size());
+                g.targets.push_back(arc.target);
+                g.weights.push_back(arc.weight);
+            }
+            g.offsets.push_back(static_cast< unsigned int >(g.targets.size()));
+        }
+    }
+
+    weighted_graph symmetrize( const compact_adjacency & adjacency,
+                               const std::vector< double > & weights,
+                               const std::vector< unsigned int > & nodeWeights )
+    {
+        weighted_graph g;
+        unsigned int size = adjacency.getSize();
+        g.nodeWeights = nodeWeights.empty() ?
+                std::vector< unsigned int >(size, 1) : nodeWeights;
+        std::vector< weighted_arc > arcs;
+        arcs.reserve(2 * adjacency.targets.size());
+        for( unsigned int v = 0; v < size; ++v )
+        {
+            for( unsigned int i = adjacency.offsets[v];
+                 i < adjacency.offsets[v + 1]; ++i )
+            {
+                unsigned int w = adjacency.targets[i];
+                if( w == v ) continue;
+                double weight = weights.empty() ? 1.0 :
+                        weights[adjacency.edges[i]];
+                arcs.push_back({v, w, weight});
+                arcs.push_back({w, v, weight});
+            }
+        }
+        buildRows(g, arcs);
+        return g;
+    }
+
+    /// @brief Function contracting a heavy-edge matching, visited in random
+    /// order. Matched nodes must not exceed a maximum weight, so that the
+    /// coarsest graph can still be balanced.
+    /// @param map It receives the coarse node of each node.
+    weighted_graph coarsen( const weighted_graph & g, Random & random,
+                            unsigned int maxNodeWeight,
+                            std::vector< unsigned int > & map )
+    {
+        unsigned int size = g.getSize();
+        std::vector< unsigned int > match(size, none);
+        for( auto v : random.permutation(size) )
+        {
+            if( match[v] != none ) continue;
+            unsigned int best = v;
+            double heaviest = -1;
+            for( unsigned int i = g.offsets[v]; i < g.offsets[v + 1]; ++i )
+            {
+                unsigned int w = g.targets[i];
+                if( match[w] != none ||
+                    g.nodeWeights[v] + g.nodeWeights[w] > maxNodeWeight )
+                    continue;
+                // Edges are rated relative to the weight of the nodes, so
+                // that light nodes are matched first.
+                double rating = g.weights[i] /
+                        (static_cast< double >(g.nodeWeights[w]) + 1);
+                if( rating <= heaviest ) continue;
+                best = w;
+                heaviest = rating;
+            }
+            match[v] = best;
+            match[best] = v;
+        }
+
+        weighted_graph coarse;
+        map.assign(size, none);
+        std::vector< unsigned int > members;
+        for( unsigned int v = 0; v < size; ++v )
+        {
+            if( map[v] != none ) continue;
+            auto c = static_cast< unsigned int >(coarse.nodeWeights.size());
+            map[v] = c;
+            map[match[v]] = c;
+            members.push_back(v);
+            coarse.nodeWeights.push_back(g.nodeWeights[v] +
+                    (match[v] != v ? g.nodeWeights[match[v]] : 0));
+        }
+
+        std::vector< weighted_arc > arcs;
+        arcs.reserve(g.targets.size());
+        for( unsigned int c = 0; c < coarse.getSize(); ++c )
+        {
+            unsigned int v = members[c];
+            for( unsigned int u : {v, match[v]} )
+            {
+                for( unsigned int i = g.offsets[u]; i < g.offsets[u + 1]; ++i )
+                    if( map[g.targets[i]] != c )
+                        arcs.push_back({c, map[g.targets[i]], g.weights[i]});
+                if( match[v] == v ) break;
+            }
+        }
+        buildRows(coarse, arcs);
+        return coarse;
+    }
+
+    /// @brief Bisection of a graph, with the maximum weight of each side.
+    class Bisection {
+    public:
+        Bisection( const weighted_graph & g, const double maxWeights[2] ) :
+            side(g.getSize(), 1),
+            _g(g),
+            _maxWeights{maxWeights[0], maxWeights[1]},
+            _slack(0)
+        {
+            for( auto w : g.nodeWeights )
+                _slack = std::max(_slack, static_cast< double >(w));
+        }
+
+        /// @brief The side of each node.
+        std::vector< unsigned int > side;
+
+        /// @brief Function growing the side 0 from a random node, adding
+        /// the node that most reduces the cut, until it reaches its share
+        /// of the weight.
+        void grow( Random & random, double target )
+        {
+            unsigned int size = _g.getSize();
+            std::fill(side.begin(), side.end(), 1);
+            std::vector< double > gain(size, 0);
+            std::priority_queue< std::pair< double, unsigned int > > queue;
+            double weight = 0;
+            unsigned int next = random.uniform(size);
+            std::vector< unsigned int > order = random.permutation(size);
+            size_t unvisited = 0;
+            while( weight < target )
+            {
+                if( next == none )
+                {
+                    // Disconnected nodes: restart from a random one.
+                    while( unvisited < size && side[order[unvisited]] == 0 )
+                        ++unvisited;
+                    if( unvisited == size ) break;
+                    next = order[unvisited];
+                }
+                side[next] = 0;
+                weight += _g.nodeWeights[next];
+                for( unsigned int i = _g.offsets[next];
+                     i < _g.offsets[next + 1]; ++i )
+                {
+                    unsigned int w = _g.targets[i];
+                    if( side[w] == 0 ) continue;
+                    gain[w] += 2 * _g.weights[i];
+                    queue.emplace(gain[w], w);
+                }
+                next = none;
+                while( ! queue.empty() && next == none )
+                {
+                    auto top = queue.top();
+                    queue.pop();
+                    if( side[top.second] == 1 && top.first == gain[top.second] )
+                        next = top.second;
+                }
+            }
+        }
+
+        /// @brief Fiduccia-Mattheyses refinement: every pass moves each node
+        /// at most once, always picking the move of largest gain that keeps
+        /// the balance, and then keeps the best prefix of the moves.
+        void refine()
+        {
+            unsigned int size = _g.getSize();
+            std::vector< double > gain(size);
+            std::vector< char > locked(size);
+            std::vector< unsigned int > moves;
+            size_t patience = std::max< size_t >(100, size / 100);
+
+            for( unsigned int pass = 0; pass < refinementPasses; ++pass )
+            {
+                double weights[2] = {0, 0};
+                std::priority_queue< std::pair< double, unsigned int > > queue;
+                double cut = 0;
+                for( unsigned int v = 0; v < size; ++v )
+                {
+                    weights[side[v]] += _g.nodeWeights[v];
+                    gain[v] = 0;
+                    bool boundary = false;
+                    for( unsigned int i = _g.offsets[v];
+                         i < _g.offsets[v + 1]; ++i )
+                    {
+                        bool external = side[_g.targets[i]] != side[v];
+                        gain[v] += external ? _g.weights[i] : -_g.weights[i];
+                        if( external ) cut += _g.weights[i];
+                        boundary = boundary || external;
+                    }
+                    // Interior nodes enter the queue when a neighbor moves.
+                    if( boundary ) queue.emplace(gain[v], v);
+                }
+                cut /= 2;
+                std::fill(locked.begin(), locked.end(), 0);
+                moves.clear();
+
+                double excess = _getExcess(weights);
+                double bestExcess = excess;
+                double bestCut = cut;
+                size_t best = 0;
+                while( ! queue.empty() && moves.size() - best < patience )
+                {
+                    auto top = queue.top();
+                    queue.pop();
+                    unsigned int v = top.second;
+                    if( locked[v] || top.first != gain[v] ) continue;
+                    unsigned int from = side[v];
+                    unsigned int to = 1 - from;
+                    double moved[2] = {weights[0], weights[1]};
+                    moved[from] -= _g.nodeWeights[v];
+                    moved[to] += _g.nodeWeights[v];
+                    double movedExcess = _getExcess(moved);
+                    // A move may exceed the maximum weight by a node, so
+                    // that balanced bisections can swap nodes: the best
+                    // prefix restores the balance.
+                    if( moved[to] > _maxWeights[to] + _slack &&
+                        movedExcess >= excess )
+                        continue;
+
+                    side[v] = to;
+                    locked[v] = 1;
+                    moves.push_back(v);
+                    weights[0] = moved[0];
+                    weights[1] = moved[1];
+                    excess = movedExcess;
+                    cut -= gain[v];
+                    for( unsigned int i = _g.offsets[v];
+                         i < _g.offsets[v + 1]; ++i )
+                    {
+                        unsigned int w = _g.targets[i];
+                        gain[w] += side[w] == to ? -2 * _g.weights[i] :
+                                                   2 * _g.weights[i];
+                        if( ! locked[w] ) queue.emplace(gain[w], w);
+                    }
+                    if( excess < bestExcess ||
+                        (excess == bestExcess && cut < bestCut) )
+                    {
+                        bestExcess = excess;
+                        bestCut = cut;
+                        best = moves.size();
+                    }
+                }
+                for( size_t m = moves.size(); m > best; --m )
+                    side[moves[m - 1]] = 1 - side[moves[m - 1]];
+                if( best == 0 ) break;
+            }
+        }
+
+        /// @brief Function computing the excess over the maximum weights and
+        /// the weight of the cut.
+        void evaluate( double & excess, double & cut ) const
+        {
+            double weights[2] = {0, 0};
+            cut = 0;
+            for( unsigned int v = 0; v < _g.getSize(); ++v )
+            {
+                weights[side[v]] += _g.nodeWeights[v];
+                for( unsigned int i = _g.offsets[v];
+                     i < _g.offsets[v + 1]; ++i )
+                    if( side[_g.targets[i]] != side[v] )
+                        cut += _g.weights[i];
+            }
+            cut /= 2;
+            excess = _getExcess(weights);
+        }
+
+    protected:
+        const weighted_graph & _g;
+        double _maxWeights[2];
+        /// @brief The maximum weight of a node.
+        double _slack;
+
+        double _getExcess( const double weights[2] ) const
+        {
+            return std::max(0.0, weights[0] - _maxWeights[0]) +
+                   std::max(0.0, weights[1] - _maxWeights[1]);
+        }
+    };
+
+    /// @brief Multilevel bisection giving to the side 0 the fraction of the
+    /// weight of the graph.
+    std::vector< unsigned int > bisect( const weighted_graph & g,
+                                        double fraction, double imbalance,
+                                        Random & random )
+{
+        double total = g.getTotalWeight();
+        double targets[2] = {total * fraction, total * (1 - fraction)};
+        double maxWeights[2];
+        for( unsigned int s = 0; s < 2; ++s )
+            maxWeights[s] = std::max(targets[s] * (1 + imbalance),
+                                     std::ceil(targets[s]));
+
+        std::vector< weighted_graph > levels;
+        std::vector< std::vector< unsigned int > > maps;
+        auto maxNodeWeight = static_cast< unsigned int >(
+                std::max(1.0, std::ceil(1.5 * total / coarsestSize)));
+        const weighted_graph * current = &g;
+        while( current->getSize() > coarsestSize )
+        {
+            std::vector< unsigned int > map;
+            weighted_graph coarse = coarsen(*current, random, maxNodeWeight,
+                                            map);
+            if( coarse.getSize() > 0.9 * current->getSize() ) break;
+            levels.push_back(std::move(coarse));
+            maps.push_back(std::move(map));
+            current = &levels.back();
+        }
+        CHASE_PROFILE_COUNT("partitionGraph::levels", levels.size());
+
+        std::vector< unsigned int > side;
+        double bestExcess = 0;
+        double bestCut = 0;
+        for( unsigned int t = 0; t < initialTries; ++t )
+        {
+            Bisection bisection(*current, maxWeights);
+            bisection.grow(random, targets[0]);
+            bisection.refine();
+            double excess, cut;
+            bisection.evaluate(excess, cut);
+            if( t == 0 || excess < bestExcess ||
+                (excess == bestExcess && cut < bestCut) )
+            {
+                side = std::move(bisection.side);
+                bestExcess = excess;
+                bestCut = cut;
+            }
+        }
+
+        for( size_t l = levels.size(); l > 0; --l )
+        {
+            const weighted_graph & finer = l > 1 ? levels[l - 2] : g;
+            Bisection bisection(finer, maxWeights);
+            for( unsigned int v = 0; v < finer.getSize(); ++v )
+                bisection.side[v] = side[maps[l - 1][v]];
+            bisection.refine();
+            side = std::move(bisection.side);
+        }
+        return side;
+    }
+
+    /// @brief Function extracting the sub-graph induced by a side.
+    weighted_graph induce( const weighted_graph & g,
+                           const std::vector< unsigned int > & side,
+                           unsigned int s,
+                           const std::vector< unsigned int > & ids,
+                           std::vector< unsigned int > & subIds )
+    {
+        std::vector< unsigned int > local(g.getSize(), none);
+        weighted_graph sub;
+        subIds.clear();
+        for( unsigned int v = 0; v < g.getSize(); ++v )
+        {
+            if( side[v] != s ) continue;
+            local[v] = sub.getSize();
+            sub.nodeWeights.push_back(g.nodeWeights[v]);
+            subIds.push_back(ids[v]);
+        }
+        sub.offsets.assign(1, 0);
+        for( unsigned int v = 0; v < g.getSize(); ++v )
+        {
+            if( side[v] != s ) continue;
+            for( unsigned int i = g.offsets[v]; i < g.offsets[v + 1]; ++i )
+            {
+                if( local[g.targets[i]] == none ) continue;
+                sub.targets.push_back(local[g.targets[i]]);
+                sub.weights.push_back(g.weights[i]);
+            }
+            sub.offsets.push_back(static_cast< unsigned int >(
+                    sub.targets.size()));
+        }
+        return sub;
+    }
+
+    void partitionRecursively( const weighted_graph & g,
+                               const std::vector< unsigned int > & ids,
+                               unsigned int first, unsigned int parts,
+                               double imbalance, Random & random,
+                               std::vector< unsigned int > & result )
+    {
+        if( parts == 1 || g.getSize() == 0 )
+        {
+            for( auto id : ids ) result[id] = first;
+            return;
+        }
+        unsigned int left = parts / 2;
+        std::vector< unsigned int > side = bisect(
+                g, static_cast< double >(left) / parts, imbalance, random);
+
+        std::vector< unsigned int > subIds;
+        weighted_graph sub = induce(g, side, 0, ids, subIds);
+        partitionRecursively(sub, subIds, first, left, imbalance, random,
+                             result);
+        sub = induce(g, side, 1, ids, subIds);
+        partitionRecursively(sub, subIds, first + left, parts - left,
+                             imbalance, random, result);
+    }
+
+    void checkWeights( const compact_adjacency & adjacency,
+                       const std::vector< double > & weights )
+    {
+        if( weights.empty() ) return;
+        if( adjacency.edges.size() != adjacency.targets.size() )
+            messageError("The adjacency has no edge indexes.");
+        for( auto e : adjacency.edges )
+        {
+            if( e >= weights.size() )
+                messageError("Missing weight of edge " + std::to_string(e));
+            if( weights[e] < 0 )
+                messageError("Negative weight of edge " + std::to_string(e));
+        }
+    }
+
+}
+
+std::vector< unsigned int > chase::partitionGraph(
+        const compact_adjacency & adjacency,
+        const std::vector< double > & weights,
+        unsigned int parts,
+        double imbalance,
+        const std::vector< unsigned int > & nodeWeights,
+        uint64_t seed )
+{
+    CHASE_PROFILE_SCOPE("partitionGraph");
+    if( parts == 0 ) messageError("The number of parts must be positive.");
+    if( imbalance < 0 ) messageError("The imbalance must not be negative.");
+    unsigned int size = adjacency.getSize();
+    if( ! nodeWeights.empty() && nodeWeights.size() != size )
+        messageError("The node weights do not match the graph.");
+    checkWeights(adjacency, weights);
+
+    // The imbalance of every bisection compounds along the recursion.
+    double levels = std::ceil(std::log2(static_cast< double >(parts)));
+    double bisectionImbalance = levels > 0 ?
+            std::pow(1 + imbalance, 1 / levels) - 1 : imbalance;
+
+    weighted_graph g = symmetrize(adjacency, weights, nodeWeights);
+    std::vector< unsigned int > ids(size);
+    for( unsigned int v = 0; v < size; ++v ) ids[v] = v;
+    std::vector< unsigned int > result(size, 0);
+    Random random(seed);
+    partitionRecursively(g, ids, 0, parts, bisectionImbalance, random,
+                         result);
+    return result;
+}
+
+double chase::getCutWeight( const compact_adjacency & adjacency,
+                            const std::vector< double > & weights,
+                            const std::vector< unsigned int > & partition )
+{
+    if( partition.size() != adjacency.getSize() )
+        messageError("The partition does not match the graph.");
+    if( adjacency.edges.size() != adjacency.targets.size() )
+        messageError("The adjacency has no edge indexes.");
+    checkWeights(adjacency, weights);
+
+    // Undirected edges appear in two rows with the same index.
+    std::vector< char > counted;
+    double cut = 0;
+    for( unsigned int v = 0; v < adjacency.getSize(); ++v )
+    {
+        for( unsigned int i = adjacency.offsets[v];
+             i < adjacency.offsets[v + 1]; ++i )
+        {
+            unsigned int e = adjacency.edges[i];
+            if( partition[v] == partition[adjacency.targets[i]] ) continue;
+            if( e >= counted.size() ) counted.resize(e + 1, 0);
+            if( counted[e] ) continue;
+            counted[e] = 1;
+            cut += weights.empty() ? 1.0 : weights[e];
+        }
+    }
+    return cut;
+}
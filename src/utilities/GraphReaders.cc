@@ -0,0 +1,148 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/GraphReaders.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+using namespace chase;
+
+namespace {
+
+    bool isBlank( char c )
+    {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    /// @brief Parser of the lines of an edge list.
+    class EdgeListParser {
+    public:
+        EdgeListParser() :
+            sources(),
+            targets(),
+            weights(),
+            size(0),
+            _line(0),
+            _weighted(false)
+        {
+        }
+
+        /// @brief Function parsing a line, from begin to end (excluded).
+        void parse( const char * begin, const char * end )
+        {
+            ++_line;
+            const char * p = begin;
+            while( p < end && isBlank(*p) ) ++p;
+            if( p == end || *p == '#' || *p == '%' ) return;
+
+            unsigned int source = _parseIndex(p, end);
+            unsigned int target = _parseIndex(p, end);
+            while( p < end && isBlank(*p) ) ++p;
+            bool weighted = p < end;
+            if( sources.empty() ) _weighted = weighted;
+            else if( weighted != _weighted )
+                messageError("Edge list with and without weights, at line " +
+                             std::to_string(_line));
+            if( weighted )
+            {
+                // The token is copied, since strtod needs a terminator.
+                std::string token(p, end);
+                char * last = nullptr;
+                double weight = std::strtod(token.c_str(), &last);
+                while( *last != '\0' && isBlank(*last) ) ++last;
+                if( last == token.c_str() || *last != '\0' ) _error();
+                weights.push_back(weight);
+            }
+            sources.push_back(source);
+            targets.push_back(target);
+            if( source >= size ) size = source + 1;
+            if( target >= size ) size = target + 1;
+        }
+
+        std::vector< unsigned int > sources;
+        std::vector< unsigned int > targets;
+        std::vector< double > weights;
+        unsigned int size;
+
+    protected:
+        size_t _line;
+        bool _weighted;
+
+        unsigned int _parseIndex( const char *& p, const char * end )
+        {
+            while( p < end && isBlank(*p) ) ++p;
+            if( p == end || *p < '0' || *p > '9' ) _error();
+            unsigned long long value = 0;
+            while( p < end && *p >= '0' && *p <= '9' )
+            {
+                value = value * 10 + static_cast< unsigned int >(*p - '0');
+                if( value >= 0xffffffffull ) _error();
+                ++p;
+            }
+            if( p < end && ! isBlank(*p) ) _error();
+            return static_cast< unsigned int >(value);
+        }
+
+        [[noreturn]] void _error()
+        {
+            messageError("Malformed edge list, at line " +
+                         std::to_string(_line));
+        }
+    };
+
+}
+
+Graph * chase::readEdgeList( std::istream & in, bool directed, Name * name )
+{
+    CHASE_PROFILE_SCOPE("readEdgeList");
+    EdgeListParser parser;
+    std::vector< char > block(1 << 16);
+    // Bytes of a line not terminated at the end of the previous block.
+    std::string partial;
+    while( in )
+    {
+        in.read(block.data(), static_cast< std::streamsize >(block.size()));
+        auto read = static_cast< size_t >(in.gcount());
+        const char * p = block.data();
+        const char * end = p + read;
+        while( p < end )
+        {
+            const char * newline = p;
+            while( newline < end && *newline != '\n' ) ++newline;
+            if( newline == end )
+            {
+                partial.append(p, end);
+                break;
+            }
+            if( partial.empty() ) parser.parse(p, newline);
+            else
+            {
+                partial.append(p, newline);
+                parser.parse(partial.data(), partial.data() + partial.size());
+                partial.clear();
+            }
+            p = newline + 1;
+        }
+    }
+    if( ! partial.empty() )
+        parser.parse(partial.data(), partial.data() + partial.size());
+
+    return new Graph(parser.size, std::move(parser.sources),
+                     std::move(parser.targets), std::move(parser.weights),
+                     directed, name);
+}
+
+Graph * chase::readEdgeList( const std::string & path, bool directed )
+{
+    std::ifstream in(path, std::ios::binary);
+    if( ! in ) messageError("Cannot open file: " + path);
+    return readEdgeList(in, directed, new Name(path));
+}
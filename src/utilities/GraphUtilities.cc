@@ -7,10 +7,140 @@
 
 #include "utilities/GraphUtilities.hh"
 #include "representation.hh"
+#include "utilities/Profiler.hh"
 #include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
 
 using namespace chase;
 
+namespace {
+
+    const unsigned int none = std::numeric_limits< unsigned int >::max();
+
+    unsigned int tarjan( const compact_adjacency & adjacency,
+                         std::vector< unsigned int > & component )
+    {
+        unsigned int size = adjacency.getSize();
+        std::vector< unsigned int > index(size, none);
+        std::vector< unsigned int > low(size, 0);
+        std::vector< unsigned int > stack;
+        std::vector< std::pair< unsigned int, unsigned int > > calls;
+        unsigned int counter = 0;
+        unsigned int components = 0;
+
+        for( unsigned int root = 0; root < size; ++root )
+        {
+            if( index[root] != none ) continue;
+            index[root] = low[root] = counter++;
+            stack.push_back(root);
+            calls.emplace_back(root, adjacency.offsets[root]);
+
+            while( ! calls.empty() )
+            {
+                unsigned int v = calls.back().first;
+                unsigned int & next = calls.back().second;
+                if( next < adjacency.offsets[v + 1] )
+                {
+                    unsigned int w = adjacency.targets[next++];
+                    if( index[w] == none )
+                    {
+                        index[w] = low[w] = counter++;
+                        stack.push_back(w);
+                        calls.emplace_back(w, adjacency.offsets[w]);
+                    }
+                    // Visited nodes without component are on the stack.
+                    else if( component[w] == none )
+                        low[v] = std::min(low[v], index[w]);
+                    continue;
+                }
+
+                calls.pop_back();
+                if( low[v] == index[v] )
+                {
+                    // Components are completed after the ones they reach.
+                    unsigned int w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        component[w] = components;
+                    } while( w != v );
+                    ++components;
+                }
+                if( ! calls.empty() )
+                {
+                    unsigned int parent = calls.back().first;
+                    low[parent] = std::min(low[parent], low[v]);
+                }
+            }
+        }
+        return components;
+    }
+
+    unsigned int kosaraju( const compact_adjacency & adjacency,
+                           std::vector< unsigned int > & component )
+    {
+        unsigned int size = adjacency.getSize();
+
+        // Nodes in increasing finishing time of a search of the graph.
+        std::vector< unsigned int > finished;
+        finished.reserve(size);
+        std::vector< bool > visited(size, false);
+        std::vector< std::pair< unsigned int, unsigned int > > calls;
+        for( unsigned int root = 0; root < size; ++root )
+        {
+            if( visited[root] ) continue;
+            visited[root] = true;
+            calls.emplace_back(root, adjacency.offsets[root]);
+            while( ! calls.empty() )
+            {
+                unsigned int v = calls.back().first;
+                unsigned int & next = calls.back().second;
+                if( next < adjacency.offsets[v + 1] )
+                {
+                    unsigned int w = adjacency.targets[next++];
+                    if( visited[w] ) continue;
+                    visited[w] = true;
+                    calls.emplace_back(w, adjacency.offsets[w]);
+                    continue;
+                }
+                calls.pop_back();
+                finished.push_back(v);
+            }
+        }
+
+        // Searches of the reversed graph, in decreasing finishing time, find
+        // the components in topological order.
+        compact_adjacency reverse = getReverseAdjacency(adjacency);
+        std::vector< unsigned int > stack;
+        unsigned int components = 0;
+        for( auto it = finished.rbegin(); it != finished.rend(); ++it )
+        {
+            if( component[*it] != none ) continue;
+            component[*it] = components;
+            stack.push_back(*it);
+            while( ! stack.empty() )
+            {
+                unsigned int v = stack.back();
+                stack.pop_back();
+                for( unsigned int i = reverse.offsets[v];
+                     i < reverse.offsets[v + 1]; ++i )
+                {
+                    unsigned int w = reverse.targets[i];
+                    if( component[w] != none ) continue;
+                    component[w] = components;
+                    stack.push_back(w);
+                }
+            }
+            ++components;
+        }
+        for( auto & c : component ) c = components - 1 - c;
+        return components;
+    }
+
+}
+
 void chase::findAllPathsBetweenNodes(
         Graph * graph,
         std::vector< unsigned int >& visited,
@@ -40,6 +170,7 @@ void chase::findAllPathsBetweenNodes(
                 found_path.push_back(visited[hop]);
             }
             result.push_back(found_path);
+            CHASE_PROFILE_COUNT("findAllPathsBetweenNodes::paths", 1);
             size_t n = visited.size() - 1;
             visited.erase(visited.begin() + n);
             break;
@@ -63,58 +194,205 @@ void chase::findAllPathsBetweenNodes(
 
 Graph * chase::getSubGraph(Graph * graph, std::set< Vertex * > vertexes)
 {
+    CHASE_PROFILE_SCOPE("getSubGraph");
     Graph * ret = new Graph(vertexes.size(), graph->isDirected());
 
+    // Nodes of the original graph, and their indexes in the sub-graph.
+    std::vector< int > originals;
+    std::unordered_map< unsigned int, unsigned int > indexes;
+    originals.reserve(vertexes.size());
+    indexes.reserve(vertexes.size());
+
     unsigned index = 0;
     for( auto v = vertexes.begin(); v != vertexes.end(); ++v)
     {
         std::string name = (*v)->getName()->getString();
         ret->associateVertex(index, new Vertex(new Name(name)));
+        int original = graph->getVertexIndex(name);
+        originals.push_back(original);
+        if( original >= 0 )
+            indexes.emplace(static_cast< unsigned int >(original), index);
         ++index;
     }
 
-    for( size_t i = 0; i < vertexes.size()-1; ++i )
-        for( size_t j = 1; j < vertexes.size(); ++j )
+    // Every edge between two preserved nodes is reached once, from its
+    // source. The edges loaded in bulk are copied from their arrays, without
+    // creating their objects.
+    const compact_adjacency & adjacency = graph->getAdjacency();
+    const std::vector< double > & weights = graph->getBulkWeights();
+    for( unsigned int i = 0; i < originals.size(); ++i )
+    {
+        if( originals[i] < 0 ) continue;
+        auto source = static_cast< unsigned int >(originals[i]);
+        for( unsigned int j = adjacency.offsets[source];
+             j < adjacency.offsets[source + 1]; ++j )
         {
-            std::string name_first(ret->getVertex(i)->getName()->getString());
-            std::string name_second(ret->getVertex(j)->getName()->getString());
-            int index_first = graph->getVertexIndex(name_first);
-            int index_second = graph->getVertexIndex(name_second);
-
-            if( index_first < 0 || index_second < 0) continue;
-
-            Edge * edge = graph->getEdge(index_first, index_second);
-            WeightedEdge * wedge = dynamic_cast<WeightedEdge*>(edge);
-            bool weighted = (wedge != nullptr);
-
-            if(edge != nullptr) {
-                if (weighted) {
-                    auto id = dynamic_cast< Identifier * >(wedge->getWeight());
-                    if(id)
-                        ret->addEdge(new WeightedEdge(i,j,
-                            new Identifier(id->getDeclaration())));
-                }
-                else {
-                    ret->addEdge(new Edge(i, j));
-                }
+            unsigned int e = adjacency.edges[j];
+            if( graph->getEdgeSource(e) != source ) continue;
+            auto target = indexes.find(adjacency.targets[j]);
+            if( target == indexes.end() ) continue;
+
+            if( e < graph->getBulkEdgesCount() )
+            {
+                if( weights.empty() )
+                    ret->addEdge(new Edge(i, target->second));
+                else
+                    ret->addEdge(new WeightedEdge(i, target->second,
+                                                  new RealValue(weights[e])));
+                continue;
             }
+            auto wedge = dynamic_cast< WeightedEdge * >(graph->getEdgeAt(e));
+            if( wedge != nullptr && wedge->getWeight() != nullptr )
+                ret->addEdge(new WeightedEdge(i, target->second,
+                                              wedge->getWeight()->clone()));
+            else
+                ret->addEdge(new Edge(i, target->second));
+        }
+    }
 
-            edge = graph->getEdge(index_second, index_first);
+    return ret;
+}
 
-            if(edge != nullptr) {
-                if (weighted) {
-                    auto id = dynamic_cast< Identifier * >(wedge->getWeight());
-                    if(id)
-                        ret->addEdge(new WeightedEdge(j,i,
-                            new Identifier(id->getDeclaration())));
-                }
-                else {
-                    ret->addEdge(new Edge(j,i));
-                }
-            }
+unsigned int chase::getStronglyConnectedComponents(
+        const compact_adjacency & adjacency,
+        std::vector< unsigned int > & component,
+        scc_algorithm algorithm )
+{
+    CHASE_PROFILE_SCOPE("getStronglyConnectedComponents");
+    component.assign(adjacency.getSize(), none);
+    if( algorithm == kosaraju_scc ) return kosaraju(adjacency, component);
+    return tarjan(adjacency, component);
+}
 
+compact_adjacency chase::getReverseAdjacency(
+        const compact_adjacency & adjacency )
+{
+    unsigned int size = adjacency.getSize();
+    compact_adjacency reverse;
+    reverse.offsets.assign(size + 1, 0);
+    for( auto t : adjacency.targets ) ++reverse.offsets[t + 1];
+    for( unsigned int v = 0; v < size; ++v )
+        reverse.offsets[v + 1] += reverse.offsets[v];
 
+    reverse.targets.resize(adjacency.targets.size());
+    reverse.edges.resize(adjacency.edges.size());
+    std::vector< unsigned int > next(reverse.offsets.begin(),
+                                     reverse.offsets.end() - 1);
+    for( unsigned int v = 0; v < size; ++v )
+    {
+        for( unsigned int i = adjacency.offsets[v];
+             i < adjacency.offsets[v + 1]; ++i )
+        {
+            unsigned int slot = next[adjacency.targets[i]]++;
+            reverse.targets[slot] = v;
+            if( ! adjacency.edges.empty() )
+                reverse.edges[slot] = adjacency.edges[i];
         }
+    }
+    return reverse;
+}
 
-    return ret;
+compact_adjacency chase::getCondensation(
+        const compact_adjacency & adjacency,
+        const std::vector< unsigned int > & component,
+        unsigned int count )
+{
+    CHASE_PROFILE_SCOPE("getCondensation");
+    unsigned int size = adjacency.getSize();
+
+    // Nodes sorted by component.
+    std::vector< unsigned int > first(count + 1, 0);
+    for( unsigned int v = 0; v < size; ++v ) ++first[component[v] + 1];
+    for( unsigned int c = 0; c < count; ++c ) first[c + 1] += first[c];
+    std::vector< unsigned int > members(size);
+    std::vector< unsigned int > next(first.begin(), first.end() - 1);
+    for( unsigned int v = 0; v < size; ++v )
+        members[next[component[v]]++] = v;
+
+    compact_adjacency dag;
+    dag.offsets.reserve(count + 1);
+    dag.offsets.push_back(0);
+    std::vector< unsigned int > last(count, none);
+    for( unsigned int c = 0; c < count; ++c )
+    {
+        for( unsigned int m = first[c]; m < first[c + 1]; ++m )
+        {
+            unsigned int v = members[m];
+            for( unsigned int i = adjacency.offsets[v];
+                 i < adjacency.offsets[v + 1]; ++i )
+            {
+                unsigned int d = component[adjacency.targets[i]];
+                if( d == c || last[d] == c ) continue;
+                last[d] = c;
+                dag.targets.push_back(d);
+                dag.edges.push_back(adjacency.edges.empty() ?
+                                    i : adjacency.edges[i]);
+            }
+        }
+        dag.offsets.push_back(static_cast< unsigned int >(dag.targets.size()));
+    }
+    return dag;
+}
+
+bool chase::getTopologicalOrder(
+        const compact_adjacency & adjacency,
+        std::vector< unsigned int > & order,
+        std::vector< unsigned int > & cycle )
+{
+    CHASE_PROFILE_SCOPE("getTopologicalOrder");
+    unsigned int size = adjacency.getSize();
+    order.clear();
+    cycle.clear();
+    order.reserve(size);
+
+    std::vector< unsigned int > degree(size, 0);
+    for( auto t : adjacency.targets ) ++degree[t];
+    for( unsigned int v = 0; v < size; ++v )
+        if( degree[v] == 0 ) order.push_back(v);
+    // The order doubles as the queue of the Kahn algorithm.
+    for( size_t head = 0; head < order.size(); ++head )
+    {
+        unsigned int v = order[head];
+        for( unsigned int i = adjacency.offsets[v];
+             i < adjacency.offsets[v + 1]; ++i )
+            if( --degree[adjacency.targets[i]] == 0 )
+                order.push_back(adjacency.targets[i]);
+    }
+    if( order.size() == size ) return true;
+
+    // The nodes left have a positive degree: a search among them finds an
+    // edge back to a node on the search stack, closing a cycle.
+    std::vector< unsigned char > state(size, 0);   // 1: on stack, 2: done.
+    std::vector< std::pair< unsigned int, unsigned int > > calls;
+    for( unsigned int root = 0; root < size && cycle.empty(); ++root )
+    {
+        if( degree[root] == 0 || state[root] != 0 ) continue;
+        state[root] = 1;
+        calls.emplace_back(root, adjacency.offsets[root]);
+        while( ! calls.empty() && cycle.empty() )
+        {
+            unsigned int v = calls.back().first;
+            unsigned int & next = calls.back().second;
+            if( next == adjacency.offsets[v + 1] )
+            {
+                state[v] = 2;
+                calls.pop_back();
+                continue;
+            }
+            unsigned int w = adjacency.targets[next++];
+            if( degree[w] == 0 || state[w] == 2 ) continue;
+            if( state[w] == 0 )
+            {
+                state[w] = 1;
+                calls.emplace_back(w, adjacency.offsets[w]);
+                continue;
+            }
+            // Back edge v -> w: the cycle is the stack from w to v.
+            size_t start = calls.size();
+            while( calls[start - 1].first != w ) --start;
+            for( size_t i = start - 1; i < calls.size(); ++i )
+                cycle.push_back(calls[i].first);
+        }
+    }
+    return false;
 }
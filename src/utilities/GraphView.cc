@@ -0,0 +1,167 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/GraphView.hh"
+#include "representation/RealValue.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+
+#include <algorithm>
+
+using namespace chase;
+
+GraphView::GraphView( Graph * graph ) :
+    _graph(graph),
+    _adjacency(&graph->getAdjacency()),
+    _all(true),
+    _nodes(),
+    _members()
+{
+}
+
+GraphView::GraphView( Graph * graph,
+                      const std::vector< unsigned int > & nodes ) :
+    _graph(graph),
+    _adjacency(&graph->getAdjacency()),
+    _all(false),
+    _nodes(),
+    _members()
+{
+    _select(nodes);
+}
+
+GraphView::GraphView( Graph * graph, const std::set< Vertex * > & vertexes ) :
+    _graph(graph),
+    _adjacency(&graph->getAdjacency()),
+    _all(false),
+    _nodes(),
+    _members()
+{
+    std::vector< unsigned int > nodes;
+    nodes.reserve(vertexes.size());
+    for( auto vertex : vertexes )
+    {
+        int node = graph->getVertexIndex(vertex->getName()->getString());
+        if( node >= 0 ) nodes.push_back(static_cast< unsigned int >(node));
+    }
+    _select(std::move(nodes));
+}
+
+void GraphView::_select( std::vector< unsigned int > nodes )
+{
+    unsigned int size = _graph->getSize();
+    _members.assign((size + 63) / 64, 0);
+    for( auto node : nodes )
+    {
+        if( node >= size )
+            messageError("Node out of the graph: " + std::to_string(node));
+        _members[node / 64] |= uint64_t(1) << (node % 64);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    _nodes.swap(nodes);
+}
+
+Graph * GraphView::getGraph() const
+{
+    return _graph;
+}
+
+bool GraphView::isDirected() const
+{
+    return _graph->isDirected();
+}
+
+unsigned int GraphView::getSize() const
+{
+    return _all ? _graph->getSize() : static_cast< unsigned int >(_nodes.size());
+}
+
+unsigned int GraphView::getNode( unsigned int local ) const
+{
+    return _all ? local : _nodes[local];
+}
+
+bool GraphView::contains( unsigned int node ) const
+{
+    if( _all ) return node < _graph->getSize();
+    if( node / 64 >= _members.size() ) return false;
+    return (_members[node / 64] >> (node % 64)) & 1;
+}
+
+int GraphView::getLocalIndex( unsigned int node ) const
+{
+    if( ! contains(node) ) return -1;
+    if( _all ) return static_cast< int >(node);
+    auto it = std::lower_bound(_nodes.begin(), _nodes.end(), node);
+    return static_cast< int >(it - _nodes.begin());
+}
+
+std::vector< unsigned int > GraphView::getNeighbors( unsigned int local ) const
+{
+    std::vector< unsigned int > neighbors;
+    forEachNeighbor(local, [&neighbors](unsigned int n, unsigned int) {
+        neighbors.push_back(n);
+    });
+    return neighbors;
+}
+
+compact_adjacency GraphView::getAdjacency() const
+{
+    if( _all ) return *_adjacency;
+    CHASE_PROFILE_SCOPE("GraphView::getAdjacency");
+
+    compact_adjacency ret;
+    ret.offsets.reserve(_nodes.size() + 1);
+    ret.offsets.push_back(0);
+    for( unsigned int local = 0; local < _nodes.size(); ++local )
+    {
+        forEachNeighbor(local, [&ret](unsigned int n, unsigned int e) {
+            ret.targets.push_back(n);
+            ret.edges.push_back(e);
+        });
+        ret.offsets.push_back(static_cast< unsigned int >(ret.targets.size()));
+    }
+    return ret;
+}
+
+Graph * GraphView::materialize() const
+{
+    CHASE_PROFILE_SCOPE("GraphView::materialize");
+    unsigned int size = getSize();
+    auto ret = new Graph(size, _graph->isDirected(),
+                         _graph->getName()->clone());
+
+    for( unsigned int local = 0; local < size; ++local )
+    {
+        Vertex * vertex = _graph->getVertex(getNode(local));
+        if( vertex != nullptr ) ret->associateVertex(local, vertex->clone());
+    }
+
+    // Every edge is copied once, from its source. The edges loaded in bulk
+    // are copied from their arrays, without creating their objects.
+    const std::vector< double > & weights = _graph->getBulkWeights();
+    for( unsigned int local = 0; local < size; ++local )
+    {
+        unsigned int node = getNode(local);
+        forEachNeighbor(local, [&](unsigned int target, unsigned int e) {
+            if( _graph->getEdgeSource(e) != node ) return;
+            Edge * copy;
+            if( e >= _graph->getBulkEdgesCount() )
+                copy = _graph->getEdgeAt(e)->clone();
+            else if( weights.empty() )
+                copy = new Edge(local, target);
+            else
+                copy = new WeightedEdge(local, target,
+                                        new RealValue(weights[e]));
+            copy->setSource(local);
+            copy->setTarget(target);
+            ret->addEdge(copy);
+        });
+    }
+    return ret;
+}
@@ -0,0 +1,281 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/GraphWriters.hh"
+#include "utilities/Profiler.hh"
+
+#include <cstring>
+#include <limits>
+
+using namespace chase;
+
+namespace {
+
+    const unsigned int none = std::numeric_limits< unsigned int >::max();
+
+    /// @brief Writer collecting the output in a fixed-size buffer, which is
+    /// passed to the stream when full, so that the stream is called once per
+    /// block instead of once per token.
+    class BufferedWriter {
+    public:
+        explicit BufferedWriter( std::ostream & out ) :
+            _out(out),
+            _buffer(size),
+            _used(0)
+        {
+        }
+
+        ~BufferedWriter()
+        {
+            flush();
+        }
+
+        void write( const char * s, size_t n )
+        {
+            if( n > size - _used )
+            {
+                flush();
+                if( n > size )
+                {
+                    _out.write(s, static_cast< std::streamsize >(n));
+                    return;
+                }
+            }
+            std::memcpy(&_buffer[_used], s, n);
+            _used += n;
+        }
+
+        void write( const char * s )
+        {
+            write(s, std::strlen(s));
+        }
+
+        void write( const std::string & s )
+        {
+            write(s.data(), s.size());
+        }
+
+        void write( unsigned int n )
+        {
+            char digits[10];
+            size_t i = sizeof(digits);
+            do {
+                digits[--i] = static_cast< char >('0' + n % 10);
+                n /= 10;
+            } while( n != 0 );
+            write(digits + i, sizeof(digits) - i);
+        }
+
+        /// @brief Function writing a string escaped for a quoted DOT
+        /// identifier.
+        void writeGraphViz( const std::string & s )
+        {
+            for( char c : s )
+            {
+                if( c == '"' || c == '\\' ) write("\\", 1);
+                if( c == '\n' ) write("\\n", 2);
+                else write(&c, 1);
+            }
+        }
+
+        /// @brief Function writing a string escaped for XML.
+        void writeXml( const std::string & s )
+        {
+            for( char c : s )
+            {
+                switch( c )
+                {
+                    case '&': write("&amp;"); break;
+                    case '<': write("&lt;"); break;
+                    case '>': write("&gt;"); break;
+                    case '"': write("&quot;"); break;
+                    case '\'': write("&apos;"); break;
+                    default: write(&c, 1);
+                }
+            }
+        }
+
+        void flush()
+        {
+            if( _used == 0 ) return;
+            _out.write(_buffer.data(), static_cast< std::streamsize >(_used));
+            _used = 0;
+        }
+
+    protected:
+        static const size_t size = 1 << 16;
+        std::ostream & _out;
+        std::vector< char > _buffer;
+        size_t _used;
+    };
+
+    unsigned int clusterOf( const std::vector< unsigned int > * clusters,
+                            unsigned int node )
+    {
+        if( clusters == nullptr || node >= clusters->size() ) return none;
+        return (*clusters)[node];
+    }
+
+    /// @brief Function providing the text of the weight of an edge, without
+    /// creating the objects of the edges loaded in bulk.
+    bool getWeight( Graph * graph, unsigned int e, std::string & text )
+    {
+        if( e < graph->getBulkEdgesCount() )
+        {
+            const std::vector< double > & weights = graph->getBulkWeights();
+            if( weights.empty() ) return false;
+            // As RealValue::getString.
+            text = std::to_string(weights[e]);
+            text.erase(text.find_last_not_of('0') + 1, std::string::npos);
+            return true;
+        }
+        auto weighted = dynamic_cast< WeightedEdge * >(graph->getEdgeAt(e));
+        if( weighted == nullptr || weighted->getWeight() == nullptr )
+            return false;
+        text = weighted->getWeight()->getString();
+        return true;
+    }
+
+}
+
+void chase::writeGraphViz( Graph * graph, std::ostream & out,
+                           const std::vector< unsigned int > * clusters )
+{
+    CHASE_PROFILE_SCOPE("writeGraphViz");
+    BufferedWriter writer(out);
+    writer.write(graph->isDirected() ? "digraph \"" : "graph \"");
+    writer.writeGraphViz(graph->getName()->getString());
+    writer.write("\" {\n");
+
+    // Runs of nodes of the same cluster share a subgraph statement: DOT
+    // merges the subgraphs having the same name.
+    unsigned int open = none;
+    for( unsigned int node = 0; node < graph->getSize(); ++node )
+    {
+        unsigned int cluster = clusterOf(clusters, node);
+        if( cluster != open )
+        {
+            if( open != none ) writer.write("\t}\n");
+            if( cluster != none )
+            {
+                writer.write("\tsubgraph cluster_");
+                writer.write(cluster);
+                writer.write(" {\n\t\tlabel=\"");
+                writer.write(cluster);
+                writer.write("\";\n");
+            }
+            open = cluster;
+        }
+        writer.write(open != none ? "\t\t" : "\t");
+        writer.write(node);
+        Vertex * vertex = graph->getVertex(node);
+        if( vertex != nullptr )
+        {
+            writer.write(" [label=\"");
+            writer.writeGraphViz(vertex->getName()->getString());
+            writer.write("\"]");
+        }
+        writer.write(";\n");
+    }
+    if( open != none ) writer.write("\t}\n");
+
+    const char * arrow = graph->isDirected() ? " -> " : " -- ";
+    std::string weight;
+    for( unsigned int e = 0; e < graph->getEdgesCount(); ++e )
+    {
+        writer.write("\t");
+        writer.write(graph->getEdgeSource(e));
+        writer.write(arrow);
+        writer.write(graph->getEdgeTarget(e));
+        if( getWeight(graph, e, weight) )
+        {
+            writer.write(" [label=\"");
+            writer.writeGraphViz(weight);
+            writer.write("\"]");
+        }
+        writer.write(";\n");
+    }
+    writer.write("}\n");
+}
+
+void chase::writeGraphML( Graph * graph, std::ostream & out,
+                          const std::vector< unsigned int > * clusters )
+{
+    CHASE_PROFILE_SCOPE("writeGraphML");
+    BufferedWriter writer(out);
+    writer.write(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n"
+        "  <key id=\"label\" for=\"node\" attr.name=\"label\""
+        " attr.type=\"string\"/>\n"
+        "  <key id=\"cluster\" for=\"node\" attr.name=\"cluster\""
+        " attr.type=\"int\"/>\n"
+        "  <key id=\"weight\" for=\"edge\" attr.name=\"weight\""
+        " attr.type=\"string\"/>\n"
+        "  <graph id=\"");
+    writer.writeXml(graph->getName()->getString());
+    writer.write(graph->isDirected() ? "\" edgedefault=\"directed\">\n" :
+                                       "\" edgedefault=\"undirected\">\n");
+
+    for( unsigned int node = 0; node < graph->getSize(); ++node )
+    {
+        writer.write("    <node id=\"n");
+        writer.write(node);
+        Vertex * vertex = graph->getVertex(node);
+        unsigned int cluster = clusterOf(clusters, node);
+        if( vertex == nullptr && cluster == none )
+        {
+            writer.write("\"/>\n");
+            continue;
+        }
+        writer.write("\">");
+        if( vertex != nullptr )
+        {
+            writer.write("<data key=\"label\">");
+            writer.writeXml(vertex->getName()->getString());
+            writer.write("</data>");
+        }
+        if( cluster != none )
+        {
+            writer.write("<data key=\"cluster\">");
+            writer.write(cluster);
+            writer.write("</data>");
+        }
+        writer.write("</node>\n");
+    }
+
+    std::string weight;
+    for( unsigned int e = 0; e < graph->getEdgesCount(); ++e )
+    {
+        writer.write("    <edge source=\"n");
+        writer.write(graph->getEdgeSource(e));
+        writer.write("\" target=\"n");
+        writer.write(graph->getEdgeTarget(e));
+        if( ! getWeight(graph, e, weight) )
+        {
+            writer.write("\"/>\n");
+            continue;
+        }
+        writer.write("\"><data key=\"weight\">");
+        writer.writeXml(weight);
+        writer.write("</data></edge>\n");
+    }
+    writer.write("  </graph>\n</graphml>\n");
+}
+
+std::string chase::escapeGraphViz( const std::string & s )
+{
+    std::string ret;
+    ret.reserve(s.size());
+    for( char c : s )
+    {
+        if( c == '"' || c == '\\' ) ret += '\\';
+        if( c == '\n' ) ret += "\\n";
+        else ret += c;
+    }
+    return ret;
+}
@@ -10,49 +10,128 @@
 
 #include "utilities/IOUtils.hh"
 
+#include <atomic>
+#include <mutex>
+#include <sstream>
+
 namespace chase{
 
+    namespace {
+
+        /// @brief Number of messages of each severity.
+        std::atomic< size_t > counters[3];
+
+        /// @brief The mutex protecting the global sink and the streams.
+        std::mutex sinkMutex;
+
+        /// @brief The global sink, empty for the default one.
+        diagnostic_sink globalSink;
+
+        /// @brief The sink of the calling thread.
+        thread_local diagnostic_sink threadSink;
+
+        /// @brief Function formatting the header of a message, with the
+        /// local time (reentrant version of ctime).
+        std::string formatTime(time_t now)
+        {
+            struct tm local{};
+#ifdef _WIN32
+            localtime_s(&local, &now);
+#else
+            localtime_r(&now, &local);
+#endif
+            char buffer[32];
+            strftime(buffer, sizeof(buffer), "%a %b %e %H:%M:%S %Y", &local);
+            return std::string(buffer);
+        }
+
+        /// @brief Function formatting a message.
+        std::string formatMessage(const diagnostic_message & message)
+        {
+            static const char * prefixes[] =
+                    { "INFO:\t", "WARNING:\t", "ERROR:  \t" };
+            std::ostringstream str;
+            str << prefixes[message.severity] << formatTime(message.time)
+                << " || " << message.text << std::endl;
+            if( message.object != nullptr )
+            {
+                str <<
+                    "---------------------- Object --------------------" << std::endl <<
+                    "--------------------------------------------------" << std::endl;
+            }
+            return str.str();
+        }
+
+        /// @brief Function delivering a message to the sinks.
+        void dispatch(message_severity severity, const char * msg,
+                      ChaseObject * object)
+        {
+            ++counters[severity];
+            diagnostic_message message{severity, msg, object, time(nullptr)};
+
+            if( threadSink )
+            {
+                threadSink(message);
+                return;
+            }
+
+            std::unique_lock< std::mutex > lock(sinkMutex);
+            if( globalSink )
+            {
+                // The sink is copied, so that it can be replaced while
+                // running.
+                diagnostic_sink sink = globalSink;
+                lock.unlock();
+                sink(message);
+                return;
+            }
+            std::ostream & str =
+                    severity == severity_info ? std::cout : std::cerr;
+            str << formatMessage(message) << std::flush;
+        }
+
+    }
+
+    ChaseError::ChaseError(const std::string & msg, ChaseObject * object) :
+        std::runtime_error(msg),
+        _object(object)
+    {
+    }
+
+    ChaseObject * ChaseError::getObject() const
+    {
+        return _object;
+    }
+
     /// @brief Implementation of the baseMessage function.
     void baseMessage(
             const char * msg,
             ChaseObject * object,
             std::ostream &str )
     {
-        time_t now = time(NULL);
-
-        char * t = strtok(ctime(&now), "\n");
-        str <<  t << " || ";
-
-        str << msg << std::endl;
-        if( object != nullptr )
-        {
-            str << 
-                "---------------------- Object --------------------" << std::endl <<
-                // object->getString() << std:endl <<
-                "--------------------------------------------------" << std::endl;
-        }
+        diagnostic_message message{severity_info, msg, object, time(nullptr)};
+        std::string line = formatMessage(message);
+        // Skip the prefix: the callers print their own.
+        str << line.substr(line.find('\t') + 1);
     }
 
     void messageError(
             const char * msg, ChaseObject * object )
     {
-        std::cerr << "ERROR:  \t";
-        baseMessage(msg, object, std::cerr);
-        exit(-1);
+        dispatch(severity_error, msg, object);
+        throw ChaseError(msg, object);
     }
 
     void messageInfo(
             const char * msg, ChaseObject * object )
     {
-        std::cout << "INFO:\t";
-        baseMessage(msg, object, std::cout);
+        dispatch(severity_info, msg, object);
     }
 
     void messageWarning(
             const char * msg, ChaseObject * object )
     {
-        std::cout << "WARNING:\t";
-        baseMessage(msg, object, std::cerr);
+        dispatch(severity_warning, msg, object);
     }
 
     void messageError( std::string msg, ChaseObject *object)
@@ -70,4 +149,56 @@ namespace chase{
         messageWarning(msg.c_str(), object);
     }
 
+    void setDiagnosticSink(diagnostic_sink sink)
+    {
+        std::lock_guard< std::mutex > lock(sinkMutex);
+        globalSink = std::move(sink);
+    }
+
+    diagnostic_sink setThreadDiagnosticSink(diagnostic_sink sink)
+    {
+        diagnostic_sink previous = std::move(threadSink);
+        threadSink = std::move(sink);
+        return previous;
+    }
+
+    size_t getDiagnosticsCount(message_severity severity)
+    {
+        return counters[severity];
+    }
+
+    void resetDiagnosticsCounters()
+    {
+        for( auto & counter : counters )
+            counter = 0;
+    }
+
+    DiagnosticBuffer::DiagnosticBuffer()
+    {
+        _previous = setThreadDiagnosticSink(
+                [this](const diagnostic_message & message) {
+                    _messages.push_back(message);
+                });
+    }
+
+    DiagnosticBuffer::~DiagnosticBuffer()
+    {
+        setThreadDiagnosticSink(std::move(_previous));
+    }
+
+    const std::vector< diagnostic_message > &
+    DiagnosticBuffer::getMessages() const
+    {
+        return _messages;
+    }
+
+    void DiagnosticBuffer::flush(std::ostream & str)
+    {
+        std::string text;
+        for( auto & message : _messages )
+            text += formatMessage(message);
+        _messages.clear();
+        str << text << std::flush;
+    }
+
 }
@@ -0,0 +1,165 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/InteractionGraph.hh"
+#include "utilities/GraphPartitioning.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+#include "representation/Variable.hh"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace chase;
+
+namespace {
+
+    /// @brief Function building the interaction graph of a system, without
+    /// the vertexes.
+    /// @param system The system.
+    /// @param correspondences The correspondences of the names.
+    /// @param result The structure receiving the contracts, the shared
+    /// variables and the graph.
+    /// @return The graph, owned by the caller.
+    std::unique_ptr< Graph > buildInteractions(
+            System * system, const system_correspondences & correspondences,
+            interaction_graph & result )
+    {
+        std::set< Contract * > & set = system->getContractsSet();
+        result.contracts.assign(set.begin(), set.end());
+        std::stable_sort(result.contracts.begin(), result.contracts.end(),
+                         [](Contract * a, Contract * b) {
+            return a->getName()->getString() < b->getName()->getString();
+        });
+
+        std::unordered_map< std::string, Declaration * > declared;
+        for( auto d : system->getDeclarationsSet() )
+            declared.emplace(d->getName()->getString(), d);
+
+        // The contracts using each variable of the system, in order of
+        // index. The names are ordered, so that the edges are numbered the
+        // same way on every run.
+        std::map< std::string,
+                  std::vector< std::pair< unsigned int, Declaration * > > >
+                users;
+        for( unsigned int c = 0; c < result.contracts.size(); ++c )
+        {
+            Contract * contract = result.contracts[c];
+            auto map = correspondences.find(contract);
+            for( auto d : contract->declarations )
+            {
+                if( dynamic_cast< Variable * >(d) == nullptr ) continue;
+                std::string name = d->getName()->getString();
+                if( map != correspondences.end() )
+                {
+                    auto projected = map->second.find(name);
+                    if( projected != map->second.end() )
+                        name = projected->second;
+                }
+                auto & list = users[name];
+                if( list.empty() || list.back().first != c )
+                    list.emplace_back(c, d);
+            }
+        }
+
+        std::vector< unsigned int > sources;
+        std::vector< unsigned int > targets;
+        std::vector< double > weights;
+        std::unordered_map< uint64_t, unsigned int > edges;
+        for( auto & user : users )
+        {
+            auto & list = user.second;
+            if( list.size() < 2 ) continue;
+            auto system_declaration = declared.find(user.first);
+            Declaration * label = system_declaration != declared.end() ?
+                    system_declaration->second : list[0].second;
+            for( size_t i = 0; i < list.size(); ++i )
+            {
+                for( size_t j = i + 1; j < list.size(); ++j )
+                {
+                    uint64_t key =
+                            uint64_t(list[i].first) << 32 | list[j].first;
+                    auto edge = edges.emplace(
+                            key, static_cast< unsigned int >(sources.size()));
+                    if( edge.second )
+                    {
+                        sources.push_back(list[i].first);
+                        targets.push_back(list[j].first);
+                        weights.push_back(0);
+                        result.shared.emplace_back();
+                    }
+                    weights[edge.first->second] += 1;
+                    result.shared[edge.first->second].push_back(label);
+                }
+            }
+        }
+
+        auto size = static_cast< unsigned int >(result.contracts.size());
+        return std::unique_ptr< Graph >(new Graph(
+                size, std::move(sources), std::move(targets),
+                std::move(weights), false, system->getName()->clone()));
+    }
+
+}
+
+interaction_graph chase::buildInteractionGraph(
+        System * system, const system_correspondences & correspondences )
+{
+    CHASE_PROFILE_SCOPE("buildInteractionGraph");
+    interaction_graph result;
+    std::unique_ptr< Graph > graph = buildInteractions(system,
+                                                       correspondences,
+                                                       result);
+    for( unsigned int c = 0; c < result.contracts.size(); ++c )
+        graph->associateVertex(c, new Vertex(
+                result.contracts[c]->getName()->clone()));
+    result.graph = graph.release();
+    return result;
+}
+
+system_partition chase::partitionSystem(
+        System * system,
+        unsigned int clusters,
+        const system_correspondences & correspondences,
+        double imbalance,
+        uint64_t seed )
+{
+    CHASE_PROFILE_SCOPE("partitionSystem");
+    if( clusters == 0 )
+        messageError("The number of clusters must be positive.", system);
+    if( imbalance < 0 )
+        messageError("The imbalance must not be negative.", system);
+    // The partition needs only the adjacency: no vertex is created.
+    interaction_graph interactions;
+    std::unique_ptr< Graph > graph = buildInteractions(system,
+                                                       correspondences,
+                                                       interactions);
+    interactions.graph = graph.get();
+    const compact_adjacency & adjacency = graph->getAdjacency();
+    const std::vector< double > & weights = graph->getBulkWeights();
+    std::vector< unsigned int > parts = partitionGraph(
+            adjacency, weights, clusters, imbalance,
+            std::vector< unsigned int >(), seed);
+
+    system_partition result;
+    result.clusters.resize(clusters);
+    for( unsigned int c = 0; c < interactions.contracts.size(); ++c )
+        result.clusters[parts[c]].push_back(interactions.contracts[c]);
+    result.cut = getCutWeight(adjacency, weights, parts);
+
+    std::unordered_set< Declaration * > found;
+    for( unsigned int e = 0; e < graph->getEdgesCount(); ++e )
+    {
+        if( parts[graph->getEdgeSource(e)] == parts[graph->getEdgeTarget(e)] )
+            continue;
+        for( auto d : interactions.shared[e] )
+            if( found.insert(d).second ) result.interface.push_back(d);
+    }
+    return result;
+}
@@ -0,0 +1,581 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/IntervalPropagation.hh"
+#include "representation.hh"
+#include "utilities/IOUtils.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+
+using namespace chase;
+
+namespace {
+
+    const double inf = std::numeric_limits< double >::infinity();
+
+    /// Integer and Real types use the chase infinity as default bounds.
+    double toBound(double v)
+    {
+        if(v >= static_cast< double >(infinity)) return inf;
+        if(v <= -static_cast< double >(infinity)) return -inf;
+        return v;
+    }
+
+    double valueOf(Value * v, bool & ok)
+    {
+        ok = true;
+        if(v->IsA() == integerValue_node)
+            return static_cast< double >(
+                    static_cast< IntegerValue * >(v)->getValue());
+        if(v->IsA() == realValue_node)
+            return static_cast< RealValue * >(v)->getValue();
+        ok = false;
+        return 0.0;
+    }
+
+    interval_domain whole()
+    {
+        return {-inf, inf};
+    }
+
+    interval_domain intersect(interval_domain a, interval_domain b)
+    {
+        return {std::max(a.lower, b.lower), std::min(a.upper, b.upper)};
+    }
+
+    bool contains(interval_domain a, double v)
+    {
+        return a.lower <= v && v <= a.upper;
+    }
+
+    /// Product where 0 * inf is 0, as required by the interval bounds.
+    double mul(double a, double b)
+    {
+        if(a == 0.0 || b == 0.0) return 0.0;
+        return a * b;
+    }
+
+    interval_domain add(interval_domain a, interval_domain b)
+    {
+        return {a.lower + b.lower, a.upper + b.upper};
+    }
+
+    interval_domain sub(interval_domain a, interval_domain b)
+    {
+        return {a.lower - b.upper, a.upper - b.lower};
+    }
+
+    interval_domain neg(interval_domain a)
+    {
+        return {-a.upper, -a.lower};
+    }
+
+    interval_domain mul(interval_domain a, interval_domain b)
+    {
+        double p[4] = {mul(a.lower, b.lower), mul(a.lower, b.upper),
+                       mul(a.upper, b.lower), mul(a.upper, b.upper)};
+        return {*std::min_element(p, p + 4), *std::max_element(p, p + 4)};
+    }
+
+    interval_domain div(interval_domain a, interval_domain b)
+    {
+        if(contains(b, 0.0)) return whole();
+        return mul(a, {1.0 / b.upper, 1.0 / b.lower});
+    }
+
+    interval_domain relation(Operator op, interval_domain a, interval_domain b)
+    {
+        bool certain = false;
+        bool possible = true;
+        switch(op)
+        {
+            case op_eq:
+                certain = a.lower == a.upper && b.lower == b.upper &&
+                          a.lower == b.lower;
+                possible = !intersect(a, b).isEmpty();
+                break;
+            case op_neq:
+                certain = intersect(a, b).isEmpty();
+                possible = !(a.lower == a.upper && b.lower == b.upper &&
+                             a.lower == b.lower);
+                break;
+            case op_lt:
+                certain = a.upper < b.lower;
+                possible = a.lower < b.upper;
+                break;
+            case op_le:
+                certain = a.upper <= b.lower;
+                possible = a.lower <= b.upper;
+                break;
+            case op_gt:
+                certain = a.lower > b.upper;
+                possible = a.upper > b.lower;
+                break;
+            case op_ge:
+                certain = a.lower >= b.upper;
+                possible = a.upper >= b.lower;
+                break;
+            default:
+                break;
+        }
+        return {certain ? 1.0 : 0.0, possible ? 1.0 : 0.0};
+    }
+
+    bool isRelation(Operator op)
+    {
+        return op == op_eq || op == op_neq || op == op_lt ||
+               op == op_le || op == op_gt || op == op_ge;
+    }
+}
+
+bool interval_domain::isEmpty() const
+{
+    return lower > upper;
+}
+
+IntervalPropagator::IntervalPropagator() :
+    _precision(1e-3),
+    _revisions(0),
+    _consistent(true)
+{
+}
+
+IntervalPropagator::~IntervalPropagator() = default;
+
+unsigned int IntervalPropagator::addVariable(DataDeclaration * declaration)
+{
+    auto it = _variablesIndex.find(declaration);
+    if(it != _variablesIndex.end()) return it->second;
+
+    interval_domain d = whole();
+    bool integer = false;
+    Type * type = declaration->getType();
+    if(type != nullptr)
+    {
+        if(type->IsA() == integer_node)
+        {
+            auto t = static_cast< Integer * >(type);
+            d = {toBound(static_cast< double >(t->getMin())),
+                 toBound(static_cast< double >(t->getMax()))};
+            integer = true;
+        }
+        else if(type->IsA() == real_node)
+        {
+            auto t = static_cast< Real * >(type);
+            d = {toBound(t->getMin()), toBound(t->getMax())};
+        }
+        else if(type->IsA() == boolean_node)
+        {
+            d = {0.0, 1.0};
+            integer = true;
+        }
+    }
+
+    auto index = static_cast< unsigned int >(_variables.size());
+    _variables.push_back(declaration);
+    _variablesIndex.insert(std::make_pair(declaration, index));
+    _domains.push_back(d);
+    _integers.push_back(integer);
+    _watches.emplace_back();
+    return index;
+}
+
+unsigned int IntervalPropagator::addVariable(
+        DataDeclaration * declaration, Value * domain)
+{
+    unsigned int index = addVariable(declaration);
+    if(domain == nullptr) return index;
+
+    if(domain->IsA() == range_node)
+    {
+        auto r = static_cast< Range * >(domain);
+        setDomain(declaration, r->getLeftValue(), r->getRightValue());
+    }
+    else if(domain->IsA() == interval_node)
+    {
+        auto i = static_cast< Interval * >(domain);
+        bool okL, okR;
+        double l = valueOf(i->getLeftBound(), okL);
+        double r = valueOf(i->getRightBound(), okR);
+        if(!okL || !okR)
+            messageError("Interval propagation: non numeric bounds.", domain);
+        // Open bounds are exact only for integer variables; for real
+        // variables the closure of the interval is used.
+        if(_integers[index])
+        {
+            if(i->isLeftOpen()) l += 1.0;
+            if(i->isRightOpen()) r -= 1.0;
+        }
+        setDomain(declaration, l, r);
+    }
+    else
+        messageError("Interval propagation: unsupported domain.", domain);
+    return index;
+}
+
+void IntervalPropagator::setDomain(
+        DataDeclaration * declaration, double lower, double upper)
+{
+    unsigned int index = addVariable(declaration);
+    _narrow(index, {lower, upper});
+    if(_domains[index].isEmpty()) _consistent = false;
+}
+
+void IntervalPropagator::addConstraint(Constraint * constraint)
+{
+    addConstraint(constraint->getExpression());
+}
+
+void IntervalPropagator::addConstraint(Expression * expression)
+{
+    if(expression == nullptr || !isRelation(expression->getOperator()))
+        messageError("Interval propagation: the constraint is not a "
+                     "relation.", expression);
+
+    hc4_constraint c;
+    _flatten(expression, c);
+    std::sort(c.variables.begin(), c.variables.end());
+    c.variables.erase(std::unique(c.variables.begin(), c.variables.end()),
+                      c.variables.end());
+
+    auto index = static_cast< unsigned int >(_constraints.size());
+    for(auto v : c.variables)
+        _watches[v].push_back(index);
+    _constraints.push_back(std::move(c));
+}
+
+void IntervalPropagator::addContract(Contract * contract)
+{
+    auto addSpec = [this](std::map< semantic_domain, Specification * > & m) {
+        auto it = m.find(constraints);
+        if(it == m.end() || it->second == nullptr) return;
+        if(it->second->IsA() == constraint_node)
+            addConstraint(static_cast< Constraint * >(it->second));
+    };
+    addSpec(contract->assumptions);
+    addSpec(contract->guarantees);
+}
+
+int IntervalPropagator::_flatten(Value * value, hc4_constraint & c)
+{
+    hc4_node n{hc4_constant, op_none, -1, -1, 0.0, true, whole()};
+    bool ok;
+
+    switch(value->IsA())
+    {
+        case integerValue_node:
+        case realValue_node:
+            n.value = valueOf(value, ok);
+            n.integral = n.value == std::floor(n.value);
+            break;
+        case booleanValue_node:
+            n.value = static_cast< BooleanValue * >(value)->getValue() ? 1 : 0;
+            break;
+        case identifier_node:
+        {
+            DataDeclaration * d =
+                    static_cast< Identifier * >(value)->getDeclaration();
+            // Numeric constants are replaced by their value.
+            if(d->IsA() == constant_node)
+            {
+                Value * v = static_cast< Constant * >(d)->getValue();
+                if(v != nullptr)
+                {
+                    n.value = valueOf(v, ok);
+                    n.integral = n.value == std::floor(n.value);
+                    if(ok) break;
+                }
+            }
+            unsigned int var = addVariable(d);
+            n.kind = hc4_variable;
+            n.value = var;
+            n.integral = _integers[var];
+            c.variables.push_back(var);
+            break;
+        }
+        case expression_node:
+        {
+            auto e = static_cast< Expression * >(value);
+            if(e->getOp1() == nullptr)
+                messageError("Interval propagation: missing operand.", e);
+            n.kind = hc4_operation;
+            n.op = e->getOperator();
+            n.left = _flatten(e->getOp1(), c);
+            if(e->getOp2() != nullptr)
+                n.right = _flatten(e->getOp2(), c);
+            else if(n.op != op_minus)
+                messageError("Interval propagation: missing operand.", e);
+            if(n.op == op_none)
+                messageError("Interval propagation: unsupported operator.", e);
+            n.integral = c.nodes[n.left].integral &&
+                         (n.right < 0 || c.nodes[n.right].integral) &&
+                         n.op != op_divide;
+            break;
+        }
+        default:
+            messageError("Interval propagation: unsupported value.", value);
+            break;
+    }
+
+    c.nodes.push_back(n);
+    return static_cast< int >(c.nodes.size()) - 1;
+}
+
+bool IntervalPropagator::_narrow(unsigned int var, interval_domain d)
+{
+    interval_domain & current = _domains[var];
+    interval_domain n = intersect(current, d);
+    if(_integers[var])
+    {
+        // Tolerance for the rounding errors of the propagation.
+        n.lower = std::ceil(n.lower - 1e-9);
+        n.upper = std::floor(n.upper + 1e-9);
+    }
+
+    if(n.isEmpty())
+    {
+        current = n;
+        return true;
+    }
+    if(n.lower <= current.lower && n.upper >= current.upper)
+        return false;
+
+    // Infinite bounds becoming finite always count as a change. Finite
+    // bounds moving along an infinite domain do not, otherwise cyclic
+    // constraints would never stop shrinking the domain.
+    bool bounded = (std::isinf(current.lower) && !std::isinf(n.lower)) ||
+                   (std::isinf(current.upper) && !std::isinf(n.upper));
+    double oldWidth = current.upper - current.lower;
+    double newWidth = n.upper - n.lower;
+    current = n;
+
+    if(bounded) return true;
+    if(std::isinf(oldWidth)) return false;
+    return newWidth < oldWidth * (1.0 - _precision);
+}
+
+bool IntervalPropagator::_revise(
+        unsigned int index, std::vector< unsigned int > & changed)
+{
+    ++_revisions;
+    auto & nodes = _constraints[index].nodes;
+
+    // Forward evaluation.
+    for(auto & n : nodes)
+    {
+        switch(n.kind)
+        {
+            case hc4_constant:
+                n.domain = {n.value, n.value};
+                break;
+            case hc4_variable:
+                n.domain = _domains[static_cast< unsigned int >(n.value)];
+                break;
+            case hc4_operation:
+            {
+                interval_domain a = nodes[n.left].domain;
+                if(n.right < 0)
+                {
+                    n.domain = neg(a);
+                    break;
+                }
+                interval_domain b = nodes[n.right].domain;
+                switch(n.op)
+                {
+                    case op_plus: n.domain = add(a, b); break;
+                    case op_minus: n.domain = sub(a, b); break;
+                    case op_multiply: n.domain = mul(a, b); break;
+                    case op_divide: n.domain = div(a, b); break;
+                    case op_mod:
+                    {
+                        double m = std::max(std::fabs(b.lower),
+                                            std::fabs(b.upper));
+                        n.domain = {a.lower >= 0 ? 0.0 : -m,
+                                    a.upper <= 0 ? 0.0 : m};
+                        break;
+                    }
+                    default:
+                        n.domain = relation(n.op, a, b);
+                        break;
+                }
+                break;
+            }
+        }
+        if(n.domain.isEmpty()) return false;
+    }
+
+    // The root relation must hold.
+    hc4_node & root = nodes.back();
+    if(root.domain.upper == 0.0) return false;
+    interval_domain & a = nodes[root.left].domain;
+    interval_domain & b = nodes[root.right].domain;
+    // Strict relations between integers are tightened by one.
+    double gap = (nodes[root.left].integral && nodes[root.right].integral &&
+                  (root.op == op_lt || root.op == op_gt)) ? 1.0 : 0.0;
+    switch(root.op)
+    {
+        case op_eq:
+            a = intersect(a, b);
+            b = a;
+            break;
+        case op_lt:
+        case op_le:
+            a.upper = std::min(a.upper, b.upper - gap);
+            b.lower = std::max(b.lower, a.lower + gap);
+            break;
+        case op_gt:
+        case op_ge:
+            a.lower = std::max(a.lower, b.lower + gap);
+            b.upper = std::min(b.upper, a.upper - gap);
+            break;
+        default:
+            break;
+    }
+
+    // Backward projection, from the root to the leaves.
+    for(size_t i = nodes.size(); i-- > 0;)
+    {
+        hc4_node & n = nodes[i];
+        if(n.domain.isEmpty()) return false;
+        if(n.kind == hc4_variable)
+        {
+            auto var = static_cast< unsigned int >(n.value);
+            if(_narrow(var, n.domain))
+                changed.push_back(var);
+            if(_domains[var].isEmpty()) return false;
+            continue;
+        }
+        if(n.kind != hc4_operation || isRelation(n.op) || n.op == op_mod)
+            continue;
+
+        interval_domain z = n.domain;
+        interval_domain & x = nodes[n.left].domain;
+        if(n.right < 0)
+        {
+            x = intersect(x, neg(z));
+            continue;
+        }
+        interval_domain & y = nodes[n.right].domain;
+        switch(n.op)
+        {
+            case op_plus:
+                x = intersect(x, sub(z, y));
+                y = intersect(y, sub(z, x));
+                break;
+            case op_minus:
+                x = intersect(x, add(z, y));
+                y = intersect(y, sub(x, z));
+                break;
+            case op_multiply:
+                x = intersect(x, div(z, y));
+                y = intersect(y, div(z, x));
+                break;
+            case op_divide:
+                x = intersect(x, mul(z, y));
+                y = intersect(y, div(x, z));
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+bool IntervalPropagator::propagate()
+{
+    if(!_consistent) return false;
+
+    std::deque< unsigned int > worklist;
+    std::vector< bool > queued(_constraints.size(), true);
+    for(unsigned int i = 0; i < _constraints.size(); ++i)
+        worklist.push_back(i);
+
+    std::vector< unsigned int > changed;
+    while(!worklist.empty())
+    {
+        unsigned int c = worklist.front();
+        worklist.pop_front();
+        queued[c] = false;
+
+        changed.clear();
+        if(!_revise(c, changed))
+        {
+            _consistent = false;
+            return false;
+        }
+
+        for(auto var : changed)
+        {
+            for(auto w : _watches[var])
+            {
+                if(w == c || queued[w]) continue;
+                queued[w] = true;
+                worklist.push_back(w);
+            }
+        }
+    }
+    return true;
+}
+
+bool IntervalPropagator::isConsistent() const
+{
+    return _consistent;
+}
+
+const interval_domain & IntervalPropagator::getDomain(
+        DataDeclaration * declaration) const
+{
+    auto it = _variablesIndex.find(declaration);
+    if(it == _variablesIndex.end())
+        messageError("Interval propagation: unknown variable.", declaration);
+    return _domains[it->second];
+}
+
+Interval * IntervalPropagator::getInterval(DataDeclaration * declaration) const
+{
+    auto it = _variablesIndex.find(declaration);
+    if(it == _variablesIndex.end())
+        messageError("Interval propagation: unknown variable.", declaration);
+    const interval_domain & d = _domains[it->second];
+
+    if(_integers[it->second])
+    {
+        auto toInt = [](double v) {
+            if(v >= static_cast< double >(infinity)) return infinity;
+            if(v <= -static_cast< double >(infinity)) return -infinity;
+            return static_cast< int64_t >(v);
+        };
+        return new Interval(new IntegerValue(toInt(d.lower)),
+                            new IntegerValue(toInt(d.upper)));
+    }
+    return new Interval(new RealValue(d.lower), new RealValue(d.upper));
+}
+
+void IntervalPropagator::setPrecision(double precision)
+{
+    _precision = precision;
+}
+
+size_t IntervalPropagator::getRevisionsCount() const
+{
+    return _revisions;
+}
+
+std::string IntervalPropagator::getString() const
+{
+    std::string ret;
+    for(size_t i = 0; i < _variables.size(); ++i)
+    {
+        ret += _variables[i]->getName()->getString() + " in [" +
+               std::to_string(_domains[i].lower) + ", " +
+               std::to_string(_domains[i].upper) + "]\n";
+    }
+    return ret;
+}
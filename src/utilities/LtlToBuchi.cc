@@ -0,0 +1,775 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/LtlToBuchi.hh"
+#include "representation.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+
+#include <algorithm>
+#include <limits>
+
+using namespace chase;
+
+namespace {
+
+    void setBit(ltl_bitset & b, unsigned int i)
+    {
+        b[i / 64] |= (uint64_t(1) << (i % 64));
+    }
+
+    bool testBit(const ltl_bitset & b, unsigned int i)
+    {
+        return (b[i / 64] >> (i % 64)) & uint64_t(1);
+    }
+
+    bool containsAll(const ltl_bitset & b, const ltl_bitset & all)
+    {
+        for(size_t i = 0; i < all.size(); ++i)
+            if((b[i] & all[i]) != all[i]) return false;
+        return true;
+    }
+
+    void unite(ltl_bitset & b, const ltl_bitset & o)
+    {
+        for(size_t i = 0; i < b.size(); ++i)
+            b[i] |= o[i];
+    }
+
+    size_t hashCombine(size_t seed, size_t v)
+    {
+        return seed ^ (v + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+
+    /// Branch of the tableau expansion of a state.
+    struct tableau_branch {
+        std::vector< unsigned int > todo;
+        std::vector< unsigned int > done;
+        std::vector< unsigned int > next;
+        ltl_bitset positive;
+        ltl_bitset negative;
+        ltl_bitset pending;
+    };
+
+    bool transitionLess(const buchi_transition & a, const buchi_transition & b)
+    {
+        if(a.target != b.target) return a.target < b.target;
+        if(a.positive != b.positive) return a.positive < b.positive;
+        if(a.negative != b.negative) return a.negative < b.negative;
+        return a.acceptance < b.acceptance;
+    }
+
+    bool transitionEqual(const buchi_transition & a, const buchi_transition & b)
+    {
+        return a.target == b.target && a.positive == b.positive &&
+               a.negative == b.negative && a.acceptance == b.acceptance;
+    }
+}
+
+bool ltl_node::operator==(const ltl_node & o) const
+{
+    return kind == o.kind && left == o.left && right == o.right;
+}
+
+size_t ltl_node_hash::operator()(const ltl_node & n) const
+{
+    size_t h = hashCombine(static_cast< size_t >(n.kind), n.left);
+    return hashCombine(h, n.right);
+}
+
+size_t ltl_state_hash::operator()(const std::vector< unsigned int > & s) const
+{
+    size_t h = s.size();
+    for(auto f : s)
+        h = hashCombine(h, f);
+    return h;
+}
+
+// ---------------------------------------------------------------------------
+// LtlFormulaTable
+// ---------------------------------------------------------------------------
+
+LtlFormulaTable::LtlFormulaTable()
+{
+    // Constants always have the identifiers 0 and 1.
+    makeNode(ltl_true);
+    makeNode(ltl_false);
+}
+
+LtlFormulaTable::~LtlFormulaTable() = default;
+
+unsigned int LtlFormulaTable::makeNode(
+        ltl_node_kind kind, unsigned int left, unsigned int right)
+{
+    const unsigned int t = 0;
+    const unsigned int f = 1;
+
+    // Simplifications keeping the table small.
+    switch(kind)
+    {
+        case ltl_and:
+            if(left == f || right == f) return f;
+            if(left == t) return right;
+            if(right == t || left == right) return left;
+            if(left > right) std::swap(left, right);
+            break;
+        case ltl_or:
+            if(left == t || right == t) return t;
+            if(left == f) return right;
+            if(right == f || left == right) return left;
+            if(left > right) std::swap(left, right);
+            break;
+        case ltl_next:
+            if(left == t || left == f) return left;
+            right = 0;
+            break;
+        case ltl_until:
+        case ltl_release:
+            if(right == t || right == f) return right;
+            break;
+        case ltl_true:
+        case ltl_false:
+            left = 0;
+            right = 0;
+            break;
+        default:
+            break;
+    }
+
+    ltl_node n = {kind, left, right};
+    auto it = _index.find(n);
+    if(it != _index.end()) return it->second;
+
+    auto id = static_cast< unsigned int >(_nodes.size());
+    _nodes.push_back(n);
+    _index.insert(std::make_pair(n, id));
+    if(kind == ltl_until)
+    {
+        auto acc = static_cast< unsigned int >(_untils.size());
+        _untils.insert(std::make_pair(id, acc));
+    }
+    return id;
+}
+
+unsigned int LtlFormulaTable::negate(unsigned int id)
+{
+    auto it = _negations.find(id);
+    if(it != _negations.end()) return it->second;
+
+    ltl_node n = _nodes[id];
+    unsigned int ret = 0;
+    switch(n.kind)
+    {
+        case ltl_true:
+            ret = makeNode(ltl_false);
+            break;
+        case ltl_false:
+            ret = makeNode(ltl_true);
+            break;
+        case ltl_atom:
+            ret = makeNode(ltl_not_atom, n.left);
+            break;
+        case ltl_not_atom:
+            ret = makeNode(ltl_atom, n.left);
+            break;
+        case ltl_and:
+            ret = makeNode(ltl_or, negate(n.left), negate(n.right));
+            break;
+        case ltl_or:
+            ret = makeNode(ltl_and, negate(n.left), negate(n.right));
+            break;
+        case ltl_next:
+            ret = makeNode(ltl_next, negate(n.left));
+            break;
+        case ltl_until:
+            ret = makeNode(ltl_release, negate(n.left), negate(n.right));
+            break;
+        case ltl_release:
+            ret = makeNode(ltl_until, negate(n.left), negate(n.right));
+            break;
+    }
+    _negations[id] = ret;
+    _negations[ret] = id;
+    return ret;
+}
+
+unsigned int LtlFormulaTable::_getAtom(const std::string & name)
+{
+    auto it = _atoms.find(name);
+    if(it != _atoms.end()) return it->second;
+    auto atom = static_cast< unsigned int >(_atomNames.size());
+    _atomNames.push_back(name);
+    _atoms.insert(std::make_pair(name, atom));
+    return atom;
+}
+
+unsigned int LtlFormulaTable::intern(LogicFormula * formula, bool negated)
+{
+    if(formula == nullptr)
+        messageError("LTL translation: missing formula.");
+
+    unsigned int ret = 0;
+    switch(formula->IsA())
+    {
+        case booleanConstant_node: {
+            auto c = static_cast< BooleanConstant * >(formula);
+            ret = makeNode(c->getValue() ? ltl_true : ltl_false);
+            break;
+        }
+        case proposition_node: {
+            // Propositions are identified by the name of the declaration they
+            // refer to, so that the correspondences applied by the algebra
+            // are taken into account.
+            auto p = static_cast< Proposition * >(formula);
+            std::string name;
+            Value * v = p->getValue();
+            if(v == nullptr)
+                name = p->getName()->getString();
+            else if(v->IsA() == identifier_node)
+                name = static_cast< Identifier * >(v)->getDeclaration()
+                        ->getName()->getString();
+            else
+                name = p->getString();
+            ret = makeNode(ltl_atom, _getAtom(name));
+            break;
+        }
+        case unaryBooleanOperation_node: {
+            auto u = static_cast< UnaryBooleanFormula * >(formula);
+            return intern(u->getOp1(), !negated);
+        }
+        case binaryBooleanOperation_node: {
+            auto b = static_cast< BinaryBooleanFormula * >(formula);
+            unsigned int op1 = intern(b->getOp1());
+            unsigned int op2 = intern(b->getOp2());
+            switch(b->getOp())
+            {
+                case op_and:
+                    ret = makeNode(ltl_and, op1, op2);
+                    break;
+                case op_nand:
+                    ret = negate(makeNode(ltl_and, op1, op2));
+                    break;
+                case op_or:
+                    ret = makeNode(ltl_or, op1, op2);
+                    break;
+                case op_nor:
+                    ret = negate(makeNode(ltl_or, op1, op2));
+                    break;
+                case op_implies:
+                    ret = makeNode(ltl_or, negate(op1), op2);
+                    break;
+                case op_iff:
+                case op_xnor:
+                    ret = makeNode(ltl_or,
+                            makeNode(ltl_and, op1, op2),
+                            makeNode(ltl_and, negate(op1), negate(op2)));
+                    break;
+                case op_xor:
+                    ret = makeNode(ltl_or,
+                            makeNode(ltl_and, op1, negate(op2)),
+                            makeNode(ltl_and, negate(op1), op2));
+                    break;
+                default:
+                    messageError("LTL translation: unsupported Boolean "
+                                 "operator.", formula);
+                    break;
+            }
+            break;
+        }
+        case largeBooleanFormula_node: {
+            auto l = static_cast< LargeBooleanFormula * >(formula);
+            BooleanOperator op = l->getOp();
+            bool conjunction = (op == op_and || op == op_nand);
+            ret = makeNode(conjunction ? ltl_true : ltl_false);
+            for(auto operand : l->operands)
+            {
+                unsigned int f = intern(operand);
+                if(op == op_xor)
+                    ret = makeNode(ltl_or,
+                            makeNode(ltl_and, ret, negate(f)),
+                            makeNode(ltl_and, negate(ret), f));
+                else
+                    ret = makeNode(conjunction ? ltl_and : ltl_or, ret, f);
+            }
+            if(op == op_nand || op == op_nor)
+                ret = negate(ret);
+            break;
+        }
+        case unaryTemporalOperation_node: {
+            auto u = static_cast< UnaryTemporalFormula * >(formula);
+            if(u->getInterval() != nullptr)
+                messageError("LTL translation: bounded temporal operators "
+                             "are not supported.", formula);
+            unsigned int f = intern(u->getFormula());
+            switch(u->getOp())
+            {
+                case op_globally:
+                    ret = makeNode(ltl_release, makeNode(ltl_false), f);
+                    break;
+                case op_future:
+                    ret = makeNode(ltl_until, makeNode(ltl_true), f);
+                    break;
+                case op_next:
+                    ret = makeNode(ltl_next, f);
+                    break;
+                default:
+                    messageError("LTL translation: unsupported unary "
+                                 "temporal operator.", formula);
+                    break;
+            }
+            break;
+        }
+        case binaryTemporalOperation_node: {
+            auto b = static_cast< BinaryTemporalFormula * >(formula);
+            if(b->getInterval() != nullptr)
+                messageError("LTL translation: bounded temporal operators "
+                             "are not supported.", formula);
+            unsigned int op1 = intern(b->getFormula1());
+            unsigned int op2 = intern(b->getFormula2());
+            switch(b->getOp())
+            {
+                case op_until:
+                    ret = makeNode(ltl_until, op1, op2);
+                    break;
+                case op_release:
+                    ret = makeNode(ltl_release, op1, op2);
+                    break;
+                default:
+                    messageError("LTL translation: unsupported binary "
+                                 "temporal operator.", formula);
+                    break;
+            }
+            break;
+        }
+        default:
+            messageError("LTL translation: unsupported formula.", formula);
+            break;
+    }
+
+    return negated ? negate(ret) : ret;
+}
+
+const ltl_node & LtlFormulaTable::getNode(unsigned int id) const
+{
+    return _nodes[id];
+}
+
+size_t LtlFormulaTable::getSize() const
+{
+    return _nodes.size();
+}
+
+size_t LtlFormulaTable::getAtomsCount() const
+{
+    return _atomNames.size();
+}
+
+const std::string & LtlFormulaTable::getAtomName(unsigned int atom) const
+{
+    return _atomNames[atom];
+}
+
+size_t LtlFormulaTable::getUntilsCount() const
+{
+    return _untils.size();
+}
+
+unsigned int LtlFormulaTable::getAcceptanceIndex(unsigned int id) const
+{
+    auto it = _untils.find(id);
+    if(it == _untils.end())
+        messageError("LTL translation: acceptance index of a non-until "
+                     "formula.");
+    return it->second;
+}
+
+std::string LtlFormulaTable::getString(unsigned int id) const
+{
+    const ltl_node & n = _nodes[id];
+    switch(n.kind)
+    {
+        case ltl_true:
+            return "TRUE";
+        case ltl_false:
+            return "FALSE";
+        case ltl_atom:
+            return _atomNames[n.left];
+        case ltl_not_atom:
+            return "!" + _atomNames[n.left];
+        case ltl_and:
+            return "(" + getString(n.left) + to_string(op_and) +
+                   getString(n.right) + ")";
+        case ltl_or:
+            return "(" + getString(n.left) + to_string(op_or) +
+                   getString(n.right) + ")";
+        case ltl_next:
+            return to_string(op_next) + "(" + getString(n.left) + ")";
+        case ltl_until:
+            return "(" + getString(n.left) + to_string(op_until) +
+                   getString(n.right) + ")";
+        case ltl_release:
+            return "(" + getString(n.left) + to_string(op_release) +
+                   getString(n.right) + ")";
+    }
+    return std::string();
+}
+
+// ---------------------------------------------------------------------------
+// BuchiAutomaton
+// ---------------------------------------------------------------------------
+
+BuchiAutomaton::BuchiAutomaton(LogicFormula * formula, bool negated) :
+    _initial(0),
+    _labelWords(0),
+    _acceptanceWords(0)
+{
+    CHASE_PROFILE_SCOPE("BuchiAutomaton::BuchiAutomaton");
+    unsigned int f = _table.intern(formula, negated);
+
+    // The table does not grow anymore: the expansion only visits
+    // sub-formulas of the translated formula.
+    _labelWords = (_table.getAtomsCount() + 63) / 64;
+    _acceptanceWords = (_table.getUntilsCount() + 63) / 64;
+
+    std::vector< unsigned int > init;
+    if(_table.getNode(f).kind != ltl_true)
+        init.push_back(f);
+    _initial = _getState(init);
+}
+
+BuchiAutomaton::~BuchiAutomaton() = default;
+
+unsigned int BuchiAutomaton::getInitialState() const
+{
+    return _initial;
+}
+
+unsigned int BuchiAutomaton::_getState(
+        const std::vector< unsigned int > & formulas)
+{
+    auto it = _statesIndex.find(formulas);
+    if(it != _statesIndex.end()) return it->second;
+
+    auto id = static_cast< unsigned int >(_states.size());
+    _states.push_back(formulas);
+    _transitions.emplace_back();
+    _expanded.push_back(false);
+    _statesIndex.insert(std::make_pair(formulas, id));
+    return id;
+}
+
+const std::vector< buchi_transition > & BuchiAutomaton::getSuccessors(
+        unsigned int state)
+{
+    if(!_expanded[state]) _expand(state);
+    return _transitions[state];
+}
+
+void BuchiAutomaton::_expand(unsigned int state)
+{
+    _expanded[state] = true;
+    std::vector< buchi_transition > result;
+
+    std::vector< tableau_branch > branches(1);
+    branches[0].todo = _states[state];
+    branches[0].positive.assign(_labelWords, 0);
+    branches[0].negative.assign(_labelWords, 0);
+    branches[0].pending.assign(_acceptanceWords, 0);
+
+    while(!branches.empty())
+    {
+        tableau_branch b = std::move(branches.back());
+        branches.pop_back();
+
+        bool consistent = true;
+        while(consistent && !b.todo.empty())
+        {
+            unsigned int f = b.todo.back();
+            b.todo.pop_back();
+            if(std::find(b.done.begin(), b.done.end(), f) != b.done.end())
+                continue;
+            b.done.push_back(f);
+
+            const ltl_node & n = _table.getNode(f);
+            switch(n.kind)
+            {
+                case ltl_true:
+                    break;
+                case ltl_false:
+                    consistent = false;
+                    break;
+                case ltl_atom:
+                    if(testBit(b.negative, n.left)) consistent = false;
+                    else setBit(b.positive, n.left);
+                    break;
+                case ltl_not_atom:
+                    if(testBit(b.positive, n.left)) consistent = false;
+                    else setBit(b.negative, n.left);
+                    break;
+                case ltl_and:
+                    b.todo.push_back(n.left);
+                    b.todo.push_back(n.right);
+                    break;
+                case ltl_or: {
+                    tableau_branch other = b;
+                    other.todo.push_back(n.right);
+                    branches.push_back(std::move(other));
+                    b.todo.push_back(n.left);
+                    break;
+                }
+                case ltl_next:
+                    b.next.push_back(n.left);
+                    break;
+                case ltl_until: {
+                    // a U b = b | (a & X(a U b)). The second branch postpones
+                    // the fulfillment of b, so it is not accepting.
+                    tableau_branch other = b;
+                    other.todo.push_back(n.left);
+                    other.next.push_back(f);
+                    setBit(other.pending, _table.getAcceptanceIndex(f));
+                    branches.push_back(std::move(other));
+                    b.todo.push_back(n.right);
+                    break;
+                }
+                case ltl_release: {
+                    // a R b = (a & b) | (b & X(a R b)).
+                    tableau_branch other = b;
+                    other.todo.push_back(n.right);
+                    other.next.push_back(f);
+                    branches.push_back(std::move(other));
+                    b.todo.push_back(n.left);
+                    b.todo.push_back(n.right);
+                    break;
+                }
+            }
+        }
+        if(!consistent) continue;
+
+        std::sort(b.next.begin(), b.next.end());
+        b.next.erase(std::unique(b.next.begin(), b.next.end()), b.next.end());
+
+        buchi_transition t;
+        t.target = _getState(b.next);
+        t.positive = std::move(b.positive);
+        t.negative = std::move(b.negative);
+        t.acceptance.assign(_acceptanceWords, 0);
+        for(unsigned int i = 0; i < _table.getUntilsCount(); ++i)
+            if(!testBit(b.pending, i)) setBit(t.acceptance, i);
+        result.push_back(std::move(t));
+    }
+
+    std::sort(result.begin(), result.end(), transitionLess);
+    result.erase(std::unique(result.begin(), result.end(), transitionEqual),
+                 result.end());
+    _transitions[state] = std::move(result);
+}
+
+void BuchiAutomaton::explore()
+{
+    std::vector< unsigned int > stack(1, _initial);
+    while(!stack.empty())
+    {
+        unsigned int s = stack.back();
+        stack.pop_back();
+        if(_expanded[s]) continue;
+        for(auto & t : getSuccessors(s))
+            if(!_expanded[t.target]) stack.push_back(t.target);
+    }
+}
+
+size_t BuchiAutomaton::getStatesCount() const
+{
+    return _states.size();
+}
+
+size_t BuchiAutomaton::getAcceptanceSetsCount() const
+{
+    return _table.getUntilsCount();
+}
+
+const std::vector< unsigned int > & BuchiAutomaton::getStateFormulas(
+        unsigned int state) const
+{
+    return _states[state];
+}
+
+LtlFormulaTable & BuchiAutomaton::getTable()
+{
+    return _table;
+}
+
+bool BuchiAutomaton::isEmpty()
+{
+    CHASE_PROFILE_SCOPE("BuchiAutomaton::isEmpty");
+    // Couvreur's on-the-fly SCC-based emptiness check.
+    const unsigned int dead = std::numeric_limits< unsigned int >::max();
+
+    ltl_bitset all(_acceptanceWords, 0);
+    for(unsigned int i = 0; i < _table.getUntilsCount(); ++i)
+        setBit(all, i);
+
+    struct root_t {
+        unsigned int order;
+        ltl_bitset acceptance;
+    };
+
+    std::vector< unsigned int > order;
+    std::vector< root_t > roots;
+    std::vector< ltl_bitset > arcs;
+    std::vector< std::pair< unsigned int, size_t > > todo;
+    std::vector< unsigned int > live;
+    unsigned int count = 0;
+
+    auto push = [&](unsigned int s, const ltl_bitset & acceptance) {
+        if(order.size() < _states.size()) order.resize(_states.size(), 0);
+        order[s] = ++count;
+        roots.push_back({count, ltl_bitset(_acceptanceWords, 0)});
+        arcs.push_back(acceptance);
+        todo.emplace_back(s, 0);
+        live.push_back(s);
+    };
+
+    push(_initial, ltl_bitset(_acceptanceWords, 0));
+
+    while(!todo.empty())
+    {
+        unsigned int s = todo.back().first;
+        size_t i = todo.back().second;
+        const std::vector< buchi_transition > & succ = getSuccessors(s);
+
+        if(i < succ.size())
+        {
+            ++todo.back().second;
+            const buchi_transition & t = succ[i];
+            if(order.size() < _states.size()) order.resize(_states.size(), 0);
+
+            unsigned int d = t.target;
+            if(order[d] == 0)
+            {
+                push(d, t.acceptance);
+                continue;
+            }
+            if(order[d] == dead) continue;
+
+            // Back edge: merge all the roots above the target.
+            ltl_bitset acceptance = t.acceptance;
+            while(order[d] < roots.back().order)
+            {
+                unite(acceptance, roots.back().acceptance);
+                unite(acceptance, arcs.back());
+                roots.pop_back();
+                arcs.pop_back();
+            }
+            unite(roots.back().acceptance, acceptance);
+            if(containsAll(roots.back().acceptance, all)) return false;
+        }
+        else
+        {
+            todo.pop_back();
+            if(roots.back().order == order[s])
+            {
+                roots.pop_back();
+                arcs.pop_back();
+                unsigned int u;
+                do {
+                    u = live.back();
+                    live.pop_back();
+                    order[u] = dead;
+                } while(u != s);
+            }
+        }
+    }
+    return true;
+}
+
+std::string BuchiAutomaton::getString()
+{
+    std::string ret("Buchi automaton:\n");
+    ret += "Acceptance sets: " +
+           std::to_string(_table.getUntilsCount()) + "\n";
+    for(size_t s = 0; s < _states.size(); ++s)
+    {
+        ret += (s == _initial) ? "-> " : "   ";
+        ret += "s" + std::to_string(s) + ": {";
+        for(size_t i = 0; i < _states[s].size(); ++i)
+        {
+            if(i > 0) ret += ", ";
+            ret += _table.getString(_states[s][i]);
+        }
+        ret += "}\n";
+        if(!_expanded[s]) continue;
+        for(auto & t : _transitions[s])
+        {
+            std::string label;
+            for(unsigned int a = 0; a < _table.getAtomsCount(); ++a)
+            {
+                if(testBit(t.positive, a))
+                    label += (label.empty() ? "" : " & ") +
+                             _table.getAtomName(a);
+                if(testBit(t.negative, a))
+                    label += (label.empty() ? "!" : " & !") +
+                             _table.getAtomName(a);
+            }
+            if(label.empty()) label = "TRUE";
+            ret += "\t--( " + label + " )--> s" +
+                   std::to_string(t.target) + " {";
+            bool first = true;
+            for(unsigned int a = 0; a < _table.getUntilsCount(); ++a)
+            {
+                if(!testBit(t.acceptance, a)) continue;
+                if(!first) ret += ",";
+                ret += std::to_string(a);
+                first = false;
+            }
+            ret += "}\n";
+        }
+    }
+    return ret;
+}
+
+// ---------------------------------------------------------------------------
+// Decision procedures.
+// ---------------------------------------------------------------------------
+
+bool chase::isSatisfiableLTL(LogicFormula * formula)
+{
+    BuchiAutomaton automaton(formula);
+    return !automaton.isEmpty();
+}
+
+bool chase::isValidLTL(LogicFormula * formula)
+{
+    BuchiAutomaton automaton(formula, true);
+    return automaton.isEmpty();
+}
+
+bool chase::checkRefinementLTL(Contract * c1, Contract * c2,
+                               names_projection_map & correspondences)
+{
+    CHASE_PROFILE_SCOPE("checkRefinementLTL");
+    Contract * rcheck = Contract::refinementCheck(c1, c2, correspondences);
+
+    bool ret = true;
+    auto a = rcheck->assumptions.find(logic);
+    if(a != rcheck->assumptions.end())
+    {
+        auto f = dynamic_cast< LogicFormula * >(a->second);
+        if(f == nullptr) messageError("Wrong format in Logic.");
+        ret = isValidLTL(f);
+    }
+
+    auto g = rcheck->guarantees.find(logic);
+    if(ret && g != rcheck->guarantees.end())
+    {
+        auto f = dynamic_cast< LogicFormula * >(g->second);
+        if(f == nullptr) messageError("Wrong format in Logic.");
+        ret = isValidLTL(f);
+    }
+
+    delete rcheck;
+    return ret;
+}
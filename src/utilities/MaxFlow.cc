@@ -0,0 +1,315 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/MaxFlow.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+
+#include <algorithm>
+#include <limits>
+
+using namespace chase;
+
+namespace {
+
+    const unsigned int none = std::numeric_limits< unsigned int >::max();
+
+    /// @brief Residual network of the Dinic algorithm. The arcs are stored
+    /// by tail, as a compact adjacency, and every arc is paired with its
+    /// reverse arc, which has no capacity at the beginning.
+    class FlowNetwork {
+    public:
+        explicit FlowNetwork( unsigned int nodes ) :
+            _nodes(nodes),
+            _pending(),
+            _offsets(),
+            _heads(),
+            _capacities(),
+            _reverse(),
+            _labels(),
+            _levels(),
+            _next()
+        {
+        }
+
+        /// @brief Function adding an arc. Arcs must be added before build.
+        void addArc( unsigned int tail, unsigned int head,
+                     unsigned int capacity, unsigned int label )
+        {
+            _pending.push_back({tail, head, capacity, label});
+        }
+
+        /// @brief Function storing the arcs and their reverse arcs by tail.
+        void build()
+        {
+            _offsets.assign(_nodes + 1, 0);
+            for( auto & arc : _pending )
+            {
+                ++_offsets[arc.tail + 1];
+                ++_offsets[arc.head + 1];
+            }
+            for( unsigned int v = 0; v < _nodes; ++v )
+                _offsets[v + 1] += _offsets[v];
+
+            size_t arcs = _offsets[_nodes];
+            _heads.resize(arcs);
+            _capacities.resize(arcs);
+            _reverse.resize(arcs);
+            _labels.resize(arcs);
+            std::vector< unsigned int > next(_offsets.begin(),
+                                             _offsets.end() - 1);
+            for( auto & arc : _pending )
+            {
+                unsigned int forward = next[arc.tail]++;
+                unsigned int backward = next[arc.head]++;
+                _heads[forward] = arc.head;
+                _capacities[forward] = arc.capacity;
+                _reverse[forward] = backward;
+                _labels[forward] = arc.label;
+                _heads[backward] = arc.tail;
+                _capacities[backward] = 0;
+                _reverse[backward] = forward;
+                _labels[backward] = none;
+            }
+            _pending.clear();
+            _pending.shrink_to_fit();
+        }
+
+        /// @brief Dinic algorithm: blocking flows along the shortest paths of
+        /// the residual network, while the target is reachable.
+        unsigned int maxFlow( unsigned int source, unsigned int target )
+        {
+            unsigned int flow = 0;
+            unsigned int phases = 0;
+            while( _buildLevels(source, target) )
+            {
+                ++phases;
+                _next.assign(_offsets.begin(), _offsets.end() - 1);
+                while( unsigned int augment = _augment(source, target) )
+                    flow += augment;
+            }
+            CHASE_PROFILE_COUNT("FlowNetwork::phases", phases);
+            return flow;
+        }
+
+        /// @brief Function marking the nodes reachable from the source in the
+        /// residual network: the source side of a minimum cut.
+        std::vector< bool > getSourceSide( unsigned int source ) const
+        {
+            std::vector< bool > side(_nodes, false);
+            std::vector< unsigned int > stack(1, source);
+            side[source] = true;
+            while( ! stack.empty() )
+            {
+                unsigned int v = stack.back();
+                stack.pop_back();
+                for( unsigned int a = _offsets[v]; a < _offsets[v + 1]; ++a )
+                {
+                    if( _capacities[a] == 0 || side[_heads[a]] ) continue;
+                    side[_heads[a]] = true;
+                    stack.push_back(_heads[a]);
+                }
+            }
+            return side;
+        }
+
+        /// @brief Function calling a function on the label of each arc
+        /// leaving the source side.
+        template< typename F >
+        void forEachCutArc( const std::vector< bool > & side, F f ) const
+        {
+            for( unsigned int v = 0; v < _nodes; ++v )
+            {
+                if( ! side[v] ) continue;
+                for( unsigned int a = _offsets[v]; a < _offsets[v + 1]; ++a )
+                    if( _labels[a] != none && ! side[_heads[a]] )
+                        f(_labels[a]);
+            }
+        }
+
+    protected:
+        typedef struct pending_arc {
+            unsigned int tail;
+            unsigned int head;
+            unsigned int capacity;
+            unsigned int label;
+        } pending_arc;
+
+        unsigned int _nodes;
+        std::vector< pending_arc > _pending;
+        std::vector< unsigned int > _offsets;
+        std::vector< unsigned int > _heads;
+        std::vector< unsigned int > _capacities;
+        std::vector< unsigned int > _reverse;
+        /// @brief Label of the forward arcs, none for the reverse ones.
+        std::vector< unsigned int > _labels;
+        /// @brief Distance from the source in the residual network.
+        std::vector< unsigned int > _levels;
+        /// @brief First arc of each node not yet known to be blocked.
+        std::vector< unsigned int > _next;
+
+        bool _buildLevels( unsigned int source, unsigned int target )
+        {
+            _levels.assign(_nodes, none);
+            std::vector< unsigned int > queue(1, source);
+            _levels[source] = 0;
+            for( size_t i = 0; i < queue.size(); ++i )
+            {
+                unsigned int v = queue[i];
+                for( unsigned int a = _offsets[v]; a < _offsets[v + 1]; ++a )
+                {
+                    unsigned int w = _heads[a];
+                    if( _capacities[a] == 0 || _levels[w] != none ) continue;
+                    _levels[w] = _levels[v] + 1;
+                    queue.push_back(w);
+                }
+            }
+            return _levels[target] != none;
+        }
+
+        /// @brief Function pushing flow along one path of the level graph,
+        /// with an iterative search. Dead ends are removed from the level
+        /// graph, so that every arc is skipped at most once per phase.
+        unsigned int _augment( unsigned int source, unsigned int target )
+        {
+            std::vector< unsigned int > path;
+            unsigned int v = source;
+            while( true )
+            {
+                if( v == target )
+                {
+                    unsigned int bottleneck = none;
+                    for( auto a : path )
+                        bottleneck = std::min(bottleneck, _capacities[a]);
+                    for( auto a : path )
+                    {
+                        _capacities[a] -= bottleneck;
+                        _capacities[_reverse[a]] += bottleneck;
+                    }
+                    return bottleneck;
+                }
+
+                unsigned int & a = _next[v];
+                while( a < _offsets[v + 1] &&
+                       (_capacities[a] == 0 ||
+                        _levels[_heads[a]] != _levels[v] + 1) )
+                    ++a;
+                if( a < _offsets[v + 1] )
+                {
+                    path.push_back(a);
+                    v = _heads[a];
+                    continue;
+                }
+
+                _levels[v] = none;
+                if( path.empty() ) return 0;
+                v = _heads[_reverse[path.back()]];
+                path.pop_back();
+                ++_next[v];
+            }
+        }
+    };
+
+    void checkNodes( const compact_adjacency & adjacency, unsigned int source,
+                     unsigned int target )
+    {
+        unsigned int size = adjacency.getSize();
+        if( source >= size || target >= size )
+            messageError("Node out of the graph: " +
+                         std::to_string(std::max(source, target)));
+        if( source == target )
+            messageError("Source and target are the same node: " +
+                         std::to_string(source));
+        if( adjacency.edges.size() != adjacency.targets.size() )
+            messageError("The adjacency has no edge indexes.");
+    }
+
+}
+
+unsigned int chase::countEdgeDisjointPaths( const compact_adjacency & adjacency,
+                                            unsigned int source,
+                                            unsigned int target,
+                                            minimum_cut * cut )
+{
+    CHASE_PROFILE_SCOPE("countEdgeDisjointPaths");
+    checkNodes(adjacency, source, target);
+    unsigned int size = adjacency.getSize();
+
+    FlowNetwork network(size);
+    for( unsigned int v = 0; v < size; ++v )
+    {
+        for( unsigned int i = adjacency.offsets[v];
+             i < adjacency.offsets[v + 1]; ++i )
+        {
+            if( adjacency.targets[i] == v ) continue;
+            network.addArc(v, adjacency.targets[i], 1, adjacency.edges[i]);
+        }
+    }
+    network.build();
+    unsigned int flow = network.maxFlow(source, target);
+
+    if( cut != nullptr )
+    {
+        cut->sourceSide = network.getSourceSide(source);
+        cut->nodes.clear();
+        cut->edges.clear();
+        network.forEachCutArc(cut->sourceSide, [cut](unsigned int e) {
+            cut->edges.push_back(e);
+        });
+    }
+    return flow;
+}
+
+unsigned int chase::countVertexDisjointPaths(
+        const compact_adjacency & adjacency,
+        unsigned int source,
+        unsigned int target,
+        minimum_cut * cut )
+{
+    CHASE_PROFILE_SCOPE("countVertexDisjointPaths");
+    checkNodes(adjacency, source, target);
+    unsigned int size = adjacency.getSize();
+
+    // Node v is split into 2v (input) and 2v + 1 (output). Only the arcs
+    // through the nodes, and the direct edges, can be in a minimum cut:
+    // the other arcs have a capacity larger than any flow.
+    auto unbounded = static_cast< unsigned int >(adjacency.targets.size() + 1);
+    FlowNetwork network(2 * size);
+    for( unsigned int v = 0; v < size; ++v )
+    {
+        bool terminal = v == source || v == target;
+        network.addArc(2 * v, 2 * v + 1, terminal ? unbounded : 1, none);
+        for( unsigned int i = adjacency.offsets[v];
+             i < adjacency.offsets[v + 1]; ++i )
+        {
+            unsigned int w = adjacency.targets[i];
+            if( w == v ) continue;
+            bool direct = v == source && w == target;
+            network.addArc(2 * v + 1, 2 * w, direct ? 1 : unbounded,
+                           adjacency.edges[i]);
+        }
+    }
+    network.build();
+    unsigned int flow = network.maxFlow(2 * source + 1, 2 * target);
+
+    if( cut != nullptr )
+    {
+        std::vector< bool > side = network.getSourceSide(2 * source + 1);
+        cut->sourceSide.assign(size, false);
+        cut->nodes.clear();
+        cut->edges.clear();
+        for( unsigned int v = 0; v < size; ++v )
+        {
+            cut->sourceSide[v] = side[2 * v + 1];
+            if( side[2 * v] && ! side[2 * v + 1] ) cut->nodes.push_back(v);
+        }
+        network.forEachCutArc(side, [cut](unsigned int e) {
+            cut->edges.push_back(e);
+        });
+    }
+    return flow;
+}
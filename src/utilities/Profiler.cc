@@ -0,0 +1,269 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/Profiler.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+using namespace chase;
+
+namespace {
+
+    typedef struct site_stats {
+        uint64_t calls;
+        uint64_t total;
+        uint64_t self;
+    } site_stats;
+
+    /// @brief Measures of a thread. The owner thread updates them under the
+    /// mutex, which is contended only while the profile is merged.
+    typedef struct thread_profile {
+        std::mutex mutex;
+        unsigned int index;
+        std::unordered_map< const char *, site_stats > sites;
+        std::unordered_map< const char *, int64_t > counters;
+        std::vector< trace_event > events;
+    } thread_profile;
+
+    std::atomic< bool > enabled(false);
+    std::atomic< bool > tracing(false);
+
+    /// @brief Profiles of all the threads. They outlive their threads, so
+    /// that the measures of the terminated workers are kept.
+    std::mutex registryMutex;
+    std::vector< std::unique_ptr< thread_profile > > registry;
+
+    thread_local thread_profile * localProfile = nullptr;
+    thread_local ScopedTimer * currentTimer = nullptr;
+
+    const std::chrono::steady_clock::time_point epoch =
+            std::chrono::steady_clock::now();
+
+    uint64_t now()
+    {
+        return static_cast< uint64_t >(
+                std::chrono::duration_cast< std::chrono::nanoseconds >(
+                        std::chrono::steady_clock::now() - epoch).count());
+    }
+
+    thread_profile & getLocalProfile()
+    {
+        if(localProfile == nullptr)
+        {
+            std::lock_guard< std::mutex > lock(registryMutex);
+            registry.emplace_back(new thread_profile());
+            localProfile = registry.back().get();
+            localProfile->index =
+                    static_cast< unsigned int >(registry.size() - 1);
+        }
+        return *localProfile;
+    }
+
+    void writeEscaped(std::ostream & out, const std::string & s)
+    {
+        for(char c : s)
+        {
+            if(c == '"' || c == '\\') out << '\\';
+            out << c;
+        }
+    }
+
+}
+
+ScopedTimer::ScopedTimer(const char * name) :
+    _name(name),
+    _parent(nullptr),
+    _start(0),
+    _children(0),
+    _active(enabled.load(std::memory_order_relaxed))
+{
+    if(!_active) return;
+    _parent = currentTimer;
+    currentTimer = this;
+    _start = now();
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    if(!_active) return;
+    uint64_t elapsed = now() - _start;
+    currentTimer = _parent;
+    if(_parent != nullptr) _parent->_children += elapsed;
+
+    thread_profile & profile = getLocalProfile();
+    std::lock_guard< std::mutex > lock(profile.mutex);
+    site_stats & s = profile.sites[_name];
+    ++s.calls;
+    s.total += elapsed;
+    s.self += elapsed > _children ? elapsed - _children : 0;
+    if(tracing.load(std::memory_order_relaxed))
+        profile.events.push_back(
+                trace_event{_name, _start, elapsed, profile.index});
+}
+
+void chase::setProfilingEnabled(bool enable, bool trace)
+{
+    tracing.store(enable && trace);
+    enabled.store(enable);
+}
+
+bool chase::isProfilingEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void chase::resetProfile()
+{
+    std::lock_guard< std::mutex > lock(registryMutex);
+    for(auto & profile : registry)
+    {
+        std::lock_guard< std::mutex > local(profile->mutex);
+        profile->sites.clear();
+        profile->counters.clear();
+        profile->events.clear();
+    }
+}
+
+void chase::addProfileCounter(const char * name, int64_t value)
+{
+    if(!enabled.load(std::memory_order_relaxed)) return;
+    thread_profile & profile = getLocalProfile();
+    std::lock_guard< std::mutex > lock(profile.mutex);
+    profile.counters[name] += value;
+}
+
+std::vector< profile_entry > chase::getProfileSummary()
+{
+    // Sites are merged by name: the same literal may have several
+    // addresses.
+    std::map< std::string, site_stats > merged;
+    {
+        std::lock_guard< std::mutex > lock(registryMutex);
+        for(auto & profile : registry)
+        {
+            std::lock_guard< std::mutex > local(profile->mutex);
+            for(auto & site : profile->sites)
+            {
+                site_stats & s = merged[site.first];
+                s.calls += site.second.calls;
+                s.total += site.second.total;
+                s.self += site.second.self;
+            }
+        }
+    }
+
+    std::vector< profile_entry > summary;
+    for(auto & site : merged)
+        summary.push_back(profile_entry{site.first, site.second.calls,
+                                        site.second.total, site.second.self});
+    std::stable_sort(summary.begin(), summary.end(),
+                     [](const profile_entry & a, const profile_entry & b) {
+                         return a.self > b.self;
+                     });
+    return summary;
+}
+
+std::map< std::string, int64_t > chase::getProfileCounters()
+{
+    std::map< std::string, int64_t > merged;
+    std::lock_guard< std::mutex > lock(registryMutex);
+    for(auto & profile : registry)
+    {
+        std::lock_guard< std::mutex > local(profile->mutex);
+        for(auto & counter : profile->counters)
+            merged[counter.first] += counter.second;
+    }
+    return merged;
+}
+
+std::vector< trace_event > chase::getProfileTrace()
+{
+    std::vector< trace_event > trace;
+    {
+        std::lock_guard< std::mutex > lock(registryMutex);
+        for(auto & profile : registry)
+        {
+            std::lock_guard< std::mutex > local(profile->mutex);
+            trace.insert(trace.end(), profile->events.begin(),
+                         profile->events.end());
+        }
+    }
+    std::stable_sort(trace.begin(), trace.end(),
+                     [](const trace_event & a, const trace_event & b) {
+                         return a.start < b.start;
+                     });
+    return trace;
+}
+
+void chase::printProfileSummary(std::ostream & out)
+{
+    auto summary = getProfileSummary();
+    out << std::left << std::setw(40) << "scope" << std::right
+        << std::setw(12) << "calls" << std::setw(14) << "total (ms)"
+        << std::setw(14) << "self (ms)" << std::setw(14) << "avg (us)"
+        << "\n";
+    out << std::fixed;
+    for(auto & e : summary)
+    {
+        out << std::left << std::setw(40) << e.name << std::right
+            << std::setw(12) << e.calls
+            << std::setw(14) << std::setprecision(3) << e.total / 1e6
+            << std::setw(14) << std::setprecision(3) << e.self / 1e6
+            << std::setw(14) << std::setprecision(3)
+            << (e.calls > 0 ? e.total / 1e3 / e.calls : 0.0)
+            << "\n";
+    }
+    auto counters = getProfileCounters();
+    if(!counters.empty()) out << "\n";
+    for(auto & c : counters)
+        out << std::left << std::setw(40) << c.first << std::right
+            << std::setw(12) << c.second << "\n";
+    out << std::defaultfloat;
+}
+
+void chase::writeChromeTrace(std::ostream & out)
+{
+    auto trace = getProfileTrace();
+    auto counters = getProfileCounters();
+
+    // Complete events ("X"), with times in microseconds.
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    out << std::fixed << std::setprecision(3);
+    for(auto & e : trace)
+    {
+        out << (first ? "\n" : ",\n") << "{\"name\":\"";
+        writeEscaped(out, e.name);
+        out << "\",\"cat\":\"chase\",\"ph\":\"X\",\"ts\":" << e.start / 1e3
+            << ",\"dur\":" << e.duration / 1e3
+            << ",\"pid\":0,\"tid\":" << e.thread << "}";
+        first = false;
+    }
+    if(!counters.empty())
+    {
+        out << (first ? "\n" : ",\n")
+            << "{\"name\":\"counters\",\"ph\":\"C\",\"ts\":" << now() / 1e3
+            << ",\"pid\":0,\"args\":{";
+        bool firstCounter = true;
+        for(auto & c : counters)
+        {
+            out << (firstCounter ? "\"" : ",\"");
+            writeEscaped(out, c.first);
+            out << "\":" << c.second;
+            firstCounter = false;
+        }
+        out << "}}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    out << std::defaultfloat;
+}
@@ -0,0 +1,236 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/Rational.hh"
+#include "utilities/IOUtils.hh"
+
+#include <cmath>
+#include <limits>
+
+using namespace chase;
+
+namespace {
+
+    __extension__ typedef __int128 wide;
+
+    wide gcd(wide a, wide b)
+    {
+        if(a < 0) a = -a;
+        if(b < 0) b = -b;
+        while(b != 0)
+        {
+            wide t = a % b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+
+    int64_t narrow(wide v)
+    {
+        if(v > std::numeric_limits< int64_t >::max() ||
+           v < -std::numeric_limits< int64_t >::max())
+            messageError("Rational: arithmetic overflow.");
+        return static_cast< int64_t >(v);
+    }
+
+    Rational make(wide num, wide den)
+    {
+        if(den == 0)
+            messageError("Rational: division by zero.");
+        if(den < 0)
+        {
+            num = -num;
+            den = -den;
+        }
+        wide g = gcd(num, den);
+        if(g > 1)
+        {
+            num /= g;
+            den /= g;
+        }
+        return Rational(narrow(num), narrow(den));
+    }
+}
+
+Rational::Rational(int64_t numerator, int64_t denominator) :
+    _num(numerator),
+    _den(denominator)
+{
+    if(_den == 0)
+        messageError("Rational: division by zero.");
+    if(_den < 0)
+    {
+        _num = -_num;
+        _den = -_den;
+    }
+    int64_t g = static_cast< int64_t >(gcd(_num, _den));
+    if(g > 1)
+    {
+        _num /= g;
+        _den /= g;
+    }
+}
+
+Rational Rational::fromDouble(double value)
+{
+    if(std::isnan(value) || std::isinf(value) ||
+       std::fabs(value) >= 9.0e18)
+        messageError("Rational: the value is not representable.");
+
+    // Continued fraction expansion, stopped when the approximation is
+    // exact up to the precision of the double, or the denominator grows
+    // too much.
+    const int64_t maxDen = 1000000000;
+    int64_t p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+    double x = value;
+    for(int i = 0; i < 64; ++i)
+    {
+        double a = std::floor(x);
+        auto ai = static_cast< int64_t >(a);
+        wide p2 = static_cast< wide >(ai) * p1 + p0;
+        wide q2 = static_cast< wide >(ai) * q1 + q0;
+        if(q2 > maxDen || p2 > std::numeric_limits< int64_t >::max() ||
+           p2 < -std::numeric_limits< int64_t >::max())
+            break;
+        p0 = p1; q0 = q1;
+        p1 = static_cast< int64_t >(p2);
+        q1 = static_cast< int64_t >(q2);
+        double frac = x - a;
+        if(std::fabs(static_cast< double >(p1) / q1 - value) <=
+           std::fabs(value) * 1e-15 || frac == 0.0)
+            break;
+        x = 1.0 / frac;
+    }
+    return Rational(p1, q1);
+}
+
+int64_t Rational::getNumerator() const
+{
+    return _num;
+}
+
+int64_t Rational::getDenominator() const
+{
+    return _den;
+}
+
+double Rational::toDouble() const
+{
+    return static_cast< double >(_num) / static_cast< double >(_den);
+}
+
+bool Rational::isInteger() const
+{
+    return _den == 1;
+}
+
+Rational Rational::floor() const
+{
+    int64_t q = _num / _den;
+    if(_num % _den != 0 && _num < 0) --q;
+    return Rational(q);
+}
+
+Rational Rational::ceil() const
+{
+    int64_t q = _num / _den;
+    if(_num % _den != 0 && _num > 0) ++q;
+    return Rational(q);
+}
+
+int Rational::sign() const
+{
+    return (_num > 0) - (_num < 0);
+}
+
+std::string Rational::getString() const
+{
+    if(_den == 1) return std::to_string(_num);
+    return std::to_string(_num) + "/" + std::to_string(_den);
+}
+
+Rational Rational::operator-() const
+{
+    return Rational(-_num, _den);
+}
+
+Rational Rational::operator+(const Rational & o) const
+{
+    if(_den == o._den) return make(static_cast< wide >(_num) + o._num, _den);
+    return make(static_cast< wide >(_num) * o._den +
+                static_cast< wide >(o._num) * _den,
+                static_cast< wide >(_den) * o._den);
+}
+
+Rational Rational::operator-(const Rational & o) const
+{
+    return *this + (-o);
+}
+
+Rational Rational::operator*(const Rational & o) const
+{
+    return make(static_cast< wide >(_num) * o._num,
+                static_cast< wide >(_den) * o._den);
+}
+
+Rational Rational::operator/(const Rational & o) const
+{
+    return make(static_cast< wide >(_num) * o._den,
+                static_cast< wide >(_den) * o._num);
+}
+
+Rational & Rational::operator+=(const Rational & o)
+{
+    return *this = *this + o;
+}
+
+Rational & Rational::operator-=(const Rational & o)
+{
+    return *this = *this - o;
+}
+
+Rational & Rational::operator*=(const Rational & o)
+{
+    return *this = *this * o;
+}
+
+Rational & Rational::operator/=(const Rational & o)
+{
+    return *this = *this / o;
+}
+
+bool Rational::operator==(const Rational & o) const
+{
+    return _num == o._num && _den == o._den;
+}
+
+bool Rational::operator!=(const Rational & o) const
+{
+    return !(*this == o);
+}
+
+bool Rational::operator<(const Rational & o) const
+{
+    return static_cast< wide >(_num) * o._den <
+           static_cast< wide >(o._num) * _den;
+}
+
+bool Rational::operator<=(const Rational & o) const
+{
+    return !(o < *this);
+}
+
+bool Rational::operator>(const Rational & o) const
+{
+    return o < *this;
+}
+
+bool Rational::operator>=(const Rational & o) const
+{
+    return !(*this < o);
+}
@@ -0,0 +1,220 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/ReachabilityIndex.hh"
+#include "utilities/GraphUtilities.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+using namespace chase;
+
+namespace {
+
+    const unsigned int none = std::numeric_limits< unsigned int >::max();
+
+    /// @brief Marks of the components visited by the searches of the
+    /// current thread. A component is visited when its mark equals the
+    /// epoch of the search.
+    thread_local std::vector< unsigned int > searchMarks;
+    thread_local unsigned int searchEpoch = 0;
+
+}
+
+ReachabilityIndex::ReachabilityIndex( Graph * graph, size_t maxMatrixBytes,
+                                      unsigned int labelings ) :
+    _component(),
+    _components(0),
+    _dag(),
+    _words(0),
+    _matrix(),
+    _labelings(std::max(labelings, 1u)),
+    _labels()
+{
+    _build(graph->getAdjacency(), maxMatrixBytes);
+}
+
+ReachabilityIndex::ReachabilityIndex( const compact_adjacency & adjacency,
+                                      size_t maxMatrixBytes,
+                                      unsigned int labelings ) :
+    _component(),
+    _components(0),
+    _dag(),
+    _words(0),
+    _matrix(),
+    _labelings(std::max(labelings, 1u)),
+    _labels()
+{
+    _build(adjacency, maxMatrixBytes);
+}
+
+void ReachabilityIndex::_build( const compact_adjacency & adjacency,
+                                size_t maxMatrixBytes )
+{
+    CHASE_PROFILE_SCOPE("ReachabilityIndex::build");
+    _components = getStronglyConnectedComponents(adjacency, _component);
+    _dag = getCondensation(adjacency, _component, _components);
+    CHASE_PROFILE_COUNT("ReachabilityIndex::components", _components);
+
+    _words = (static_cast< size_t >(_components) + 63) / 64;
+    if( _words * _components * sizeof(uint64_t) <= maxMatrixBytes )
+    {
+        // The components reached by c have lower numbers, hence their rows
+        // are complete when the row of c is computed.
+        _matrix.assign(_words * _components, 0);
+        for( unsigned int c = 0; c < _components; ++c )
+        {
+            uint64_t * row = &_matrix[c * _words];
+            row[c / 64] |= uint64_t(1) << (c % 64);
+            for( unsigned int i = _dag.offsets[c]; i < _dag.offsets[c + 1]; ++i )
+            {
+                const uint64_t * other = &_matrix[_dag.targets[i] * _words];
+                // Rows of lower components end with zero words.
+                size_t words = _dag.targets[i] / 64 + 1;
+                for( size_t w = 0; w < words; ++w ) row[w] |= other[w];
+            }
+        }
+        return;
+    }
+
+    // Interval labels: post-order ranks of several depth-first traversals,
+    // with different orders of the roots and of the children.
+    _labels.assign(2 * static_cast< size_t >(_components) * _labelings, 0);
+    std::vector< unsigned int > visited(_components, none);
+    std::vector< std::pair< unsigned int, unsigned int > > calls;
+    for( unsigned int l = 0; l < _labelings; ++l )
+    {
+        bool reverse = (l % 2) == 1;
+        // Sources have the highest numbers: the first traversals start from
+        // them, the others from rotations of the order.
+        uint64_t shift = l < 2 ? 0 : (l * 0x9e3779b9ull) % _components;
+        unsigned int rank = 0;
+        for( unsigned int r = 0; r < _components; ++r )
+        {
+            auto root = static_cast< unsigned int >(
+                    (_components - 1 - r + shift) % _components);
+            if( visited[root] == l ) continue;
+            visited[root] = l;
+            _labels[2 * (root * _labelings + l)] = none;
+            calls.emplace_back(root, 0);
+
+            while( ! calls.empty() )
+            {
+                unsigned int c = calls.back().first;
+                unsigned int & next = calls.back().second;
+                unsigned int degree = _dag.offsets[c + 1] - _dag.offsets[c];
+                if( next < degree )
+                {
+                    unsigned int i = reverse ? degree - 1 - next : next;
+                    ++next;
+                    unsigned int d = _dag.targets[_dag.offsets[c] + i];
+                    if( visited[d] != l )
+                    {
+                        visited[d] = l;
+                        _labels[2 * (d * _labelings + l)] = none;
+                        calls.emplace_back(d, 0);
+                    }
+                    continue;
+                }
+                calls.pop_back();
+
+                unsigned int * label = &_labels[2 * (c * _labelings + l)];
+                label[1] = rank++;
+                label[0] = std::min(label[0], label[1]);
+                for( unsigned int i = _dag.offsets[c];
+                     i < _dag.offsets[c + 1]; ++i )
+                    label[0] = std::min(
+                            label[0],
+                            _labels[2 * (_dag.targets[i] * _labelings + l)]);
+            }
+        }
+    }
+}
+
+bool ReachabilityIndex::reaches( unsigned int source,
+                                 unsigned int target ) const
+{
+    if( source >= _component.size() || target >= _component.size() )
+        return false;
+    unsigned int c = _component[source];
+    unsigned int d = _component[target];
+    if( c == d ) return true;
+    // Edges of the condensation go towards lower numbers.
+    if( c < d ) return false;
+    if( ! _matrix.empty() )
+        return (_matrix[c * _words + d / 64] >> (d % 64)) & 1;
+    if( ! _contains(c, d) ) return false;
+    return _search(c, d);
+}
+
+bool ReachabilityIndex::_contains( unsigned int c, unsigned int d ) const
+{
+    const unsigned int * lc = &_labels[2 * static_cast< size_t >(c) * _labelings];
+    const unsigned int * ld = &_labels[2 * static_cast< size_t >(d) * _labelings];
+    for( unsigned int l = 0; l < _labelings; ++l )
+    {
+        if( lc[2 * l] > ld[2 * l] || ld[2 * l + 1] > lc[2 * l + 1] )
+            return false;
+    }
+    return true;
+}
+
+bool ReachabilityIndex::_search( unsigned int source,
+                                 unsigned int target ) const
+{
+    if( searchMarks.size() < _components )
+        searchMarks.assign(_components, 0);
+    if( ++searchEpoch == 0 )
+    {
+        std::fill(searchMarks.begin(), searchMarks.end(), 0);
+        searchEpoch = 1;
+    }
+
+    std::vector< unsigned int > stack(1, source);
+    searchMarks[source] = searchEpoch;
+    while( ! stack.empty() )
+    {
+        unsigned int c = stack.back();
+        stack.pop_back();
+        for( unsigned int i = _dag.offsets[c]; i < _dag.offsets[c + 1]; ++i )
+        {
+            unsigned int d = _dag.targets[i];
+            if( d == target ) return true;
+            if( d < target || searchMarks[d] == searchEpoch ) continue;
+            searchMarks[d] = searchEpoch;
+            if( _contains(d, target) ) stack.push_back(d);
+        }
+    }
+    return false;
+}
+
+unsigned int ReachabilityIndex::getComponent( unsigned int node ) const
+{
+    if( node >= _component.size() )
+        messageError("Node out of the graph: " + std::to_string(node));
+    return _component[node];
+}
+
+unsigned int ReachabilityIndex::getComponentsCount() const
+{
+    return _components;
+}
+
+bool ReachabilityIndex::isDense() const
+{
+    return _labels.empty();
+}
+
+size_t ReachabilityIndex::getBytes() const
+{
+    return sizeof(unsigned int) * (_component.size() + _dag.offsets.size() +
+                                   _dag.targets.size() + _labels.size()) +
+           sizeof(uint64_t) * _matrix.size();
+}
@@ -0,0 +1,433 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/ShortestPaths.hh"
+#include "representation/IntegerValue.hh"
+#include "representation/RealValue.hh"
+#include "utilities/IOUtils.hh"
+#include "utilities/Profiler.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <set>
+#include <utility>
+
+using namespace chase;
+
+namespace {
+
+    const unsigned int none = std::numeric_limits< unsigned int >::max();
+    const double unreached = std::numeric_limits< double >::infinity();
+
+    /// @brief Binary heap of (distance, node) pairs, with lazy deletion.
+    class BinaryHeap {
+    public:
+        bool empty() const { return _heap.empty(); }
+
+        void push( double distance, unsigned int node )
+        {
+            _heap.emplace(distance, node);
+        }
+
+        std::pair< double, unsigned int > pop()
+        {
+            auto top = _heap.top();
+            _heap.pop();
+            return top;
+        }
+
+    protected:
+        std::priority_queue< std::pair< double, unsigned int >,
+                             std::vector< std::pair< double, unsigned int > >,
+                             std::greater< std::pair< double, unsigned int > > >
+            _heap;
+    };
+
+    /// @brief Monotone radix heap, with lazy deletion. Keys are the bits of
+    /// the distances: for non-negative doubles, they are ordered as the
+    /// distances. Bucket b holds the keys whose highest bit differing from
+    /// the last key popped is b - 1.
+    class RadixHeap {
+    public:
+        RadixHeap() : _buckets(65), _last(0), _size(0) {}
+
+        bool empty() const { return _size == 0; }
+
+        void push( double distance, unsigned int node )
+        {
+            uint64_t key = _key(distance);
+            _buckets[_bucket(key)].emplace_back(key, node);
+            ++_size;
+        }
+
+        std::pair< double, unsigned int > pop()
+        {
+            if( _buckets[0].empty() )
+            {
+                size_t b = 1;
+                while( _buckets[b].empty() ) ++b;
+                // The minimum of the bucket becomes the last key, and the
+                // keys of the bucket move to lower buckets.
+                _last = _buckets[b][0].first;
+                for( auto & entry : _buckets[b] )
+                    _last = std::min(_last, entry.first);
+                for( auto & entry : _buckets[b] )
+                    _buckets[_bucket(entry.first)].push_back(entry);
+                _buckets[b].clear();
+            }
+            auto entry = _buckets[0].back();
+            _buckets[0].pop_back();
+            --_size;
+            double distance;
+            std::memcpy(&distance, &entry.first, sizeof(distance));
+            return std::make_pair(distance, entry.second);
+        }
+
+    protected:
+        std::vector< std::vector< std::pair< uint64_t, unsigned int > > >
+            _buckets;
+        uint64_t _last;
+        size_t _size;
+
+        static uint64_t _key( double distance )
+        {
+            // Adding zero turns -0 into +0.
+            distance += 0.0;
+            uint64_t key;
+            std::memcpy(&key, &distance, sizeof(key));
+            return key;
+        }
+
+        size_t _bucket( uint64_t key ) const
+        {
+            uint64_t diff = key ^ _last;
+            if( diff == 0 ) return 0;
+            // One plus the index of the highest set bit, by halving.
+            size_t b = 1;
+            for( unsigned int shift = 32; shift > 0; shift /= 2 )
+            {
+                if( (diff >> shift) == 0 ) continue;
+                diff >>= shift;
+                b += shift;
+            }
+            return b;
+        }
+    };
+
+    /// @brief Nodes and edges excluded from a search.
+    typedef struct search_blocks {
+        std::vector< char > nodes;
+        std::vector< char > edges;
+    } search_blocks;
+
+    void initialize( shortest_paths & result, unsigned int size,
+                     unsigned int source )
+    {
+        result.source = source;
+        result.distances.assign(size, unreached);
+        result.parents.assign(size, none);
+        result.edges.assign(size, none);
+        result.distances[source] = 0.0;
+    }
+
+    /// @brief Dijkstra algorithm, stopping when the target is settled, and
+    /// skipping the blocked nodes and edges, if any.
+    template< typename Heap >
+    void dijkstra( const compact_adjacency & adjacency,
+                   const std::vector< double > & weights,
+                   unsigned int source, unsigned int target,
+                   const search_blocks * blocks,
+                   shortest_paths & result )
+    {
+        initialize(result, adjacency.getSize(), source);
+        Heap heap;
+        heap.push(0.0, source);
+        while( ! heap.empty() )
+        {
+            auto top = heap.pop();
+            unsigned int v = top.second;
+            // Stale entries of nodes already settled.
+            if( top.first > result.distances[v] ) continue;
+            if( v == target ) return;
+            for( unsigned int i = adjacency.offsets[v];
+                 i < adjacency.offsets[v + 1]; ++i )
+            {
+                unsigned int w = adjacency.targets[i];
+                unsigned int e = adjacency.edges[i];
+                if( blocks != nullptr &&
+                    (blocks->nodes[w] || blocks->edges[e]) ) continue;
+                double distance = top.first + weights[e];
+                if( distance >= result.distances[w] ) continue;
+                result.distances[w] = distance;
+                result.parents[w] = v;
+                result.edges[w] = e;
+                heap.push(distance, w);
+            }
+        }
+    }
+
+    void dijkstra( const compact_adjacency & adjacency,
+                   const std::vector< double > & weights,
+                   unsigned int source, unsigned int target,
+                   const search_blocks * blocks, dijkstra_heap heap,
+                   shortest_paths & result )
+    {
+        if( heap == radix_heap )
+            dijkstra< RadixHeap >(adjacency, weights, source, target, blocks,
+                                  result);
+        else
+            dijkstra< BinaryHeap >(adjacency, weights, source, target, blocks,
+                                   result);
+    }
+
+    /// @brief Function checking the arguments of the searches.
+    void checkArguments( const compact_adjacency & adjacency,
+                         const std::vector< double > & weights,
+                         unsigned int source, bool negative )
+    {
+        if( source >= adjacency.getSize() )
+            messageError("Node out of the graph: " + std::to_string(source));
+        if( adjacency.edges.size() != adjacency.targets.size() )
+            messageError("The adjacency has no edge indexes.");
+        for( auto e : adjacency.edges )
+        {
+            if( e >= weights.size() )
+                messageError("Missing weight of edge " + std::to_string(e));
+            if( ! negative && weights[e] < 0 )
+                messageError("Negative weight of edge " + std::to_string(e));
+        }
+    }
+
+    /// @brief Path from the source of a search to a node.
+    weighted_path getWeightedPath( const shortest_paths & paths,
+                                   unsigned int target )
+    {
+        weighted_path path;
+        path.length = paths.distances[target];
+        for( unsigned int v = target; v != paths.source;
+             v = paths.parents[v] )
+        {
+            path.nodes.push_back(v);
+            path.edges.push_back(paths.edges[v]);
+        }
+        path.nodes.push_back(paths.source);
+        std::reverse(path.nodes.begin(), path.nodes.end());
+        std::reverse(path.edges.begin(), path.edges.end());
+        return path;
+    }
+
+    /// @brief Order of the candidate paths: by length, then by edges, so
+    /// that the result does not depend on the order of the searches.
+    struct PathOrder {
+        bool operator()( const weighted_path & a,
+                         const weighted_path & b ) const
+        {
+            if( a.length != b.length ) return a.length < b.length;
+            return a.edges < b.edges;
+        }
+    };
+
+}
+
+std::vector< unsigned int > shortest_paths::getPath(
+        unsigned int target ) const
+{
+    std::vector< unsigned int > path;
+    if( target >= distances.size() || distances[target] == unreached )
+        return path;
+    for( unsigned int v = target; v != source; v = parents[v] )
+        path.push_back(v);
+    path.push_back(source);
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+std::vector< double > chase::getEdgeWeights( Graph * graph, double unweighted )
+{
+    CHASE_PROFILE_SCOPE("getEdgeWeights");
+    std::vector< double > weights(graph->getEdgesCount(), unweighted);
+    // The edges loaded in bulk have their weights in an array already.
+    const std::vector< double > & bulk = graph->getBulkWeights();
+    std::copy(bulk.begin(), bulk.end(), weights.begin());
+    for( unsigned int i = graph->getBulkEdgesCount();
+         i < graph->getEdgesCount(); ++i )
+    {
+        auto edge = dynamic_cast< WeightedEdge * >(graph->getEdgeAt(i));
+        if( edge == nullptr || edge->getWeight() == nullptr ) continue;
+        Value * weight = edge->getWeight();
+        if( auto integer = dynamic_cast< IntegerValue * >(weight) )
+            weights[i] = static_cast< double >(integer->getValue());
+        else if( auto real = dynamic_cast< RealValue * >(weight) )
+            weights[i] = real->getValue();
+        else
+            messageError("Weight is not numeric: " + weight->getString(),
+                         edge);
+    }
+    return weights;
+}
+
+shortest_paths chase::findShortestPaths( const compact_adjacency & adjacency,
+                                         const std::vector< double > & weights,
+                                         unsigned int source,
+                                         dijkstra_heap heap )
+{
+    CHASE_PROFILE_SCOPE("findShortestPaths");
+    checkArguments(adjacency, weights, source, false);
+    shortest_paths result;
+    dijkstra(adjacency, weights, source, none, nullptr, heap, result);
+    return result;
+}
+
+bool chase::findShortestPathsBellmanFord(
+        const compact_adjacency & adjacency,
+        const std::vector< double > & weights,
+        unsigned int source,
+        shortest_paths & result )
+{
+    CHASE_PROFILE_SCOPE("findShortestPathsBellmanFord");
+    checkArguments(adjacency, weights, source, true);
+    unsigned int size = adjacency.getSize();
+    initialize(result, size, source);
+
+    // Every round relaxes all the edges: after V - 1 rounds the distances
+    // are final, unless a negative cycle is reachable.
+    for( unsigned int round = 0; round < size; ++round )
+    {
+        bool changed = false;
+        for( unsigned int v = 0; v < size; ++v )
+        {
+            if( result.distances[v] == unreached ) continue;
+            for( unsigned int i = adjacency.offsets[v];
+                 i < adjacency.offsets[v + 1]; ++i )
+            {
+                unsigned int w = adjacency.targets[i];
+                double distance = result.distances[v] +
+                                  weights[adjacency.edges[i]];
+                if( distance >= result.distances[w] ) continue;
+                result.distances[w] = distance;
+                result.parents[w] = v;
+                result.edges[w] = adjacency.edges[i];
+                changed = true;
+            }
+        }
+        if( ! changed ) return true;
+    }
+    return false;
+}
+
+std::vector< weighted_path > chase::findKShortestPaths(
+        const compact_adjacency & adjacency,
+        const std::vector< double > & weights,
+        unsigned int source, unsigned int target, unsigned int k )
+{
+    CHASE_PROFILE_SCOPE("findKShortestPaths");
+    checkArguments(adjacency, weights, source, false);
+    if( target >= adjacency.getSize() )
+        messageError("Node out of the graph: " + std::to_string(target));
+
+    std::vector< weighted_path > result;
+    if( k == 0 ) return result;
+    shortest_paths paths;
+    dijkstra(adjacency, weights, source, target, nullptr, binary_heap, paths);
+    if( paths.distances[target] == unreached ) return result;
+    result.push_back(getWeightedPath(paths, target));
+
+    std::set< weighted_path, PathOrder > candidates;
+    std::set< std::vector< unsigned int > > found;
+    found.insert(result[0].edges);
+    search_blocks blocks;
+    blocks.nodes.assign(adjacency.getSize(), 0);
+    blocks.edges.assign(weights.size(), 0);
+
+    while( result.size() < k )
+    {
+        // The previous path is copied: result may grow below.
+        weighted_path previous = result.back();
+        double rootLength = 0.0;
+        for( size_t i = 0; i + 1 < previous.nodes.size(); ++i )
+        {
+            unsigned int spur = previous.nodes[i];
+            // The paths sharing the root leave the spur node by edges that
+            // cannot be used; the nodes of the root cannot be used either.
+            std::vector< unsigned int > blockedEdges;
+            for( auto & path : result )
+            {
+                if( path.edges.size() <= i ||
+                    ! std::equal(previous.edges.begin(),
+                                 previous.edges.begin() + i,
+                                 path.edges.begin()) ) continue;
+                blocks.edges[path.edges[i]] = 1;
+                blockedEdges.push_back(path.edges[i]);
+            }
+            for( size_t j = 0; j < i; ++j ) blocks.nodes[previous.nodes[j]] = 1;
+
+            dijkstra(adjacency, weights, spur, target, &blocks, binary_heap,
+                     paths);
+            if( paths.distances[target] != unreached )
+            {
+                weighted_path spurPath = getWeightedPath(paths, target);
+                weighted_path candidate;
+                candidate.nodes.assign(previous.nodes.begin(),
+                                       previous.nodes.begin() + i);
+                candidate.nodes.insert(candidate.nodes.end(),
+                                       spurPath.nodes.begin(),
+                                       spurPath.nodes.end());
+                candidate.edges.assign(previous.edges.begin(),
+                                       previous.edges.begin() + i);
+                candidate.edges.insert(candidate.edges.end(),
+                                       spurPath.edges.begin(),
+                                       spurPath.edges.end());
+                candidate.length = rootLength + spurPath.length;
+                if( found.insert(candidate.edges).second )
+                    candidates.insert(std::move(candidate));
+            }
+
+            for( auto e : blockedEdges ) blocks.edges[e] = 0;
+            for( size_t j = 0; j < i; ++j ) blocks.nodes[previous.nodes[j]] = 0;
+            rootLength += weights[previous.edges[i]];
+        }
+
+        if( candidates.empty() ) break;
+        result.push_back(*candidates.begin());
+        candidates.erase(candidates.begin());
+    }
+    CHASE_PROFILE_COUNT("findKShortestPaths::candidates", candidates.size());
+    return result;
+}
+
+std::vector< shortest_paths > chase::findShortestPathsFromSources(
+        const compact_adjacency & adjacency,
+        const std::vector< double > & weights,
+        const std::vector< unsigned int > & sources,
+        ThreadPool & pool,
+        dijkstra_heap heap )
+{
+    CHASE_PROFILE_SCOPE("findShortestPathsFromSources");
+    std::vector< shortest_paths > result(sources.size());
+    if( sources.empty() ) return result;
+    // The arguments are checked once, before the tasks, whose exceptions
+    // would only be reported as warnings.
+    checkArguments(adjacency, weights, sources[0], false);
+    for( auto source : sources )
+    {
+        if( source >= adjacency.getSize() )
+            messageError("Node out of the graph: " + std::to_string(source));
+    }
+
+    for( size_t i = 0; i < sources.size(); ++i )
+    {
+        pool.submit([&adjacency, &weights, &sources, &result, heap, i] {
+            dijkstra(adjacency, weights, sources[i], none, nullptr, heap,
+                     result[i]);
+        });
+    }
+    pool.wait();
+    return result;
+}
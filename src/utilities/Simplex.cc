@@ -0,0 +1,910 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/Simplex.hh"
+#include "representation.hh"
+#include "utilities/IOUtils.hh"
+
+#include <cmath>
+
+using namespace chase;
+
+namespace {
+
+    /// Comparisons used by the tableau. Doubles are compared with a
+    /// tolerance, rationals exactly.
+    template< typename T >
+    struct simplex_traits;
+
+    template<>
+    struct simplex_traits< double > {
+        static bool isZero(double v) { return std::fabs(v) < 1e-9; }
+        static bool less(double a, double b) { return a < b - 1e-9; }
+    };
+
+    template<>
+    struct simplex_traits< Rational > {
+        static bool isZero(const Rational & v) { return v.sign() == 0; }
+        static bool less(const Rational & a, const Rational & b)
+        {
+            return a < b;
+        }
+    };
+}
+
+// ---------------------------------------------------------------------------
+// SimplexTableau
+// ---------------------------------------------------------------------------
+
+template< typename T >
+SimplexTableau< T >::SimplexTableau() :
+    _conflict(false),
+    _pivots(0)
+{
+}
+
+template< typename T >
+SimplexTableau< T >::~SimplexTableau() = default;
+
+template< typename T >
+unsigned int SimplexTableau< T >::addVariable()
+{
+    auto var = static_cast< unsigned int >(_values.size());
+    for(auto & row : _rows)
+        row.push_back(T());
+    _rowOf.push_back(-1);
+    _values.push_back(T());
+    _lower.push_back({false, T()});
+    _upper.push_back({false, T()});
+    return var;
+}
+
+template< typename T >
+unsigned int SimplexTableau< T >::addRow(
+        const std::vector< std::pair< unsigned int, T > > & form)
+{
+    unsigned int var = addVariable();
+    std::vector< T > row(_values.size());
+    T value = T();
+    for(const auto & term : form)
+    {
+        // Basic variables are replaced by their definition.
+        int r = _rowOf[term.first];
+        if(r < 0)
+            row[term.first] += term.second;
+        else
+        {
+            const auto & def = _rows[r];
+            for(size_t k = 0; k < def.size(); ++k)
+                if(!simplex_traits< T >::isZero(def[k]))
+                    row[k] += term.second * def[k];
+        }
+        value += term.second * _values[term.first];
+    }
+    _values[var] = value;
+    _rowOf[var] = static_cast< int >(_rows.size());
+    _rows.push_back(std::move(row));
+    _basic.push_back(var);
+    return var;
+}
+
+template< typename T >
+void SimplexTableau< T >::_save(unsigned int var)
+{
+    if(_scopes.empty()) return;
+    _trail.push_back({var, _lower[var], _upper[var]});
+}
+
+template< typename T >
+void SimplexTableau< T >::assertLower(unsigned int var, const T & value)
+{
+    if(_lower[var].present && !simplex_traits< T >::less(_lower[var].value,
+                                                        value))
+        return;
+    _save(var);
+    _lower[var] = {true, value};
+    if(_upper[var].present &&
+       simplex_traits< T >::less(_upper[var].value, value))
+        _conflict = true;
+    if(_rowOf[var] < 0 && simplex_traits< T >::less(_values[var], value))
+        _update(var, value);
+}
+
+template< typename T >
+void SimplexTableau< T >::assertUpper(unsigned int var, const T & value)
+{
+    if(_upper[var].present && !simplex_traits< T >::less(value,
+                                                        _upper[var].value))
+        return;
+    _save(var);
+    _upper[var] = {true, value};
+    if(_lower[var].present &&
+       simplex_traits< T >::less(value, _lower[var].value))
+        _conflict = true;
+    if(_rowOf[var] < 0 && simplex_traits< T >::less(value, _values[var]))
+        _update(var, value);
+}
+
+template< typename T >
+void SimplexTableau< T >::assertBaseLower(unsigned int var, const T & value)
+{
+    if(_lower[var].present && !simplex_traits< T >::less(_lower[var].value,
+                                                        value))
+        return;
+    // The bounds saved on the trail are tightened as well, so that pop
+    // restores bounds including the new one.
+    const simplex_bound< T > * base = &_upper[var];
+    bool first = true;
+    for(auto & e : _trail)
+    {
+        if(e.var != var) continue;
+        if(first) base = &e.upper;
+        first = false;
+        if(!e.lower.present || simplex_traits< T >::less(e.lower.value, value))
+            e.lower = {true, value};
+    }
+    if(base->present && simplex_traits< T >::less(base->value, value))
+        _assertBaseConflict();
+    _lower[var] = {true, value};
+    if(_upper[var].present &&
+       simplex_traits< T >::less(_upper[var].value, value))
+        _conflict = true;
+    if(_rowOf[var] < 0 && simplex_traits< T >::less(_values[var], value))
+        _update(var, value);
+}
+
+template< typename T >
+void SimplexTableau< T >::assertBaseUpper(unsigned int var, const T & value)
+{
+    if(_upper[var].present && !simplex_traits< T >::less(value,
+                                                        _upper[var].value))
+        return;
+    const simplex_bound< T > * base = &_lower[var];
+    bool first = true;
+    for(auto & e : _trail)
+    {
+        if(e.var != var) continue;
+        if(first) base = &e.lower;
+        first = false;
+        if(!e.upper.present || simplex_traits< T >::less(value, e.upper.value))
+            e.upper = {true, value};
+    }
+    if(base->present && simplex_traits< T >::less(value, base->value))
+        _assertBaseConflict();
+    _upper[var] = {true, value};
+    if(_lower[var].present &&
+       simplex_traits< T >::less(value, _lower[var].value))
+        _conflict = true;
+    if(_rowOf[var] < 0 && simplex_traits< T >::less(value, _values[var]))
+        _update(var, value);
+}
+
+template< typename T >
+void SimplexTableau< T >::_assertBaseConflict()
+{
+    _conflict = true;
+    for(auto & scope : _scopes)
+        scope.second = true;
+}
+
+template< typename T >
+void SimplexTableau< T >::assertConflict()
+{
+    _conflict = true;
+}
+
+template< typename T >
+void SimplexTableau< T >::push()
+{
+    _scopes.emplace_back(_trail.size(), _conflict);
+}
+
+template< typename T >
+void SimplexTableau< T >::pop()
+{
+    if(_scopes.empty())
+        messageError("Simplex: pop without a matching push.");
+    size_t size = _scopes.back().first;
+    _conflict = _scopes.back().second;
+    _scopes.pop_back();
+    // Retracting bounds keeps the assignment valid: non-basic variables
+    // are within their (looser) bounds and the rows still hold.
+    while(_trail.size() > size)
+    {
+        const trail_entry & e = _trail.back();
+        _lower[e.var] = e.lower;
+        _upper[e.var] = e.upper;
+        _trail.pop_back();
+    }
+}
+
+template< typename T >
+void SimplexTableau< T >::_update(unsigned int var, const T & value)
+{
+    T delta = value - _values[var];
+    for(size_t r = 0; r < _rows.size(); ++r)
+    {
+        const T & a = _rows[r][var];
+        if(!simplex_traits< T >::isZero(a))
+            _values[_basic[r]] += a * delta;
+    }
+    _values[var] = value;
+}
+
+template< typename T >
+void SimplexTableau< T >::_pivot(unsigned int row, unsigned int var)
+{
+    unsigned int leaving = _basic[row];
+    std::vector< T > & def = _rows[row];
+
+    // Solve the row for the entering variable.
+    T inv = T(1) / def[var];
+    for(auto & a : def)
+        if(!simplex_traits< T >::isZero(a))
+            a = -a * inv;
+    def[leaving] = inv;
+    def[var] = T();
+
+    // Substitute the entering variable in the other rows.
+    for(size_t r = 0; r < _rows.size(); ++r)
+    {
+        if(r == row) continue;
+        std::vector< T > & other = _rows[r];
+        T c = other[var];
+        if(simplex_traits< T >::isZero(c)) continue;
+        other[var] = T();
+        for(size_t k = 0; k < def.size(); ++k)
+            if(!simplex_traits< T >::isZero(def[k]))
+                other[k] += c * def[k];
+    }
+
+    _basic[row] = var;
+    _rowOf[var] = static_cast< int >(row);
+    _rowOf[leaving] = -1;
+    ++_pivots;
+}
+
+template< typename T >
+void SimplexTableau< T >::_pivotAndUpdate(
+        unsigned int row, unsigned int var, const T & value)
+{
+    unsigned int leaving = _basic[row];
+    T theta = (value - _values[leaving]) / _rows[row][var];
+    _values[leaving] = value;
+    _values[var] += theta;
+    for(size_t r = 0; r < _rows.size(); ++r)
+    {
+        if(r == row) continue;
+        const T & a = _rows[r][var];
+        if(!simplex_traits< T >::isZero(a))
+            _values[_basic[r]] += a * theta;
+    }
+    _pivot(row, var);
+}
+
+template< typename T >
+simplex_result SimplexTableau< T >::check(size_t maxPivots)
+{
+    if(_conflict) return simplex_unsat;
+
+    typedef simplex_traits< T > tr;
+    size_t pivots = 0;
+    while(true)
+    {
+        // Bland's rule: the violated basic variable with smallest index.
+        int row = -1;
+        bool below = false;
+        for(size_t r = 0; r < _rows.size(); ++r)
+        {
+            unsigned int x = _basic[r];
+            if(row >= 0 && x > _basic[row]) continue;
+            if(_lower[x].present && tr::less(_values[x], _lower[x].value))
+            {
+                row = static_cast< int >(r);
+                below = true;
+            }
+            else if(_upper[x].present &&
+                    tr::less(_upper[x].value, _values[x]))
+            {
+                row = static_cast< int >(r);
+                below = false;
+            }
+        }
+        if(row < 0) return simplex_sat;
+        if(maxPivots != 0 && pivots >= maxPivots) return simplex_unknown;
+
+        // The non-basic variable with smallest index that can move the
+        // basic one towards its bound.
+        const std::vector< T > & def = _rows[row];
+        int entering = -1;
+        for(size_t j = 0; j < def.size(); ++j)
+        {
+            if(_rowOf[j] >= 0 || tr::isZero(def[j])) continue;
+            bool canIncrease = !_upper[j].present ||
+                               tr::less(_values[j], _upper[j].value);
+            bool canDecrease = !_lower[j].present ||
+                               tr::less(_lower[j].value, _values[j]);
+            bool positive = def[j] > T();
+            if((below && ((positive && canIncrease) ||
+                          (!positive && canDecrease))) ||
+               (!below && ((positive && canDecrease) ||
+                           (!positive && canIncrease))))
+            {
+                entering = static_cast< int >(j);
+                break;
+            }
+        }
+        if(entering < 0) return simplex_unsat;
+
+        unsigned int x = _basic[row];
+        _pivotAndUpdate(static_cast< unsigned int >(row),
+                        static_cast< unsigned int >(entering),
+                        below ? _lower[x].value : _upper[x].value);
+        ++pivots;
+    }
+}
+
+template< typename T >
+void SimplexTableau< T >::setBasis(
+        const std::vector< bool > & basic, const std::vector< int > & atUpper)
+{
+    for(unsigned int j = 0; j < _values.size() && j < basic.size(); ++j)
+    {
+        if(!basic[j] || _rowOf[j] >= 0) continue;
+        for(size_t r = 0; r < _rows.size(); ++r)
+        {
+            unsigned int x = _basic[r];
+            if(x < basic.size() && basic[x]) continue;
+            if(simplex_traits< T >::isZero(_rows[r][j])) continue;
+            _pivot(static_cast< unsigned int >(r), j);
+            break;
+        }
+    }
+
+    for(unsigned int j = 0; j < _values.size(); ++j)
+    {
+        if(_rowOf[j] >= 0) continue;
+        int where = j < atUpper.size() ? atUpper[j] : 0;
+        T target = _values[j];
+        if(where > 0 && _upper[j].present)
+            target = _upper[j].value;
+        else if(where < 0 && _lower[j].present)
+            target = _lower[j].value;
+        if(_lower[j].present && target < _lower[j].value)
+            target = _lower[j].value;
+        if(_upper[j].present && target > _upper[j].value)
+            target = _upper[j].value;
+        if(target != _values[j])
+            _update(j, target);
+    }
+}
+
+template< typename T >
+void SimplexTableau< T >::setValue(unsigned int var, const T & value)
+{
+    if(_rowOf[var] >= 0)
+        messageError("Simplex: cannot set the value of a basic variable.");
+    if((_lower[var].present && value < _lower[var].value) ||
+       (_upper[var].present && value > _upper[var].value))
+        messageError("Simplex: value out of the bounds.");
+    _update(var, value);
+}
+
+template< typename T >
+bool SimplexTableau< T >::pivotOut(
+        unsigned int var, const std::vector< bool > & allowed)
+{
+    int row = _rowOf[var];
+    if(row < 0) return true;
+    const std::vector< T > & def = _rows[row];
+    for(unsigned int j = 0; j < def.size(); ++j)
+    {
+        if(j >= allowed.size() || !allowed[j] || _rowOf[j] >= 0) continue;
+        if(simplex_traits< T >::isZero(def[j])) continue;
+        _pivot(static_cast< unsigned int >(row), j);
+        return true;
+    }
+    return false;
+}
+
+template< typename T >
+bool SimplexTableau< T >::isBasic(unsigned int var) const
+{
+    return _rowOf[var] >= 0;
+}
+
+template< typename T >
+const T & SimplexTableau< T >::getValue(unsigned int var) const
+{
+    return _values[var];
+}
+
+template< typename T >
+const simplex_bound< T > & SimplexTableau< T >::getLower(
+        unsigned int var) const
+{
+    return _lower[var];
+}
+
+template< typename T >
+const simplex_bound< T > & SimplexTableau< T >::getUpper(
+        unsigned int var) const
+{
+    return _upper[var];
+}
+
+template< typename T >
+size_t SimplexTableau< T >::getVariablesCount() const
+{
+    return _values.size();
+}
+
+template< typename T >
+size_t SimplexTableau< T >::getPivotsCount() const
+{
+    return _pivots;
+}
+
+template class chase::SimplexTableau< double >;
+template class chase::SimplexTableau< Rational >;
+
+// ---------------------------------------------------------------------------
+// SimplexSolver
+// ---------------------------------------------------------------------------
+
+SimplexSolver::SimplexSolver() :
+    _fastPath(true),
+    _branchLimit(10000)
+{
+}
+
+SimplexSolver::~SimplexSolver() = default;
+
+unsigned int SimplexSolver::_addColumn()
+{
+    unsigned int col = _exact.addVariable();
+    _fast.addVariable();
+    _declarations.push_back(nullptr);
+    _integers.push_back(false);
+    return col;
+}
+
+unsigned int SimplexSolver::addVariable(DataDeclaration * declaration)
+{
+    auto it = _variablesIndex.find(declaration);
+    if(it != _variablesIndex.end()) return it->second;
+
+    unsigned int col = _addColumn();
+    _declarations[col] = declaration;
+    _variablesIndex.insert(std::make_pair(declaration, col));
+
+    Type * type = declaration->getType();
+    if(type == nullptr) return col;
+    if(type->IsA() == integer_node)
+    {
+        _integers[col] = true;
+        auto t = static_cast< Integer * >(type);
+        if(t->getMin() > -infinity)
+            _assertBase(col, op_ge, Rational(t->getMin()));
+        if(t->getMax() < infinity)
+            _assertBase(col, op_le, Rational(t->getMax()));
+    }
+    else if(type->IsA() == real_node)
+    {
+        auto t = static_cast< Real * >(type);
+        double bounds[2] = {t->getMin(), t->getMax()};
+        for(int i = 0; i < 2; ++i)
+        {
+            if(std::fabs(bounds[i]) >= static_cast< double >(infinity))
+                continue;
+            Rational value = Rational::fromDouble(bounds[i]);
+            if(value.toDouble() != bounds[i])
+                messageWarning("Simplex: approximated bound of "
+                               + declaration->getName()->getString() + ".",
+                               declaration);
+            _assertBase(col, i == 0 ? op_ge : op_le, value);
+        }
+    }
+    else if(type->IsA() == boolean_node)
+    {
+        _integers[col] = true;
+        _assertBase(col, op_ge, Rational(0));
+        _assertBase(col, op_le, Rational(1));
+    }
+    return col;
+}
+
+void SimplexSolver::_linearize(Value * value, linear_form & form,
+                               Rational & constant, const Rational & scale)
+{
+    switch(value->IsA())
+    {
+        case integerValue_node:
+            constant += scale *
+                    Rational(static_cast< IntegerValue * >(value)->getValue());
+            return;
+        case realValue_node:
+            constant += scale * Rational::fromDouble(
+                    static_cast< RealValue * >(value)->getValue());
+            return;
+        case booleanValue_node:
+            if(static_cast< BooleanValue * >(value)->getValue())
+                constant += scale;
+            return;
+        case identifier_node:
+        {
+            DataDeclaration * d =
+                    static_cast< Identifier * >(value)->getDeclaration();
+            if(d->IsA() == constant_node &&
+               static_cast< Constant * >(d)->getValue() != nullptr)
+            {
+                _linearize(static_cast< Constant * >(d)->getValue(),
+                           form, constant, scale);
+                return;
+            }
+            unsigned int var = addVariable(d);
+            Rational & c = form[var];
+            c += scale;
+            if(c.sign() == 0) form.erase(var);
+            return;
+        }
+        case expression_node:
+            break;
+        default:
+            messageError("Simplex: unsupported value.", value);
+            return;
+    }
+
+    auto e = static_cast< Expression * >(value);
+    if(e->getOp1() == nullptr)
+        messageError("Simplex: missing operand.", e);
+
+    switch(e->getOperator())
+    {
+        case op_plus:
+            _linearize(e->getOp1(), form, constant, scale);
+            _linearize(e->getOp2(), form, constant, scale);
+            break;
+        case op_minus:
+            if(e->getOp2() == nullptr)
+                _linearize(e->getOp1(), form, constant, -scale);
+            else
+            {
+                _linearize(e->getOp1(), form, constant, scale);
+                _linearize(e->getOp2(), form, constant, -scale);
+            }
+            break;
+        case op_multiply:
+        {
+            linear_form f1, f2;
+            Rational c1, c2;
+            _linearize(e->getOp1(), f1, c1, Rational(1));
+            _linearize(e->getOp2(), f2, c2, Rational(1));
+            if(!f1.empty() && !f2.empty())
+                messageError("Simplex: the expression is not linear.", e);
+            const linear_form & f = f1.empty() ? f2 : f1;
+            Rational k = scale * (f1.empty() ? c1 : c2);
+            constant += k * (f1.empty() ? c2 : c1);
+            for(const auto & t : f)
+            {
+                Rational & c = form[t.first];
+                c += k * t.second;
+                if(c.sign() == 0) form.erase(t.first);
+            }
+            break;
+        }
+        case op_divide:
+        {
+            linear_form f2;
+            Rational c2;
+            _linearize(e->getOp2(), f2, c2, Rational(1));
+            if(!f2.empty() || c2.sign() == 0)
+                messageError("Simplex: the expression is not linear.", e);
+            _linearize(e->getOp1(), form, constant, scale / c2);
+            break;
+        }
+        default:
+            messageError("Simplex: unsupported operator.", e);
+            break;
+    }
+}
+
+void SimplexSolver::_assert(unsigned int var, Operator op,
+                            const Rational & value)
+{
+    Rational lower = value;
+    Rational upper = value;
+    if(_integers[var])
+    {
+        lower = value.ceil();
+        upper = value.floor();
+    }
+    if(op == op_ge || op == op_eq)
+    {
+        _exact.assertLower(var, lower);
+        _fast.assertLower(var, lower.toDouble());
+    }
+    if(op == op_le || op == op_eq)
+    {
+        _exact.assertUpper(var, upper);
+        _fast.assertUpper(var, upper.toDouble());
+    }
+}
+
+void SimplexSolver::_assertBase(unsigned int var, Operator op,
+                                const Rational & value)
+{
+    Rational bound = value;
+    if(_integers[var])
+        bound = op == op_ge ? value.ceil() : value.floor();
+    if(op == op_ge)
+    {
+        _exact.assertBaseLower(var, bound);
+        _fast.assertBaseLower(var, bound.toDouble());
+    }
+    else
+    {
+        _exact.assertBaseUpper(var, bound);
+        _fast.assertBaseUpper(var, bound.toDouble());
+    }
+}
+
+void SimplexSolver::addConstraint(Constraint * constraint)
+{
+    addConstraint(constraint->getExpression());
+}
+
+void SimplexSolver::addConstraint(Expression * expression)
+{
+    if(expression == nullptr)
+        messageError("Simplex: missing constraint.");
+    Operator op = expression->getOperator();
+    if(op != op_le && op != op_ge && op != op_eq)
+        messageError("Simplex: the constraint must be a <=, >= or = "
+                     "relation.", expression);
+
+    // lhs - rhs op 0, i.e., form op -constant.
+    linear_form form;
+    Rational constant;
+    _linearize(expression->getOp1(), form, constant, Rational(1));
+    _linearize(expression->getOp2(), form, constant, Rational(-1));
+    Rational bound = -constant;
+
+    if(form.empty())
+    {
+        bool holds = (op == op_le && bound.sign() >= 0) ||
+                     (op == op_ge && bound.sign() <= 0) ||
+                     (op == op_eq && bound.sign() == 0);
+        if(!holds)
+        {
+            _exact.assertConflict();
+            _fast.assertConflict();
+        }
+        return;
+    }
+
+    // Normalize the form so that its first coefficient is one.
+    Rational first = form.begin()->second;
+    if(first.sign() < 0)
+    {
+        if(op == op_le) op = op_ge;
+        else if(op == op_ge) op = op_le;
+    }
+    bound /= first;
+
+    if(form.size() == 1)
+    {
+        _assert(form.begin()->first, op, bound);
+        return;
+    }
+
+    std::vector< std::pair< unsigned int, Rational > > key;
+    for(const auto & t : form)
+        key.emplace_back(t.first, t.second / first);
+
+    auto it = _slacks.find(key);
+    unsigned int slack;
+    if(it != _slacks.end())
+        slack = it->second;
+    else
+    {
+        std::vector< std::pair< unsigned int, double > > approx;
+        for(const auto & t : key)
+            approx.emplace_back(t.first, t.second.toDouble());
+        slack = _exact.addRow(key);
+        _fast.addRow(approx);
+        _declarations.push_back(nullptr);
+        _integers.push_back(false);
+        _slacks.insert(std::make_pair(key, slack));
+    }
+    _assert(slack, op, bound);
+}
+
+void SimplexSolver::addContract(Contract * contract)
+{
+    auto addSpec = [this](std::map< semantic_domain, Specification * > & m) {
+        auto it = m.find(constraints);
+        if(it == m.end() || it->second == nullptr) return;
+        if(it->second->IsA() == constraint_node)
+            addConstraint(static_cast< Constraint * >(it->second));
+    };
+    addSpec(contract->assumptions);
+    addSpec(contract->guarantees);
+}
+
+void SimplexSolver::push()
+{
+    _exact.push();
+    _fast.push();
+}
+
+void SimplexSolver::pop()
+{
+    _exact.pop();
+    _fast.pop();
+}
+
+simplex_result SimplexSolver::_checkRelaxation()
+{
+    if(!_fastPath) return _exact.check();
+
+    size_t columns = _fast.getVariablesCount();
+    _fast.check(50 * (columns + 1));
+
+    // Start the exact check from the basis of the approximated solution.
+    std::vector< bool > basic(columns);
+    std::vector< int > atUpper(columns, 0);
+    for(unsigned int j = 0; j < columns; ++j)
+    {
+        basic[j] = _fast.isBasic(j);
+        if(basic[j]) continue;
+        double v = _fast.getValue(j);
+        const auto & l = _fast.getLower(j);
+        const auto & u = _fast.getUpper(j);
+        if(l.present && std::fabs(v - l.value) < 1e-9) atUpper[j] = -1;
+        else if(u.present && std::fabs(v - u.value) < 1e-9) atUpper[j] = 1;
+    }
+    _exact.setBasis(basic, atUpper);
+    return _exact.check();
+}
+
+simplex_result SimplexSolver::_patch()
+{
+    size_t columns = _exact.getVariablesCount();
+    std::vector< bool > allowed(columns);
+    for(size_t j = 0; j < columns; ++j)
+        allowed[j] = !_integers[j];
+
+    auto round = [this](unsigned int j) {
+        const Rational & v = _exact.getValue(j);
+        if(v.isInteger()) return;
+        const auto & l = _exact.getLower(j);
+        const auto & u = _exact.getUpper(j);
+        Rational down = v.floor();
+        Rational up = v.ceil();
+        if((!l.present || down >= l.value) && (!u.present || down <= u.value))
+            _exact.setValue(j, down);
+        else if((!l.present || up >= l.value) && (!u.present || up <= u.value))
+            _exact.setValue(j, up);
+    };
+    auto within = [this](unsigned int j) {
+        const Rational & v = _exact.getValue(j);
+        const auto & l = _exact.getLower(j);
+        const auto & u = _exact.getUpper(j);
+        return (!l.present || v >= l.value) && (!u.present || v <= u.value);
+    };
+
+    for(size_t attempt = 0; attempt < _declarations.size(); ++attempt)
+    {
+        for(unsigned int j = 0; j < columns; ++j)
+            if(!_exact.isBasic(j)) round(j);
+
+        // Integer basic variables with fractional values are moved out of
+        // the basis, exchanging them with non-integer variables.
+        bool fractional = false;
+        for(unsigned int j = 0; j < columns; ++j)
+        {
+            if(!_integers[j] || _exact.getValue(j).isInteger()) continue;
+            fractional = true;
+            if(within(j) && _exact.pivotOut(j, allowed)) round(j);
+        }
+
+        simplex_result r = _exact.check();
+        if(r != simplex_sat || !fractional) return r;
+    }
+    return simplex_sat;
+}
+
+simplex_result SimplexSolver::_branch(size_t & nodes)
+{
+    simplex_result r = _checkRelaxation();
+    if(r == simplex_sat) r = _patch();
+    if(r != simplex_sat) return r;
+
+    int var = -1;
+    for(size_t j = 0; j < _declarations.size(); ++j)
+    {
+        if(_integers[j] && !_exact.getValue(j).isInteger())
+        {
+            var = static_cast< int >(j);
+            break;
+        }
+    }
+
+    if(var < 0)
+    {
+        _model.clear();
+        for(size_t j = 0; j < _declarations.size(); ++j)
+            _model.push_back(_exact.getValue(j));
+        return simplex_sat;
+    }
+
+    if(++nodes > _branchLimit) return simplex_unknown;
+
+    Rational value = _exact.getValue(var);
+    auto col = static_cast< unsigned int >(var);
+
+    push();
+    _assert(col, op_le, value.floor());
+    simplex_result left = _branch(nodes);
+    pop();
+    if(left == simplex_sat) return simplex_sat;
+
+    push();
+    _assert(col, op_ge, value.ceil());
+    simplex_result right = _branch(nodes);
+    pop();
+    if(right == simplex_sat) return simplex_sat;
+
+    if(left == simplex_unknown || right == simplex_unknown)
+        return simplex_unknown;
+    return simplex_unsat;
+}
+
+simplex_result SimplexSolver::check()
+{
+    _model.clear();
+    size_t nodes = 0;
+    return _branch(nodes);
+}
+
+Rational SimplexSolver::getValue(DataDeclaration * declaration) const
+{
+    auto it = _variablesIndex.find(declaration);
+    if(it == _variablesIndex.end())
+        messageError("Simplex: unknown variable.", declaration);
+    if(it->second >= _model.size())
+        messageError("Simplex: no model available.", declaration);
+    return _model[it->second];
+}
+
+void SimplexSolver::setFastPath(bool enabled)
+{
+    _fastPath = enabled;
+}
+
+void SimplexSolver::setBranchLimit(size_t limit)
+{
+    _branchLimit = limit;
+}
+
+size_t SimplexSolver::getExactPivotsCount() const
+{
+    return _exact.getPivotsCount();
+}
+
+std::string SimplexSolver::getString() const
+{
+    std::string ret;
+    for(size_t j = 0; j < _declarations.size() && j < _model.size(); ++j)
+    {
+        if(_declarations[j] == nullptr) continue;
+        ret += _declarations[j]->getName()->getString() + " = " +
+               _model[j].getString() + "\n";
+    }
+    return ret;
+}
@@ -0,0 +1,157 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/ThreadPool.hh"
+#include "utilities/IOUtils.hh"
+
+#include <algorithm>
+
+using namespace chase;
+
+namespace {
+
+    /// @brief The pool owning the calling thread, if it is a worker.
+    thread_local const ThreadPool * currentPool = nullptr;
+    /// @brief The index of the calling worker.
+    thread_local unsigned int currentIndex = 0;
+
+}
+
+ThreadPool::ThreadPool(unsigned int threads) :
+    _queued(0),
+    _pending(0),
+    _steals(0),
+    _next(0),
+    _stopping(false)
+{
+    if(threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    for(unsigned int i = 0; i < threads; ++i)
+        _queues.emplace_back(new worker_queue());
+    for(unsigned int i = 0; i < threads; ++i)
+        _threads.emplace_back(&ThreadPool::_run, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    wait();
+    {
+        std::lock_guard< std::mutex > lock(_mutex);
+        _stopping = true;
+    }
+    _available.notify_all();
+    for(auto & thread : _threads)
+        thread.join();
+}
+
+void ThreadPool::submit(pool_task task)
+{
+    unsigned int index;
+    if(currentPool == this)
+        index = currentIndex;
+    else
+        index = _next++ % _queues.size();
+
+    ++_pending;
+    {
+        // Taking the lock avoids losing the wake up of a worker that is
+        // going to sleep. The counter is increased before the push, so that
+        // it never underflows.
+        std::lock_guard< std::mutex > lock(_mutex);
+        ++_queued;
+    }
+    {
+        std::lock_guard< std::mutex > lock(_queues[index]->mutex);
+        _queues[index]->tasks.push_back(std::move(task));
+    }
+    _available.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock< std::mutex > lock(_mutex);
+    _idle.wait(lock, [this] { return _pending == 0; });
+}
+
+unsigned int ThreadPool::getThreadsCount() const
+{
+    return static_cast< unsigned int >(_threads.size());
+}
+
+size_t ThreadPool::getStealsCount() const
+{
+    return _steals;
+}
+
+int ThreadPool::getWorkerIndex() const
+{
+    return currentPool == this ? static_cast< int >(currentIndex) : -1;
+}
+
+bool ThreadPool::_pop(unsigned int index, pool_task & task)
+{
+    {
+        std::lock_guard< std::mutex > lock(_queues[index]->mutex);
+        auto & own = _queues[index]->tasks;
+        if(!own.empty())
+        {
+            task = std::move(own.back());
+            own.pop_back();
+            --_queued;
+            return true;
+        }
+    }
+
+    const auto size = static_cast< unsigned int >(_queues.size());
+    for(unsigned int i = 1; i < size; ++i)
+    {
+        auto & victim = *_queues[(index + i) % size];
+        std::lock_guard< std::mutex > lock(victim.mutex);
+        if(victim.tasks.empty()) continue;
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        --_queued;
+        ++_steals;
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::_run(unsigned int index)
+{
+    currentPool = this;
+    currentIndex = index;
+
+    pool_task task;
+    while(true)
+    {
+        if(_pop(index, task))
+        {
+            try
+            {
+                task();
+            }
+            catch(std::exception & e)
+            {
+                // A failing task must not terminate the worker.
+                messageWarning(std::string("ThreadPool: task failed: ") +
+                               e.what());
+            }
+            task = nullptr;
+            if(--_pending == 0)
+            {
+                std::lock_guard< std::mutex > lock(_mutex);
+                _idle.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock< std::mutex > lock(_mutex);
+        _available.wait(lock, [this] { return _stopping || _queued > 0; });
+        if(_stopping && _queued == 0) return;
+    }
+}
@@ -5,41 +5,53 @@
  *
  */
 #include "../../include/utilities/UtilityFunctions.hh"
+#include "../../include/utilities/Combinations.hh"
 #include <random>
 
 using namespace chase;
 
+namespace {
+
 template <typename T>
-void chase::getSubsetBySize(std::vector<T> elements, unsigned int size,
-                            unsigned int left, unsigned int index,
-                            std::vector<T> &combination,
-                            std::list<std::vector<T>> &results) {
+void appendCombinations(const std::vector<T> &elements, unsigned int size,
+                        unsigned int left, unsigned int index,
+                        const std::vector<T> &combination,
+                        std::list<std::vector<T>> &results) {
+  // A completed combination is emitted even past the end of the range.
   if (left == 0) {
     results.push_back(combination);
     return;
   }
-  for (unsigned int i = index; i < size; ++i) {
-    combination.push_back(elements[i]);
-    getSubsetBySize(elements, size, left - 1, i + 1, combination, results);
-    combination.pop_back();
+  if (index > size)
+    return;
+  std::vector<T> current(combination);
+  size_t prefix = combination.size();
+  current.resize(prefix + left);
+  for (CombinationIterator it(size - index, left); !it.isDone(); it.next()) {
+    const std::vector<unsigned int> &indexes = it.getIndexes();
+    for (unsigned int i = 0; i < left; ++i)
+      current[prefix + i] = elements[index + indexes[i]];
+    results.push_back(current);
   }
 }
 
+} // namespace
+
+template <typename T>
+void chase::getSubsetBySize(const std::vector<T> &elements, unsigned int size,
+                            unsigned int left, unsigned int index,
+                            std::vector<T> &combination,
+                            std::list<std::vector<T>> &results) {
+  appendCombinations(elements, size, left, index, combination, results);
+}
+
 template <>
-void chase::getSubsetBySize(std::vector<std::string> elements,
+void chase::getSubsetBySize(const std::vector<std::string> &elements,
                             unsigned int size, unsigned int left,
                             unsigned int index,
                             std::vector<std::string> &combination,
                             std::list<std::vector<std::string>> &results) {
-  if (left == 0) {
-    results.push_back(combination);
-    return;
-  }
-  for (unsigned int i = index; i < size; ++i) {
-    combination.push_back(elements[i]);
-    getSubsetBySize(elements, size, left - 1, i + 1, combination, results);
-    combination.pop_back();
-  }
+  appendCombinations(elements, size, left, index, combination, results);
 }
 
 std::string chase::getRandomStr(int len, std::string prefix,
@@ -48,8 +60,9 @@ std::string chase::getRandomStr(int len, std::string prefix,
                                  "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
                                  "abcdefghijklmnopqrstuvwxyz";
 
-  std::random_device rd;
-  std::mt19937 gen(rd());
+  // The engine is seeded once per thread: seeding it on every call was
+  // the main cost of creating unnamed objects.
+  thread_local std::mt19937 gen{std::random_device{}()};
   std::uniform_int_distribution<> dis(0, sizeof(alphanum) - 2);
 
   std::string ret(std::move(prefix));
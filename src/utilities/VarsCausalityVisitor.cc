@@ -30,6 +30,19 @@ int VarsCausalityVisitor::visitContract(Contract & contract) {
     for(auto & declaration : contract.declarations)
         rv |= declaration->accept_visitor(*this);
 
+    if(contract.hasOccurrenceIndex())
+    {
+        // The usage of the variables is read from the index, without
+        // traversing the formulas.
+        const occurrence_index & index = contract.getOccurrenceIndex();
+        for(auto & entry : index.assumptions)
+            _markUsage(entry.first, entry.second.size(), true);
+        for(auto & entry : index.guarantees)
+            _markUsage(entry.first, entry.second.size(), false);
+        _fixVarsCausality();
+        return rv;
+    }
+
     _inAssumptions = true;
     for(auto & assumption : contract.assumptions)
         rv |= assumption.second->accept_visitor(*this);
@@ -54,24 +67,29 @@ void VarsCausalityVisitor::setContract(Contract *contract) {
 }
 
 int VarsCausalityVisitor::visitIdentifier(Identifier &identifier) {
-    auto d = identifier.getDeclaration();
-    if(d->IsA() == variable_node)
+    if(_inAssumptions || _inGuarantees)
+        _markUsage(identifier.getDeclaration(), 1, _inAssumptions);
+    return GuideVisitor::visitIdentifier(identifier);
+}
+
+void VarsCausalityVisitor::_markUsage(
+        DataDeclaration * d, size_t occurrences, bool inAssumptions) {
+    if(d == nullptr || d->IsA() != variable_node || occurrences == 0)
+        return;
+    auto v = reinterpret_cast< Variable * >(d);
+    if(inAssumptions)
     {
-        auto v = reinterpret_cast< Variable * >(d);
-        if(v->getCausality() == output && _inAssumptions)
-            messageWarning("System variable in assumptions: " + v->getName()->getString());
-        if(_inAssumptions)
-        {
-            auto p = used_in_assumptions.find(v);
-            if(p != used_in_assumptions.end()) p->second = true;
-        }
-        if(_inGuarantees)
-        {
-            auto p = used_in_guarantees.find(v);
-            if(p != used_in_guarantees.end()) p->second = true;
-        }
+        if(v->getCausality() == output)
+            for(size_t i = 0; i < occurrences; ++i)
+                messageWarning("System variable in assumptions: " + v->getName()->getString());
+        auto p = used_in_assumptions.find(v);
+        if(p != used_in_assumptions.end()) p->second = true;
+    }
+    else
+    {
+        auto p = used_in_guarantees.find(v);
+        if(p != used_in_guarantees.end()) p->second = true;
     }
-    return GuideVisitor::visitIdentifier(identifier);
 }
 
 void VarsCausalityVisitor::_fixVarsCausality() {
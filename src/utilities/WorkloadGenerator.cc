@@ -0,0 +1,322 @@
+/**
+ * @author      <a href="mailto:michele.lora@univr.it">Michele Lora</a>
+ * @date        10/19/2026
+ *              This project is released under the 3-Clause BSD License.
+ *
+ */
+
+#include "utilities/WorkloadGenerator.hh"
+#include "utilities/Factory.hh"
+#include "utilities/IOUtils.hh"
+
+#include <algorithm>
+
+using namespace chase;
+
+namespace {
+
+    /// @brief Step of the splitmix64 generator, used to seed the engine.
+    uint64_t splitmix(uint64_t & x)
+    {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t rotl(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    const char alphanum[] = "0123456789"
+                            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                            "abcdefghijklmnopqrstuvwxyz";
+
+}
+
+workload_options::workload_options(
+        unsigned int _contracts, unsigned int _variables,
+        unsigned int _depth, unsigned int _width) :
+    contracts(_contracts),
+    variables(_variables),
+    pool(0),
+    depth(_depth),
+    width(_width),
+    temporal(0.5),
+    always(1),
+    eventually(1),
+    next(1),
+    until(1),
+    outputs(0.5)
+{
+}
+
+WorkloadGenerator::WorkloadGenerator(uint64_t seed) :
+    _state()
+{
+    setSeed(seed);
+}
+
+WorkloadGenerator::~WorkloadGenerator() = default;
+
+void WorkloadGenerator::setSeed(uint64_t seed)
+{
+    for(auto & s : _state)
+        s = splitmix(seed);
+}
+
+uint64_t WorkloadGenerator::next()
+{
+    // xoshiro256** (Blackman and Vigna).
+    const uint64_t result = rotl(_state[1] * 5, 7) * 9;
+    const uint64_t t = _state[1] << 17;
+    _state[2] ^= _state[0];
+    _state[3] ^= _state[1];
+    _state[1] ^= _state[2];
+    _state[0] ^= _state[3];
+    _state[2] ^= t;
+    _state[3] = rotl(_state[3], 45);
+    return result;
+}
+
+uint64_t WorkloadGenerator::uniform(uint64_t bound)
+{
+    if(bound == 0)
+        messageError("WorkloadGenerator: empty range.");
+
+    // Multiply and shift, rejecting the values that would bias the result
+    // (Lemire, 2019).
+    __extension__ typedef unsigned __int128 wide;
+    wide m = static_cast< wide >(next()) * bound;
+    auto low = static_cast< uint64_t >(m);
+    if(low < bound)
+    {
+        uint64_t threshold = -bound % bound;
+        while(low < threshold)
+        {
+            m = static_cast< wide >(next()) * bound;
+            low = static_cast< uint64_t >(m);
+        }
+    }
+    return static_cast< uint64_t >(m >> 64);
+}
+
+double WorkloadGenerator::uniformReal()
+{
+    return static_cast< double >(next() >> 11) * 0x1.0p-53;
+}
+
+std::string WorkloadGenerator::generateString(unsigned int len,
+                                              const std::string & prefix,
+                                              const std::string & suffix)
+{
+    std::string ret(prefix);
+    for(unsigned int i = 0; i < len; ++i)
+        ret += alphanum[uniform(sizeof(alphanum) - 1)];
+    ret += suffix;
+    return ret;
+}
+
+LogicFormula * WorkloadGenerator::generateFormula(
+        const std::vector< Variable * > & variables,
+        unsigned int depth, unsigned int width,
+        const workload_options & options)
+{
+    if(variables.empty())
+        messageError("WorkloadGenerator: no variables for the formula.");
+    if(width <= 1)
+        return _formula(variables, depth, options);
+
+    std::vector< LogicFormula * > conjuncts;
+    conjuncts.reserve(width);
+    for(unsigned int i = 0; i < width; ++i)
+        conjuncts.push_back(_formula(variables, depth, options));
+    return LargeAnd(conjuncts);
+}
+
+LogicFormula * WorkloadGenerator::_formula(
+        const std::vector< Variable * > & variables,
+        unsigned int depth, const workload_options & options)
+{
+    if(depth == 0)
+        return Prop(variables[uniform(variables.size())]);
+
+    if(uniformReal() < options.temporal)
+    {
+        double total = options.always + options.eventually +
+                       options.next + options.until;
+        double x = uniformReal() * total;
+        if((x -= options.always) < 0)
+            return Always(_formula(variables, depth - 1, options));
+        if((x -= options.eventually) < 0)
+            return Eventually(_formula(variables, depth - 1, options));
+        if((x -= options.next) < 0)
+            return Next(_formula(variables, depth - 1, options));
+        LogicFormula * left = _formula(variables, depth - 1, options);
+        return Until(left, _formula(variables, depth - 1, options));
+    }
+
+    switch(uniform(3))
+    {
+        case 0:
+        {
+            LogicFormula * left = _formula(variables, depth - 1, options);
+            return And(left, _formula(variables, depth - 1, options));
+        }
+        case 1:
+        {
+            LogicFormula * left = _formula(variables, depth - 1, options);
+            return Or(left, _formula(variables, depth - 1, options));
+        }
+        default:
+            return Not(_formula(variables, depth - 1, options));
+    }
+}
+
+Contract * WorkloadGenerator::generateContract(
+        const std::string & name, const workload_options & options)
+{
+    unsigned int pool = options.pool != 0 ? options.pool : options.variables;
+    unsigned int count = std::min(options.variables, pool);
+
+    // Partial Fisher-Yates shuffle of the names in the pool.
+    std::vector< unsigned int > indexes(pool);
+    for(unsigned int i = 0; i < pool; ++i)
+        indexes[i] = i;
+    for(unsigned int i = 0; i < count; ++i)
+        std::swap(indexes[i], indexes[i + uniform(pool - i)]);
+
+    auto contract = new Contract(name);
+    std::vector< Variable * > variables;
+    for(unsigned int i = 0; i < count; ++i)
+    {
+        causality_t causality =
+                uniformReal() < options.outputs ? output : input;
+        auto v = new Variable(new Boolean(),
+                              new Name("v" + std::to_string(indexes[i])),
+                              causality);
+        contract->addDeclaration(v);
+        variables.push_back(v);
+    }
+    if(variables.empty()) return contract;
+
+    contract->addAssumptions(logic, generateFormula(
+            variables, options.depth, options.width, options));
+    contract->addGuarantees(logic, generateFormula(
+            variables, options.depth, options.width, options));
+    return contract;
+}
+
+System * WorkloadGenerator::generateSystem(const workload_options & options)
+{
+    unsigned int pool = options.pool != 0 ? options.pool : options.variables;
+    auto system = new System();
+    for(unsigned int i = 0; i < pool; ++i)
+        system->addDeclaration(new Variable(
+                new Boolean(), new Name("v" + std::to_string(i))));
+    for(unsigned int i = 0; i < options.contracts; ++i)
+        system->addContract(
+                generateContract("c" + std::to_string(i), options));
+    return system;
+}
+
+void WorkloadGenerator::generatePowerLawEdges(unsigned int size,
+                                              unsigned int edgesPerVertex,
+                                              edge_list & edges)
+{
+    edges.clear();
+    if(size < 2 || edgesPerVertex == 0) return;
+    edges.reserve(static_cast< size_t >(size) * edgesPerVertex);
+
+    // Every edge appends both its endpoints, so that drawing a uniform
+    // entry draws a vertex with probability proportional to its degree.
+    std::vector< unsigned int > endpoints;
+    endpoints.reserve(2 * static_cast< size_t >(size) * edgesPerVertex);
+    std::vector< unsigned int > chosen;
+
+    for(unsigned int v = 1; v < size; ++v)
+    {
+        unsigned int m = std::min(edgesPerVertex, v);
+        chosen.clear();
+        for(unsigned int j = 0; j < m; ++j)
+        {
+            unsigned int target = 0;
+            // Few attempts to avoid multiple edges, then give up.
+            for(unsigned int attempt = 0; attempt < 8; ++attempt)
+            {
+                target = endpoints.empty() ?
+                        static_cast< unsigned int >(uniform(v)) :
+                        endpoints[uniform(endpoints.size())];
+                if(std::find(chosen.begin(), chosen.end(), target) ==
+                   chosen.end())
+                    break;
+            }
+            if(std::find(chosen.begin(), chosen.end(), target) !=
+               chosen.end())
+                continue;
+            chosen.push_back(target);
+            edges.emplace_back(v, target);
+        }
+        for(auto target : chosen)
+        {
+            endpoints.push_back(v);
+            endpoints.push_back(target);
+        }
+    }
+}
+
+void WorkloadGenerator::generateGridEdges(unsigned int rows,
+                                          unsigned int columns,
+                                          edge_list & edges)
+{
+    edges.clear();
+    edges.reserve(2 * static_cast< size_t >(rows) * columns);
+    for(unsigned int r = 0; r < rows; ++r)
+        for(unsigned int c = 0; c < columns; ++c)
+        {
+            unsigned int v = r * columns + c;
+            if(c + 1 < columns) edges.emplace_back(v, v + 1);
+            if(r + 1 < rows) edges.emplace_back(v, v + columns);
+        }
+}
+
+Graph * WorkloadGenerator::generatePowerLawGraph(unsigned int size,
+                                                 unsigned int edgesPerVertex,
+                                                 bool directed, bool named)
+{
+    edge_list edges;
+    generatePowerLawEdges(size, edgesPerVertex, edges);
+    return buildGraph(size, edges, directed, named);
+}
+
+Graph * WorkloadGenerator::generateGridGraph(unsigned int rows,
+                                             unsigned int columns,
+                                             bool directed, bool named)
+{
+    edge_list edges;
+    generateGridEdges(rows, columns, edges);
+    return buildGraph(rows * columns, edges, directed, named);
+}
+
+Graph * WorkloadGenerator::buildGraph(unsigned int size,
+                                      const edge_list & edges,
+                                      bool directed, bool named)
+{
+    std::vector< unsigned int > sources(edges.size());
+    std::vector< unsigned int > targets(edges.size());
+    for(size_t e = 0; e < edges.size(); ++e)
+    {
+        sources[e] = edges[e].first;
+        targets[e] = edges[e].second;
+    }
+    auto graph = new Graph(size, std::move(sources), std::move(targets),
+                           std::vector< double >(), directed);
+    if(named)
+    {
+        for(unsigned int i = 0; i < size; ++i)
+            graph->associateVertex(
+                    i, new Vertex(new Name("n" + std::to_string(i))));
+    }
+    return graph;
+}
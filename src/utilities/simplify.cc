@@ -8,6 +8,7 @@
 #include "utilities/simplify.hh"
 #include "utilities/LogicNotNormalizationVisitor.hh"
 #include "utilities/GroupTemporalOperatorsVisitor.hh"
+#include "utilities/Profiler.hh"
 
 using namespace chase;
 
@@ -21,14 +22,20 @@ void chase::simplify(
         chase::ChaseObject * object,
         simplify_options * options)
 {
-    LogicSimplificationVisitor lsv;
-    object->accept_visitor(lsv);
+    CHASE_PROFILE_SCOPE("simplify");
+    {
+        CHASE_PROFILE_SCOPE("LogicSimplificationVisitor");
+        LogicSimplificationVisitor lsv;
+        object->accept_visitor(lsv);
+    }
 
     if(options->nots) {
+        CHASE_PROFILE_SCOPE("LogicNotNormalizationVisitor");
         LogicNotNormalizationVisitor v;
         object->accept_visitor(v);
     }
     if(options->temporal_operators){
+        CHASE_PROFILE_SCOPE("GroupTemporalOperatorsVisitor");
         GroupTemporalOperatorsVisitor v;
         object->accept_visitor(v);
     }
@@ -0,0 +1,79 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace chase;
+
+namespace {
+
+// Contract over a and b, with assumptions G(a) and guarantees a & b.
+Contract *makeContract() {
+  auto c = new Contract("c");
+  auto a = new Variable(new Boolean(), new Name("a"));
+  auto b = new Variable(new Boolean(), new Name("b"));
+  c->addDeclaration(a);
+  c->addDeclaration(b);
+  c->addAssumptions(logic, Always(Prop(a)));
+  c->addGuarantees(logic, And(Prop(a), Prop(b)));
+  return c;
+}
+
+} // namespace
+
+TEST(AstStatisticsTest, Contract) {
+  Contract *c = makeContract();
+  ast_statistics s = computeStatistics(c);
+
+  EXPECT_EQ(s.total, 22u);
+  EXPECT_EQ(s.nodes[contract_node], 1u);
+  EXPECT_EQ(s.nodes[name_node], 6u);
+  EXPECT_EQ(s.nodes[variable_node], 2u);
+  EXPECT_EQ(s.nodes[boolean_node], 5u);
+  EXPECT_EQ(s.nodes[proposition_node], 3u);
+  EXPECT_EQ(s.nodes[identifier_node], 3u);
+  EXPECT_EQ(s.leaves, 11u);
+  EXPECT_EQ(s.max_depth, 3u);
+  // The variables are also reached from the identifiers.
+  EXPECT_EQ(s.shared, 2u);
+  // The two propositions over a are the same subtree, and the names of the
+  // propositions equal the names of the variables.
+  EXPECT_EQ(s.unique_subtrees, 13u);
+  EXPECT_EQ(s.names, 3u);
+  EXPECT_GE(s.bytes, sizeof(Contract) + 6 * sizeof(Name));
+
+  std::string json = getStatisticsJSON(s);
+  EXPECT_NE(json.find("\"total\": 22"), std::string::npos);
+  EXPECT_NE(json.find("\"proposition\": 3"), std::string::npos);
+  delete c;
+}
+
+TEST(AstStatisticsTest, System) {
+  auto system = new System("s");
+  system->addContract(makeContract());
+  system->addContract(makeContract());
+  ast_statistics s = computeStatistics(system);
+
+  EXPECT_EQ(s.nodes[system_node], 1u);
+  EXPECT_EQ(s.total, 1u + 1u + 2 * 22u);
+  // The two contracts are identical.
+  EXPECT_EQ(s.unique_subtrees, 13u + 2u);
+  EXPECT_EQ(s.names, 4u);
+  EXPECT_EQ(getNodeTypeName(system_node), "system");
+}
+
+TEST(AstStatisticsTest, DeepFormula) {
+  // Deep enough to overflow a recursive traversal. The formula is not
+  // deleted, since its destructors are recursive.
+  const unsigned int depth = 200000;
+  auto a = new Variable(new Boolean(), new Name("a"));
+  LogicFormula *f = Prop(a);
+  for (unsigned int i = 0; i < depth; ++i)
+    f = Not(f);
+  ast_statistics s = computeStatistics(f);
+
+  EXPECT_EQ(s.max_depth, depth + 3);
+  EXPECT_EQ(s.nodes[unaryBooleanOperation_node], depth);
+  // Only the name and the type of the variable repeat.
+  EXPECT_EQ(s.unique_subtrees, s.total - 2);
+}
@@ -0,0 +1,92 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace chase;
+
+TEST(CombinationsTest, Enumeration) {
+  std::vector<std::vector<unsigned int>> seen;
+  for (CombinationIterator it(5, 3); !it.isDone(); it.next()) {
+    EXPECT_EQ(it.getRank(), seen.size());
+    seen.push_back(it.getIndexes());
+  }
+  ASSERT_EQ(seen.size(), CombinationIterator::binomial(5, 3));
+  EXPECT_EQ(seen.front(), (std::vector<unsigned int>{0, 1, 2}));
+  EXPECT_EQ(seen.back(), (std::vector<unsigned int>{2, 3, 4}));
+
+  // Degenerate sizes.
+  CombinationIterator empty(3, 0);
+  EXPECT_FALSE(empty.isDone());
+  EXPECT_FALSE(empty.next());
+  EXPECT_TRUE(CombinationIterator(2, 3).isDone());
+}
+
+TEST(CombinationsTest, RankRanges) {
+  const unsigned int n = 12, k = 4;
+  uint64_t total = CombinationIterator::binomial(n, k);
+  EXPECT_EQ(total, 495u);
+
+  std::vector<unsigned int> indexes(k);
+  CombinationIterator::unrank(n, 200, indexes);
+  EXPECT_EQ(CombinationIterator::rank(n, indexes), 200u);
+
+  // Splitting the ranks in chunks visits every combination once.
+  uint64_t count = 0;
+  for (uint64_t begin = 0; begin < total; begin += 100) {
+    for (CombinationIterator it(n, k, begin, begin + 100); !it.isDone();
+         it.next()) {
+      EXPECT_EQ(it.getRank(), begin + (count % 100));
+      ++count;
+    }
+  }
+  EXPECT_EQ(count, total);
+}
+
+TEST(CombinationsTest, Pruning) {
+  // Combinations of 3 out of 6 not containing both 0 and 1.
+  size_t calls = 0;
+  auto filter = [&calls](const unsigned int *indexes, unsigned int size) {
+    ++calls;
+    return !(size >= 2 && indexes[0] == 0 && indexes[1] == 1);
+  };
+  size_t count = 0;
+  for (CombinationIterator it(6, 3, filter); !it.isDone(); it.next())
+    ++count;
+  EXPECT_EQ(count, CombinationIterator::binomial(6, 3) - 4);
+  EXPECT_GT(calls, 0u);
+}
+
+TEST(CombinationsTest, Masks) {
+  uint64_t mask = 0x7;
+  size_t count = 0;
+  for (; mask < (1u << 6); mask = CombinationIterator::nextMask(mask))
+    ++count;
+  EXPECT_EQ(count, 20u);
+}
+
+TEST(CombinationsTest, SubsetBySize) {
+  std::vector<std::string> elements{"a", "b", "c", "d"};
+  std::vector<std::string> combination;
+  std::list<std::vector<std::string>> results;
+  getSubsetBySize(elements, 4, 2, 0, combination, results);
+  ASSERT_EQ(results.size(), 6u);
+  EXPECT_EQ(results.front(), (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(results.back(), (std::vector<std::string>{"c", "d"}));
+}
+
+TEST(CombinationsTest, SubsetBySizeCompleted) {
+  // A full-length combination reaching the end of the range.
+  std::vector<std::string> elements{"a", "b", "c"};
+  std::vector<std::string> combination{"a", "b", "c"};
+  std::list<std::vector<std::string>> results;
+  getSubsetBySize(elements, 3, 0, 4, combination, results);
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results.front(), combination);
+
+  results.clear();
+  getSubsetBySize(elements, 3, 1, 4, combination, results);
+  EXPECT_TRUE(results.empty());
+}
@@ -0,0 +1,253 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chase;
+
+namespace {
+
+// Contract over the Boolean variables a and b.
+Contract *makeContract(const std::string &name, int shape) {
+  auto a = new Variable(new Boolean(), new Name("a"));
+  auto b = new Variable(new Boolean(), new Name("b"), output);
+  auto c = new Contract(name);
+  c->addDeclaration(a);
+  c->addDeclaration(b);
+  switch (shape % 3) {
+  case 0:
+    c->addAssumptions(logic, Always(Prop(a)));
+    c->addGuarantees(logic, Eventually(Prop(b)));
+    break;
+  case 1:
+    c->addAssumptions(logic, Eventually(Prop(a)));
+    c->addGuarantees(logic, Always(Implies(Prop(a), Next(Prop(b)))));
+    break;
+  default:
+    c->addGuarantees(logic, Until(Prop(a), Prop(b)));
+    break;
+  }
+  return c;
+}
+
+// Collects the declarations referenced by the identifiers of a tree.
+class ReferencesVisitor : public GuideVisitor {
+public:
+  ReferencesVisitor() : GuideVisitor(1) {}
+  int visitIdentifier(Identifier &o) override {
+    references.push_back(o.getDeclaration());
+    return 1;
+  }
+  std::vector<DataDeclaration *> references;
+};
+
+// True if all the identifiers of the contract refer to its declarations.
+bool referencesOwnDeclarations(Contract *c) {
+  ReferencesVisitor v;
+  c->accept_visitor(v);
+  for (auto d : v.references)
+    if (std::find(c->declarations.begin(), c->declarations.end(), d) ==
+        c->declarations.end())
+      return false;
+  return !v.references.empty();
+}
+
+} // namespace
+
+TEST(ContractAlgebraTest, InputsUntouched) {
+  auto c1 = makeContract("c1", 0);
+  auto c2 = makeContract("c2", 1);
+  std::string s1 = c1->getString(), s2 = c2->getString();
+  auto g1 = c1->guarantees[logic];
+
+  names_projection_map correspondences{{"a", "a"}, {"b", "b"}};
+  Contract::composition(c1, c2, correspondences);
+  Contract::conjunction(c1, c2, correspondences);
+  Contract::quotient(c1, c2, correspondences);
+  Contract::refinementCheck(c1, c2, correspondences);
+
+  EXPECT_EQ(c1->getString(), s1);
+  EXPECT_EQ(c2->getString(), s2);
+  EXPECT_EQ(g1->getParent(), c1);
+
+  // Checking twice on the same inputs gives the same answer.
+  EXPECT_TRUE(checkRefinementLTL(c1, c1, correspondences));
+  EXPECT_TRUE(checkRefinementLTL(c1, c1, correspondences));
+}
+
+TEST(ContractAlgebraTest, ConcurrentOperations) {
+  // Many threads run the algebra on the same shared inputs.
+  std::vector<Contract *> contracts;
+  std::vector<std::string> strings;
+  for (int i = 0; i < 6; ++i) {
+    contracts.push_back(makeContract("c" + std::to_string(i), i));
+    strings.push_back(contracts.back()->getString());
+  }
+
+  const int threads = 8, operations = 400;
+  std::atomic<int> done(0), refinements(0);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      names_projection_map correspondences{{"a", "a"}, {"b", "b"}};
+      for (int i = 0; i < operations; ++i) {
+        Contract *c1 = contracts[(t + i) % contracts.size()];
+        Contract *c2 = contracts[(t * 7 + i * 3) % contracts.size()];
+        Contract *r = nullptr;
+        switch (i % 4) {
+        case 0:
+          r = Contract::composition(c1, c2, correspondences);
+          break;
+        case 1:
+          r = Contract::conjunction(c1, c2, correspondences);
+          break;
+        case 2:
+          r = Contract::quotient(c1, c2, correspondences);
+          break;
+        default:
+          r = Contract::refinementCheck(c1, c2, correspondences);
+          break;
+        }
+        if (r != nullptr && r->declarations.size() == 2)
+          ++done;
+        if (i % 50 == 0 && checkRefinementLTL(c1, c1, correspondences))
+          ++refinements;
+      }
+    });
+  }
+  for (auto &worker : workers)
+    worker.join();
+
+  EXPECT_EQ(done, threads * operations);
+  EXPECT_EQ(refinements, threads * (operations / 50));
+  for (size_t i = 0; i < contracts.size(); ++i) {
+    EXPECT_EQ(contracts[i]->getString(), strings[i]);
+    EXPECT_EQ(contracts[i]->guarantees[logic]->getParent(), contracts[i]);
+  }
+}
+
+TEST(ContractAlgebraTest, FlatPointerMap) {
+  std::vector<int> keys(1000), values(1000);
+  FlatPointerMap<int, int> map;
+  for (size_t i = 0; i < keys.size(); ++i)
+    map.insert(&keys[i], &values[i]);
+  map.insert(&keys[3], &values[4]);
+  EXPECT_EQ(map.size(), keys.size());
+  EXPECT_EQ(map.find(&keys[3]), &values[4]);
+  EXPECT_EQ(map.find(&keys[999]), &values[999]);
+  int missing = 0;
+  EXPECT_EQ(map.find(&missing), nullptr);
+  EXPECT_FALSE(map.contains(nullptr));
+  map.clear();
+  EXPECT_EQ(map.size(), 0u);
+  EXPECT_EQ(map.find(&keys[3]), nullptr);
+}
+
+TEST(ContractAlgebraTest, IdentifierRecorder) {
+  auto a = new Variable(new Boolean(), new Name("a"));
+  auto outer = new IdentifierRecorder();
+  auto i1 = new Identifier(a);
+  Identifier *i2 = nullptr;
+  {
+    IdentifierRecorder inner;
+    i2 = new Identifier(a, true);
+    delete new Identifier(a);
+    EXPECT_EQ(inner.getIdentifiers(), std::vector<Identifier *>{i2});
+  }
+  EXPECT_EQ(outer->getIdentifiers(), (std::vector<Identifier *>{i1, i2}));
+  delete i1;
+  EXPECT_EQ(outer->getIdentifiers(), std::vector<Identifier *>{i2});
+  delete outer;
+
+  auto copy = i2->clone();
+  EXPECT_TRUE(copy->isPrimed());
+  delete copy;
+  delete i2;
+  delete a;
+}
+
+TEST(ContractAlgebraTest, ClonedDeclarations) {
+  auto c1 = makeContract("c1", 0);
+  auto c2 = makeContract("c2", 1);
+  names_projection_map correspondences{{"a", "a"}, {"b", "b"}};
+
+  std::vector<Contract *> results{
+      c1->clone(), Contract::composition(c1, c2, correspondences),
+      Contract::conjunction(c1, c2, correspondences),
+      Contract::quotient(c1, c2, correspondences),
+      Contract::refinementCheck(c1, c2, correspondences)};
+  for (auto r : results) {
+    EXPECT_TRUE(referencesOwnDeclarations(r)) << r->getString();
+    delete r;
+  }
+  EXPECT_TRUE(referencesOwnDeclarations(c1));
+  EXPECT_TRUE(referencesOwnDeclarations(c2));
+}
+
+TEST(ContractAlgebraTest, OccurrenceIndex) {
+  auto c1 = makeContract("c1", 1);
+  auto c2 = makeContract("c2", 0);
+  auto a = dynamic_cast<DataDeclaration *>(c1->declarations.front());
+  auto b = dynamic_cast<DataDeclaration *>(c1->declarations.back());
+  EXPECT_FALSE(c1->hasOccurrenceIndex());
+  EXPECT_THROW(c1->getOccurrences(a, true), ChaseError);
+
+  c1->enableOccurrenceIndex();
+  EXPECT_EQ(c1->getOccurrences(a, true).size(), 1u);
+  EXPECT_EQ(c1->getOccurrences(a, false).size(), 1u);
+  EXPECT_EQ(c1->getOccurrences(b, true).size(), 0u);
+  EXPECT_EQ(c1->getOccurrences(b, false).size(), 1u);
+
+  // The index is inherited and follows the remapped declarations.
+  names_projection_map correspondences{{"a", "a"}, {"b", "b"}};
+  auto clone = c1->clone();
+  auto composed = Contract::composition(c1, c2, correspondences);
+  for (auto r : {clone, composed}) {
+    ASSERT_TRUE(r->hasOccurrenceIndex());
+    EXPECT_TRUE(referencesOwnDeclarations(r));
+    auto ra = dynamic_cast<DataDeclaration *>(r->declarations.front());
+    EXPECT_EQ(r->getOccurrences(a, true).size(), 0u);
+    EXPECT_EQ(r->getOccurrences(ra, true).size(), r == clone ? 1u : 3u);
+  }
+
+  // Saturation adds the negated assumptions to the guarantees.
+  Contract::saturate(c1);
+  EXPECT_EQ(c1->getOccurrences(a, false).size(), 2u);
+  EXPECT_EQ(c1->guarantees[logic]->getParent(), c1);
+
+  // Renaming through the index or through the visitor.
+  c1->renameOccurrences(a, b);
+  EXPECT_EQ(c1->getOccurrences(a, true).size(), 0u);
+  EXPECT_EQ(c1->getOccurrences(b, true).size(), 1u);
+  EXPECT_EQ(c1->getOccurrences(b, false).size(), 3u);
+  std::map<Declaration *, Declaration *> map{{b, a}};
+  ClonedDeclarationVisitor v(map);
+  c1->accept_visitor(v);
+  EXPECT_EQ(c1->getOccurrences(a, false).size(), 3u);
+  EXPECT_EQ(c1->getOccurrences(b, false).size(), 0u);
+  EXPECT_TRUE(referencesOwnDeclarations(c1));
+
+  // The causality inferred from the index matches the traversal.
+  auto c3 = new Contract("c3");
+  auto x = new Variable(new Boolean(), new Name("x"), generic);
+  auto y = new Variable(new Boolean(), new Name("y"), generic);
+  c3->addDeclaration(x);
+  c3->addDeclaration(y);
+  c3->addAssumptions(logic, Always(Prop(x)));
+  c3->addGuarantees(logic, Eventually(And(Prop(x), Prop(y))));
+  auto c4 = c3->clone();
+  c4->enableOccurrenceIndex();
+  VarsCausalityVisitor v3(c3), v4(c4);
+  c3->accept_visitor(v3);
+  c4->accept_visitor(v4);
+  EXPECT_EQ(x->getCausality(), input);
+  EXPECT_EQ(y->getCausality(), output);
+  auto x4 = dynamic_cast<Variable *>(c4->declarations.front());
+  auto y4 = dynamic_cast<Variable *>(c4->declarations.back());
+  EXPECT_EQ(x4->getCausality(), input);
+  EXPECT_EQ(y4->getCausality(), output);
+}
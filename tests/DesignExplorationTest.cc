@@ -0,0 +1,163 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace chase;
+
+namespace {
+
+// Component with a single view guaranteeing a formula over a Boolean
+// variable.
+ComponentDefinition *
+makeComponent(const std::string &name, const std::string &var,
+              const std::function<LogicFormula *(Proposition *)> &g) {
+  auto v = new Variable(new Boolean(), new Name(var));
+  auto c = new Contract(name);
+  c->addDeclaration(v);
+  c->addGuarantees(logic, g(Prop(v)));
+  auto component = new ComponentDefinition(name);
+  component->views.insert(std::make_pair(std::string("behavior"), c));
+  return component;
+}
+
+// Problem with two libraries: one of components driving "a", one driving
+// "b". The requirement asks both a and b to be eventually true.
+DesignProblem *makeProblem(Library *&la, Library *&lb) {
+  la = new Library("la");
+  la->declarations.push_back(
+      makeComponent("p1", "a", [](Proposition *a) { return Always(a); }));
+  la->declarations.push_back(makeComponent(
+      "p2", "a", [](Proposition *a) { return Always(Not(a)); }));
+  la->declarations.push_back(
+      makeComponent("p3", "a", [](Proposition *a) { return Eventually(a); }));
+
+  lb = new Library("lb");
+  lb->declarations.push_back(
+      makeComponent("q1", "b", [](Proposition *b) { return Always(b); }));
+  lb->declarations.push_back(makeComponent(
+      "q2", "b", [](Proposition *b) { return Always(Not(b)); }));
+
+  auto a = new Variable(new Boolean(), new Name("a"));
+  auto b = new Variable(new Boolean(), new Name("b"));
+  auto requirement = new Contract("requirement");
+  requirement->addDeclaration(a);
+  requirement->addDeclaration(b);
+  requirement->addGuarantees(
+      logic, And(Eventually(Prop(a)), Eventually(Prop(b))));
+
+  auto problem = new DesignProblem();
+  problem->libraries.insert(la);
+  problem->libraries.insert(lb);
+  problem->requirements.insert(requirement);
+  return problem;
+}
+
+std::set<std::string> names(const exploration_result &result) {
+  std::set<std::string> ret;
+  for (auto c : result.components)
+    ret.insert(c->getName()->getString());
+  return ret;
+}
+
+} // namespace
+
+TEST(DesignExplorationTest, ThreadPool) {
+  ThreadPool pool(4);
+  std::atomic<int> count(0);
+  std::function<void(int)> spawn = [&](int depth) {
+    ++count;
+    if (depth == 0)
+      return;
+    pool.submit([&, depth] { spawn(depth - 1); });
+    pool.submit([&, depth] { spawn(depth - 1); });
+  };
+  pool.submit([&] { spawn(10); });
+  pool.wait();
+  EXPECT_EQ(count, (1 << 11) - 1);
+  EXPECT_EQ(pool.getThreadsCount(), 4u);
+  EXPECT_EQ(pool.getWorkerIndex(), -1);
+}
+
+TEST(DesignExplorationTest, Exploration) {
+  Library *la, *lb;
+  DesignExploration exploration(makeProblem(la, lb), "behavior", 4);
+
+  std::set<std::set<std::string>> found;
+  exploration.run([&found](exploration_result &result) {
+    found.insert(names(result));
+    delete result.contract;
+  });
+
+  std::set<std::set<std::string>> expected{{"p1", "q1"}, {"p3", "q1"}};
+  EXPECT_EQ(found, expected);
+}
+
+TEST(DesignExplorationTest, Streaming) {
+  Library *la, *lb;
+  DesignExploration exploration(makeProblem(la, lb), "behavior", 3);
+  // Two components driving a, and one driving b: p2 conflicts with both
+  // p1 and p3, so only one pair survives.
+  exploration.addSlot(la, 2);
+  exploration.addSlot(lb);
+
+  exploration.start();
+  std::vector<exploration_result> results;
+  exploration_result result;
+  while (exploration.next(result))
+    results.push_back(result);
+  exploration.wait();
+
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(names(results[0]), (std::set<std::string>{"p1", "p3", "q1"}));
+  EXPECT_GT(exploration.getPrunedCount(), 0u);
+  EXPECT_GT(exploration.getMemoHitsCount(), 0u);
+}
+
+TEST(DesignExplorationTest, Dominance) {
+  Library *la, *lb;
+  DesignExploration exploration(makeProblem(la, lb), "behavior", 2);
+  exploration.setCostFunction([](ComponentDefinition *c) {
+    return c->getName()->getString() == "p1" ? 5.0 : 1.0;
+  });
+  exploration.setPruneDominated(true);
+
+  double best = 1e9;
+  exploration.run([&best](exploration_result &result) {
+    best = std::min(best, result.cost);
+    delete result.contract;
+  });
+  EXPECT_EQ(best, 2.0);
+}
+
+TEST(DesignExplorationTest, FailingCallbacks) {
+  // Errors other than ChaseError must not stop the exploration from
+  // completing.
+  Library *la, *lb;
+  DesignExploration exploration(makeProblem(la, lb), "behavior", 2);
+  exploration.setFilter([](const std::vector<ComponentDefinition *> &) -> bool {
+    throw std::runtime_error("filter failure");
+  });
+  size_t found = 0;
+  exploration.run([&found](exploration_result &result) {
+    ++found;
+    delete result.contract;
+  });
+  EXPECT_EQ(found, 0u);
+  EXPECT_GT(exploration.getFailedCount(), 0u);
+
+  DesignExploration streaming(makeProblem(la, lb), "behavior", 2);
+  streaming.setFilter(
+      [](const std::vector<ComponentDefinition *> &) -> bool { throw 1; });
+  streaming.start();
+  exploration_result result;
+  EXPECT_FALSE(streaming.next(result));
+  streaming.wait();
+  EXPECT_GT(streaming.getFailedCount(), 0u);
+}
@@ -0,0 +1,69 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chase;
+
+TEST(DiagnosticsTest, ErrorThrows) {
+  DiagnosticBuffer buffer;
+  size_t errors = getDiagnosticsCount(severity_error);
+
+  EXPECT_THROW(messageError("broken contract"), ChaseError);
+  try {
+    messageError(std::string("name clash"));
+  } catch (ChaseError &e) {
+    EXPECT_EQ(std::string(e.what()), "name clash");
+    EXPECT_EQ(e.getObject(), nullptr);
+  }
+
+  ASSERT_EQ(buffer.getMessages().size(), 2u);
+  EXPECT_EQ(buffer.getMessages()[0].severity, severity_error);
+  EXPECT_EQ(buffer.getMessages()[0].text, "broken contract");
+  EXPECT_EQ(getDiagnosticsCount(severity_error), errors + 2);
+
+  std::ostringstream str;
+  buffer.flush(str);
+  EXPECT_NE(str.str().find("ERROR:"), std::string::npos);
+  EXPECT_NE(str.str().find("|| name clash"), std::string::npos);
+  EXPECT_TRUE(buffer.getMessages().empty());
+}
+
+TEST(DiagnosticsTest, ThreadSinks) {
+  // Every thread collects its own messages, and the failure of a task
+  // does not affect the others.
+  const int threads = 8, messages = 200;
+  std::atomic<int> failures(0), collected(0);
+  size_t warnings = getDiagnosticsCount(severity_warning);
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      DiagnosticBuffer buffer;
+      for (int i = 0; i < messages; ++i) {
+        messageWarning("thread " + std::to_string(t));
+        try {
+          if (i % 10 == 0)
+            messageError("task failed");
+        } catch (ChaseError &) {
+          ++failures;
+        }
+      }
+      for (auto &message : buffer.getMessages())
+        if (message.severity == severity_warning &&
+            message.text == "thread " + std::to_string(t))
+          ++collected;
+    });
+  }
+  for (auto &worker : workers)
+    worker.join();
+
+  EXPECT_EQ(failures, threads * messages / 10);
+  EXPECT_EQ(collected, threads * messages);
+  EXPECT_EQ(getDiagnosticsCount(severity_warning),
+            warnings + threads * messages);
+}
@@ -0,0 +1,72 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace chase;
+
+TEST(ExpressionCompilerTest, Evaluate) {
+  auto x = new Variable(new Real(), new Name("x"));
+  auto y = new Variable(new Real(), new Name("y"));
+
+  // (x + 2) * y - x / 4
+  ExpressionProgram *p = compileExpression(
+      Sub(Mult(Sum(Id(x), IntVal(2)), Id(y)), Div(Id(x), RealVal(4.0))));
+  ASSERT_EQ(p->getVariables().size(), 2u);
+  EXPECT_EQ(p->getVariables()[0], x);
+  EXPECT_DOUBLE_EQ(p->evaluate({4.0, 3.0}), 17.0);
+  EXPECT_DOUBLE_EQ(p->evaluate({0.0, 1.0}), 2.0);
+  delete p;
+}
+
+TEST(ExpressionCompilerTest, ConstantFolding) {
+  auto x = new Variable(new Real(), new Name("x"));
+  ExpressionProgram *p = compileExpression(
+      Sum(Id(x), Mult(IntVal(3), new Expression(op_minus, IntVal(2)))));
+  // load x, load -6, add.
+  EXPECT_EQ(p->getCode().size(), 3u);
+  EXPECT_DOUBLE_EQ(p->evaluate({10.0}), 4.0);
+  delete p;
+}
+
+TEST(ExpressionCompilerTest, UnsupportedOperands) {
+  auto x = new Variable(new Real(), new Name("x"));
+  EXPECT_THROW(compileExpression(new Expression(op_plus, IntVal(1),
+                                                new StringValue("a"))),
+               ChaseError);
+  EXPECT_THROW(compileExpression(
+                   new Expression(op_minus, new StringValue("a"))),
+               ChaseError);
+  EXPECT_THROW(compileExpression(Sum(Id(x), new FunctionCall())),
+               ChaseError);
+}
+
+TEST(ExpressionCompilerTest, Constraints) {
+  auto x = new Variable(new Integer(), new Name("x"));
+  std::vector<Constraint *> constraints;
+  constraints.push_back(arithmeticConstraint(op_ge, Id(x), IntVal(0)));
+  constraints.push_back(arithmeticConstraint(op_lt, Id(x), IntVal(10)));
+  ExpressionProgram *p = compileConstraints(constraints);
+  EXPECT_EQ(p->evaluate({5.0}), 1.0);
+  EXPECT_EQ(p->evaluate({-1.0}), 0.0);
+  EXPECT_EQ(p->evaluate({10.0}), 0.0);
+  delete p;
+}
+
+TEST(ExpressionCompilerTest, Batch) {
+  auto x = new Variable(new Real(), new Name("x"));
+  auto y = new Variable(new Real(), new Name("y"));
+  ExpressionProgram *p =
+      compileExpression(LE(Sum(Id(x), Id(y)), RealVal(100.0)));
+
+  const size_t n = 1000;
+  std::vector<double> xs(n), ys(n), results(n);
+  for (size_t i = 0; i < n; ++i) {
+    xs[i] = static_cast<double>(i);
+    ys[i] = static_cast<double>(i % 7);
+  }
+  p->evaluateBatch({xs.data(), ys.data()}, n, results.data());
+  for (size_t i = 0; i < n; ++i)
+    EXPECT_EQ(results[i], p->evaluate({xs[i], ys[i]}));
+  delete p;
+}
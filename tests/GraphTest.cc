@@ -0,0 +1,861 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+using namespace chase;
+
+namespace {
+
+// Graph with the vertexes n0 ... n(size - 1) and the given edges.
+Graph *makeGraph(unsigned int size,
+                 const std::vector<std::pair<unsigned, unsigned>> &edges,
+                 bool directed = true) {
+  auto g = new Graph(size, directed);
+  for (unsigned int i = 0; i < size; ++i)
+    g->associateVertex(i, new Vertex(new Name("n" + std::to_string(i))));
+  for (auto &e : edges)
+    g->addEdge(new Edge(e.first, e.second));
+  return g;
+}
+
+// Nodes reached from a node, by breadth-first search.
+std::vector<bool> reachedFrom(Graph *g, unsigned int source) {
+  std::vector<bool> reached(g->getSize(), false);
+  std::vector<unsigned int> queue{source};
+  reached[source] = true;
+  for (size_t i = 0; i < queue.size(); ++i)
+    for (auto n : g->getAdjacentNodes(queue[i]))
+      if (!reached[n]) {
+        reached[n] = true;
+        queue.push_back(n);
+      }
+  return reached;
+}
+
+// Distances from a node, by breadth-first search on the adjacency.
+std::vector<unsigned int> distancesFrom(const compact_adjacency &adjacency,
+                                        unsigned int source) {
+  std::vector<unsigned int> distances(adjacency.getSize(), UINT_MAX);
+  std::vector<unsigned int> queue{source};
+  distances[source] = 0;
+  for (size_t i = 0; i < queue.size(); ++i) {
+    unsigned int v = queue[i];
+    for (unsigned int j = adjacency.offsets[v]; j < adjacency.offsets[v + 1];
+         ++j)
+      if (distances[adjacency.targets[j]] == UINT_MAX) {
+        distances[adjacency.targets[j]] = distances[v] + 1;
+        queue.push_back(adjacency.targets[j]);
+      }
+  }
+  return distances;
+}
+
+} // namespace
+
+TEST(GraphTest, VertexIndex) {
+  Graph *g = makeGraph(4, {{0, 1}});
+  EXPECT_EQ(g->getVertexIndex("n2"), 2);
+  EXPECT_EQ(g->getVertexIndex("x"), -1);
+
+  // Renaming through the vertex updates the index.
+  g->getVertex(2)->setName("x");
+  EXPECT_EQ(g->getVertexIndex("x"), 2);
+  EXPECT_EQ(g->getVertexIndex("n2"), -1);
+
+  // With duplicated names, the lowest index is found.
+  g->getVertex(3)->setName("x");
+  g->getVertex(1)->setName("x");
+  EXPECT_EQ(g->getVertexIndex("x"), 1);
+  g->getVertex(1)->setName("y");
+  EXPECT_EQ(g->getVertexIndex("x"), 2);
+  g->associateVertex(2, new Vertex(new Name("z")));
+  EXPECT_EQ(g->getVertexIndex("x"), 3);
+  EXPECT_EQ(g->getVertexIndex("z"), 2);
+
+  // Nodes without vertex are skipped.
+  Graph empty(3);
+  EXPECT_EQ(empty.getVertexIndex("GenericVertex"), -1);
+  EXPECT_THROW(g->addEdge(new Edge(0, 4)), ChaseError);
+}
+
+TEST(GraphTest, Adjacency) {
+  Graph *d = makeGraph(3, {{0, 1}, {1, 2}, {2, 0}});
+  EXPECT_EQ(d->getAdjacentNodes(0), std::set<unsigned int>{1});
+  EXPECT_NE(d->getEdge(1, 2), nullptr);
+  EXPECT_EQ(d->getEdge(2, 1), nullptr);
+
+  Graph *u = makeGraph(3, {{0, 1}, {1, 2}}, false);
+  EXPECT_EQ(u->getAdjacentNodes(1), (std::set<unsigned int>{0, 2}));
+  EXPECT_EQ(u->getIncidentEdges(1).size(), 2u);
+  EXPECT_EQ(u->getEdge(1, 0), nullptr);
+}
+
+TEST(GraphTest, SubGraph) {
+  Graph *g = makeGraph(5, {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {1, 1}});
+  g->addEdge(new WeightedEdge(4, 2, new IntegerValue(7)));
+
+  std::set<Vertex *> vertexes{g->getVertex(1), g->getVertex(2),
+                              g->getVertex(4)};
+  Graph *sub = getSubGraph(g, vertexes);
+  ASSERT_EQ(sub->getSize(), 3u);
+
+  // Edges between preserved nodes, mapped by name.
+  std::set<std::pair<std::string, std::string>> edges;
+  for (auto e : sub->getEdges())
+    edges.emplace(sub->getVertex(e->getSource())->getName()->getString(),
+                  sub->getVertex(e->getTarget())->getName()->getString());
+  EXPECT_EQ(edges, (std::set<std::pair<std::string, std::string>>{
+                       {"n1", "n2"}, {"n1", "n1"}, {"n4", "n2"}}));
+
+  // Weights are cloned.
+  auto n4 = static_cast<unsigned int>(sub->getVertexIndex("n4"));
+  auto n2 = static_cast<unsigned int>(sub->getVertexIndex("n2"));
+  auto w = dynamic_cast<WeightedEdge *>(sub->getEdge(n4, n2));
+  ASSERT_NE(w, nullptr);
+  EXPECT_EQ(w->getWeight()->getString(), "7");
+}
+
+TEST(GraphTest, View) {
+  Graph *g = makeGraph(6, {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {5, 5}});
+  g->addEdge(new WeightedEdge(4, 2, new IntegerValue(7)));
+
+  GraphView all(g);
+  EXPECT_EQ(all.getSize(), 6u);
+  EXPECT_EQ(all.getNeighbors(2), (std::vector<unsigned int>{0, 3}));
+  EXPECT_EQ(all.getAdjacency().targets.size(), 7u);
+
+  GraphView view(g, std::vector<unsigned int>{4, 2, 1, 2});
+  ASSERT_EQ(view.getSize(), 3u);
+  EXPECT_EQ(view.getNode(0), 1u);
+  EXPECT_TRUE(view.contains(4));
+  EXPECT_FALSE(view.contains(3));
+  EXPECT_EQ(view.getLocalIndex(4), 2);
+  EXPECT_EQ(view.getLocalIndex(0), -1);
+  EXPECT_EQ(view.getNeighbors(0), std::vector<unsigned int>{1});
+  EXPECT_EQ(view.getNeighbors(1), std::vector<unsigned int>{});
+
+  compact_adjacency adjacency = view.getAdjacency();
+  EXPECT_EQ(adjacency.offsets, (std::vector<unsigned int>{0, 1, 1, 2}));
+  EXPECT_EQ(adjacency.targets, (std::vector<unsigned int>{1, 1}));
+
+  Graph *sub = view.materialize();
+  ASSERT_EQ(sub->getSize(), 3u);
+  EXPECT_EQ(sub->getEdges().size(), 2u);
+  EXPECT_EQ(sub->getVertex(2)->getName()->getString(), "n4");
+  auto w = dynamic_cast<WeightedEdge *>(sub->getEdge(2, 1));
+  ASSERT_NE(w, nullptr);
+  EXPECT_EQ(w->getWeight()->getString(), "7");
+
+  // Undirected edges are materialized once.
+  Graph *u = makeGraph(3, {{0, 1}, {1, 2}, {2, 2}}, false);
+  GraphView uview(u, std::vector<unsigned int>{1, 2});
+  EXPECT_EQ(uview.getNeighbors(1), (std::vector<unsigned int>{0, 1}));
+  EXPECT_EQ(uview.materialize()->getEdges().size(), 2u);
+
+  // Views of the vertexes, as for getSubGraph.
+  GraphView byVertex(g, std::set<Vertex *>{g->getVertex(3), g->getVertex(5)});
+  EXPECT_EQ(byVertex.getNeighbors(1), std::vector<unsigned int>{1});
+}
+
+TEST(GraphTest, Reachability) {
+  WorkloadGenerator gen(7);
+  for (unsigned int size : {1u, 60u, 300u}) {
+    edge_list edges;
+    for (unsigned int i = 0; i < size * 2; ++i)
+      edges.emplace_back(static_cast<unsigned int>(gen.uniform(size)),
+                         static_cast<unsigned int>(gen.uniform(size)));
+    Graph *g = WorkloadGenerator::buildGraph(size, edges, true, false);
+
+    ReachabilityIndex dense(g);
+    ReachabilityIndex labels(g, 0, 2);
+    EXPECT_TRUE(dense.isDense());
+    EXPECT_FALSE(labels.isDense() && size > 0);
+    EXPECT_EQ(dense.getComponentsCount(), labels.getComponentsCount());
+    for (unsigned int s = 0; s < size; ++s) {
+      std::vector<bool> reached = reachedFrom(g, s);
+      for (unsigned int t = 0; t < size; ++t) {
+        ASSERT_EQ(dense.reaches(s, t), reached[t]) << s << " " << t;
+        ASSERT_EQ(labels.reaches(s, t), reached[t]) << s << " " << t;
+        if (reached[t]) {
+          EXPECT_GE(dense.getComponent(s), dense.getComponent(t));
+        }
+      }
+    }
+    delete g;
+  }
+
+  // A cycle is one component.
+  Graph *cycle = makeGraph(4, {{0, 1}, {1, 2}, {2, 0}, {2, 3}});
+  ReachabilityIndex index(cycle);
+  EXPECT_EQ(index.getComponentsCount(), 2u);
+  EXPECT_TRUE(index.reaches(2, 1));
+  EXPECT_FALSE(index.reaches(3, 0));
+  EXPECT_FALSE(index.reaches(0, 9));
+}
+
+TEST(GraphTest, StronglyConnectedComponents) {
+  WorkloadGenerator gen(11);
+  for (unsigned int size : {1u, 17u, 120u}) {
+    std::vector<std::pair<unsigned, unsigned>> edges;
+    for (unsigned int i = 0; i < size * 2; ++i)
+      edges.emplace_back(static_cast<unsigned int>(gen.uniform(size)),
+                         static_cast<unsigned int>(gen.uniform(size)));
+    Graph *g = makeGraph(size, edges);
+    const compact_adjacency &adjacency = g->getAdjacency();
+
+    std::vector<unsigned int> tarjan, kosaraju;
+    unsigned int count = getStronglyConnectedComponents(adjacency, tarjan);
+    EXPECT_EQ(getStronglyConnectedComponents(adjacency, kosaraju,
+                                             kosaraju_scc),
+              count);
+
+    std::vector<std::vector<bool>> reached;
+    for (unsigned int s = 0; s < size; ++s)
+      reached.push_back(reachedFrom(g, s));
+    for (unsigned int s = 0; s < size; ++s)
+      for (unsigned int t = 0; t < size; ++t) {
+        bool same = reached[s][t] && reached[t][s];
+        EXPECT_EQ(tarjan[s] == tarjan[t], same);
+        EXPECT_EQ(kosaraju[s] == kosaraju[t], same);
+        if (reached[s][t]) {
+          EXPECT_GE(tarjan[s], tarjan[t]);
+          EXPECT_GE(kosaraju[s], kosaraju[t]);
+        }
+      }
+
+    // The condensation links the components of the edges, once.
+    compact_adjacency dag = getCondensation(adjacency, tarjan, count);
+    ASSERT_EQ(dag.getSize(), count);
+    std::set<std::pair<unsigned, unsigned>> links;
+    for (auto &e : edges)
+      if (tarjan[e.first] != tarjan[e.second])
+        links.emplace(tarjan[e.first], tarjan[e.second]);
+    EXPECT_EQ(dag.targets.size(), links.size());
+    for (unsigned int c = 0; c < count; ++c)
+      for (unsigned int i = dag.offsets[c]; i < dag.offsets[c + 1]; ++i) {
+        EXPECT_EQ(links.count({c, dag.targets[i]}), 1u);
+        Edge *edge = g->getEdgeAt(dag.edges[i]);
+        EXPECT_EQ(tarjan[edge->getSource()], c);
+        EXPECT_EQ(tarjan[edge->getTarget()], dag.targets[i]);
+      }
+
+    // The reversed adjacency has the same edges.
+    compact_adjacency reverse = getReverseAdjacency(adjacency);
+    EXPECT_EQ(reverse.targets.size(), adjacency.targets.size());
+    for (unsigned int v = 0; v < size; ++v)
+      for (unsigned int i = reverse.offsets[v]; i < reverse.offsets[v + 1];
+           ++i)
+        EXPECT_EQ(g->getEdgeAt(reverse.edges[i])->getTarget(), v);
+    delete g;
+  }
+}
+
+TEST(GraphTest, TopologicalOrder) {
+  Graph *dag = makeGraph(6, {{5, 2}, {5, 0}, {4, 0}, {4, 1}, {2, 3}, {3, 1}});
+  std::vector<unsigned int> order, cycle;
+  EXPECT_TRUE(getTopologicalOrder(dag->getAdjacency(), order, cycle));
+  EXPECT_TRUE(cycle.empty());
+  ASSERT_EQ(order.size(), 6u);
+  std::vector<unsigned int> position(6);
+  for (unsigned int i = 0; i < order.size(); ++i)
+    position[order[i]] = i;
+  for (unsigned int i = 0; i < dag->getEdgesCount(); ++i) {
+    Edge *e = dag->getEdgeAt(i);
+    EXPECT_LT(position[e->getSource()], position[e->getTarget()]);
+  }
+  delete dag;
+
+  // The reported cycle is a sequence of edges closing on its first node.
+  Graph *g = makeGraph(6, {{0, 1}, {1, 2}, {2, 3}, {3, 1}, {3, 4}, {5, 0}});
+  EXPECT_FALSE(getTopologicalOrder(g->getAdjacency(), order, cycle));
+  EXPECT_EQ(order, (std::vector<unsigned int>{5, 0}));
+  ASSERT_EQ(cycle.size(), 3u);
+  for (size_t i = 0; i < cycle.size(); ++i) {
+    unsigned int next = cycle[(i + 1) % cycle.size()];
+    EXPECT_NE(g->getEdge(cycle[i], next), nullptr) << cycle[i] << " " << next;
+  }
+  delete g;
+
+  Graph *loop = makeGraph(2, {{0, 1}, {1, 1}});
+  EXPECT_FALSE(getTopologicalOrder(loop->getAdjacency(), order, cycle));
+  EXPECT_EQ(cycle, std::vector<unsigned int>{1});
+  delete loop;
+}
+
+namespace {
+
+// Graph with a WeightedEdge of integer weight for each edge.
+Graph *makeWeightedGraph(
+    unsigned int size,
+    const std::vector<std::tuple<unsigned, unsigned, int>> &edges,
+    bool directed = true) {
+  Graph *g = makeGraph(size, {}, directed);
+  for (auto &e : edges)
+    g->addEdge(new WeightedEdge(std::get<0>(e), std::get<1>(e),
+                                new IntegerValue(std::get<2>(e))));
+  return g;
+}
+
+// Lengths of all the simple paths between two nodes, by exhaustive search.
+void simplePathLengths(const compact_adjacency &adjacency,
+                       const std::vector<double> &weights, unsigned int node,
+                       unsigned int target, double length,
+                       std::vector<bool> &visited,
+                       std::vector<double> &lengths) {
+  if (node == target) {
+    lengths.push_back(length);
+    return;
+  }
+  visited[node] = true;
+  for (unsigned int i = adjacency.offsets[node];
+       i < adjacency.offsets[node + 1]; ++i)
+    if (!visited[adjacency.targets[i]])
+      simplePathLengths(adjacency, weights, adjacency.targets[i], target,
+                        length + weights[adjacency.edges[i]], visited,
+                        lengths);
+  visited[node] = false;
+}
+
+} // namespace
+
+TEST(GraphTest, EdgeWeights) {
+  Graph *g = makeGraph(3, {{0, 1}});
+  g->addEdge(new WeightedEdge(1, 2, new IntegerValue(4)));
+  g->addEdge(new WeightedEdge(2, 0, new RealValue(0.5)));
+  EXPECT_EQ(getEdgeWeights(g), (std::vector<double>{1.0, 4.0, 0.5}));
+  EXPECT_EQ(getEdgeWeights(g, 2.0), (std::vector<double>{2.0, 4.0, 0.5}));
+  g->addEdge(new WeightedEdge(2, 1, new StringValue("x")));
+  EXPECT_THROW(getEdgeWeights(g), ChaseError);
+  delete g;
+}
+
+TEST(GraphTest, ShortestPaths) {
+  WorkloadGenerator gen(5);
+  for (bool directed : {true, false}) {
+    unsigned int size = 200;
+    std::vector<std::tuple<unsigned, unsigned, int>> edges;
+    for (unsigned int i = 0; i < size * 3; ++i)
+      edges.emplace_back(static_cast<unsigned int>(gen.uniform(size)),
+                         static_cast<unsigned int>(gen.uniform(size)),
+                         static_cast<int>(gen.uniform(100)));
+    Graph *g = makeWeightedGraph(size, edges, directed);
+    const compact_adjacency &adjacency = g->getAdjacency();
+    std::vector<double> weights = getEdgeWeights(g);
+
+    shortest_paths binary = findShortestPaths(adjacency, weights, 0);
+    shortest_paths radix =
+        findShortestPaths(adjacency, weights, 0, radix_heap);
+    shortest_paths bellman;
+    ASSERT_TRUE(findShortestPathsBellmanFord(adjacency, weights, 0, bellman));
+    std::vector<bool> reached = reachedFrom(g, 0);
+    for (unsigned int v = 0; v < size; ++v) {
+      EXPECT_EQ(binary.distances[v], radix.distances[v]);
+      EXPECT_EQ(binary.distances[v], bellman.distances[v]);
+      EXPECT_EQ(reached[v], !binary.getPath(v).empty());
+      if (!reached[v] || v == 0)
+        continue;
+      // The parent edges add up to the distance.
+      double length = 0;
+      for (unsigned int w = v; w != 0; w = binary.parents[w])
+        length += weights[binary.edges[w]];
+      EXPECT_EQ(length, binary.distances[v]);
+    }
+
+    ThreadPool pool(4);
+    std::vector<unsigned int> sources{0, 7, 42, 199};
+    std::vector<shortest_paths> batch =
+        findShortestPathsFromSources(adjacency, weights, sources, pool);
+    ASSERT_EQ(batch.size(), sources.size());
+    for (size_t i = 0; i < sources.size(); ++i)
+      EXPECT_EQ(batch[i].distances,
+                findShortestPaths(adjacency, weights, sources[i]).distances);
+    delete g;
+  }
+}
+
+TEST(GraphTest, NegativeWeights) {
+  Graph *g = makeWeightedGraph(4, {{0, 1, 4}, {0, 2, 1}, {1, 3, -3},
+                                   {2, 3, 2}});
+  std::vector<double> weights = getEdgeWeights(g);
+  shortest_paths paths;
+  EXPECT_TRUE(findShortestPathsBellmanFord(g->getAdjacency(), weights, 0,
+                                           paths));
+  EXPECT_EQ(paths.distances[3], 1.0);
+  EXPECT_EQ(paths.getPath(3), (std::vector<unsigned int>{0, 1, 3}));
+  EXPECT_THROW(findShortestPaths(g->getAdjacency(), weights, 0), ChaseError);
+
+  g->addEdge(new WeightedEdge(3, 1, new IntegerValue(2)));
+  weights = getEdgeWeights(g);
+  EXPECT_FALSE(findShortestPathsBellmanFord(g->getAdjacency(), weights, 0,
+                                            paths));
+  delete g;
+}
+
+TEST(GraphTest, KShortestPaths) {
+  // C D E F G H
+  Graph *g = makeWeightedGraph(6, {{0, 1, 3},
+                                   {0, 2, 2},
+                                   {1, 3, 4},
+                                   {2, 1, 1},
+                                   {2, 3, 2},
+                                   {2, 4, 3},
+                                   {3, 4, 2},
+                                   {3, 5, 1},
+                                   {4, 5, 2}});
+  std::vector<weighted_path> paths =
+      findKShortestPaths(g->getAdjacency(), getEdgeWeights(g), 0, 5, 3);
+  ASSERT_EQ(paths.size(), 3u);
+  EXPECT_EQ(paths[0].nodes, (std::vector<unsigned int>{0, 2, 3, 5}));
+  EXPECT_EQ(paths[0].length, 5.0);
+  EXPECT_EQ(paths[1].nodes, (std::vector<unsigned int>{0, 2, 4, 5}));
+  EXPECT_EQ(paths[1].length, 7.0);
+  EXPECT_EQ(paths[2].length, 8.0);
+  delete g;
+
+  // Against all the simple paths of random graphs.
+  WorkloadGenerator gen(3);
+  for (bool directed : {true, false}) {
+    unsigned int size = 9;
+    std::vector<std::tuple<unsigned, unsigned, int>> edges;
+    for (unsigned int i = 0; i < 20; ++i)
+      edges.emplace_back(static_cast<unsigned int>(gen.uniform(size)),
+                         static_cast<unsigned int>(gen.uniform(size)),
+                         static_cast<int>(gen.uniform(10)));
+    g = makeWeightedGraph(size, edges, directed);
+    std::vector<double> weights = getEdgeWeights(g);
+    std::vector<double> lengths;
+    std::vector<bool> visited(size, false);
+    simplePathLengths(g->getAdjacency(), weights, 0, size - 1, 0.0, visited,
+                      lengths);
+    std::sort(lengths.begin(), lengths.end());
+
+    paths = findKShortestPaths(g->getAdjacency(), weights, 0, size - 1, 50);
+    ASSERT_EQ(paths.size(), std::min<size_t>(lengths.size(), 50));
+    std::set<std::vector<unsigned int>> distinct;
+    for (size_t i = 0; i < paths.size(); ++i) {
+      EXPECT_EQ(paths[i].length, lengths[i]);
+      EXPECT_EQ(paths[i].nodes.front(), 0u);
+      EXPECT_EQ(paths[i].nodes.back(), size - 1);
+      EXPECT_EQ(paths[i].edges.size() + 1, paths[i].nodes.size());
+      distinct.insert(paths[i].edges);
+    }
+    EXPECT_EQ(distinct.size(), paths.size());
+    delete g;
+  }
+}
+
+namespace {
+
+// Whether a node reaches another one, without the given edges and nodes.
+bool reachesWithout(const compact_adjacency &adjacency, unsigned int source,
+                    unsigned int target,
+                    const std::vector<unsigned int> &edges,
+                    const std::vector<unsigned int> &nodes) {
+  std::set<unsigned int> removedEdges(edges.begin(), edges.end());
+  std::vector<bool> visited(adjacency.getSize(), false);
+  for (auto n : nodes)
+    visited[n] = true;
+  std::vector<unsigned int> stack{source};
+  visited[source] = true;
+  while (!stack.empty()) {
+    unsigned int v = stack.back();
+    stack.pop_back();
+    if (v == target)
+      return true;
+    for (unsigned int i = adjacency.offsets[v]; i < adjacency.offsets[v + 1];
+         ++i)
+      if (!visited[adjacency.targets[i]] &&
+          removedEdges.count(adjacency.edges[i]) == 0) {
+        visited[adjacency.targets[i]] = true;
+        stack.push_back(adjacency.targets[i]);
+      }
+  }
+  return false;
+}
+
+} // namespace
+
+TEST(GraphTest, DisjointPaths) {
+  // Two routes from 0 to 5 through 1 and 2, joined at 3, plus 0 -> 5.
+  Graph *g = makeGraph(6, {{0, 1}, {0, 2}, {1, 3}, {2, 3}, {3, 4}, {3, 5},
+                           {4, 5}, {0, 5}, {0, 1}});
+  const compact_adjacency &adjacency = g->getAdjacency();
+  minimum_cut cut;
+  EXPECT_EQ(countEdgeDisjointPaths(adjacency, 0, 5, &cut), 3u);
+  EXPECT_EQ(cut.edges.size(), 3u);
+  EXPECT_TRUE(cut.nodes.empty());
+  EXPECT_TRUE(cut.sourceSide[0]);
+  EXPECT_FALSE(cut.sourceSide[5]);
+  EXPECT_FALSE(reachesWithout(adjacency, 0, 5, cut.edges, {}));
+
+  EXPECT_EQ(countVertexDisjointPaths(adjacency, 0, 5, &cut), 2u);
+  EXPECT_EQ(cut.nodes, std::vector<unsigned int>{3});
+  EXPECT_EQ(cut.edges.size(), 1u);
+  EXPECT_EQ(g->getEdgeAt(cut.edges[0])->getTarget(), 5u);
+  EXPECT_EQ(countEdgeDisjointPaths(adjacency, 5, 0), 0u);
+  EXPECT_THROW(countEdgeDisjointPaths(adjacency, 2, 2), ChaseError);
+  delete g;
+
+  WorkloadGenerator gen(13);
+  for (bool directed : {true, false}) {
+    unsigned int size = 80;
+    std::vector<std::pair<unsigned, unsigned>> edges;
+    for (unsigned int i = 0; i < size * 4; ++i)
+      edges.emplace_back(static_cast<unsigned int>(gen.uniform(size)),
+                         static_cast<unsigned int>(gen.uniform(size)));
+    g = makeGraph(size, edges, directed);
+    const compact_adjacency &random = g->getAdjacency();
+    for (unsigned int s = 0; s < 10; ++s) {
+      unsigned int t = size - 1 - s;
+      // The cuts separate the nodes, and they are as large as the flows.
+      unsigned int flow = countEdgeDisjointPaths(random, s, t, &cut);
+      EXPECT_EQ(cut.edges.size(), flow);
+      EXPECT_FALSE(reachesWithout(random, s, t, cut.edges, {}));
+      unsigned int vertexFlow = countVertexDisjointPaths(random, s, t, &cut);
+      EXPECT_LE(vertexFlow, flow);
+      EXPECT_EQ(cut.nodes.size() + cut.edges.size(), vertexFlow);
+      EXPECT_FALSE(reachesWithout(random, s, t, cut.edges, cut.nodes));
+      for (auto n : cut.nodes) {
+        EXPECT_NE(n, s);
+        EXPECT_NE(n, t);
+      }
+    }
+    delete g;
+  }
+}
+
+TEST(GraphTest, Writers) {
+  auto g = new Graph(4, true, new Name("a \"b\""));
+  g->associateVertex(0, new Vertex(new Name("x<y")));
+  g->associateVertex(1, new Vertex(new Name("y")));
+  g->associateVertex(3, new Vertex(new Name("z")));
+  g->addEdge(new Edge(0, 1));
+  g->addEdge(new WeightedEdge(1, 3, new IntegerValue(7)));
+  g->addEdge(new WeightedEdge(3, 0, new RealValue(0.5)));
+
+  std::ostringstream dot;
+  std::vector<unsigned int> clusters{1, 1, UINT_MAX, 1};
+  writeGraphViz(g, dot, &clusters);
+  EXPECT_EQ(dot.str(), "digraph \"a \\\"b\\\"\" {\n"
+                       "\tsubgraph cluster_1 {\n"
+                       "\t\tlabel=\"1\";\n"
+                       "\t\t0 [label=\"x<y\"];\n"
+                       "\t\t1 [label=\"y\"];\n"
+                       "\t}\n"
+                       "\t2;\n"
+                       "\tsubgraph cluster_1 {\n"
+                       "\t\tlabel=\"1\";\n"
+                       "\t\t3 [label=\"z\"];\n"
+                       "\t}\n"
+                       "\t0 -> 1;\n"
+                       "\t1 -> 3 [label=\"7\"];\n"
+                       "\t3 -> 0 [label=\"" +
+                           RealValue(0.5).getString() +
+                           "\"];\n"
+                           "}\n");
+  EXPECT_EQ(g->getVertex(1)->getGraphViz(), "label=\"y\"");
+
+  std::ostringstream graphml;
+  writeGraphML(g, graphml, &clusters);
+  std::string xml = graphml.str();
+  EXPECT_NE(xml.find("edgedefault=\"directed\""), std::string::npos);
+  EXPECT_NE(xml.find("<node id=\"n0\"><data key=\"label\">x&lt;y</data>"
+                     "<data key=\"cluster\">1</data></node>"),
+            std::string::npos);
+  EXPECT_NE(xml.find("<node id=\"n2\"/>"), std::string::npos);
+  EXPECT_NE(xml.find("<edge source=\"n1\" target=\"n3\">"
+                     "<data key=\"weight\">7</data></edge>"),
+            std::string::npos);
+  EXPECT_EQ(xml.substr(xml.size() - 22), "  </graph>\n</graphml>\n");
+  delete g;
+
+  // Outputs larger than the buffer.
+  Graph *large = makeGraph(20000, {}, false);
+  for (unsigned int i = 1; i < 20000; ++i)
+    large->addEdge(new Edge(i - 1, i));
+  std::ostringstream stream;
+  writeGraphViz(large, stream);
+  std::string text = large->getGraphViz();
+  EXPECT_EQ(stream.str(), text);
+  EXPECT_EQ(std::count(text.begin(), text.end(), '\n'), 1 + 20000 + 19999 + 1);
+  EXPECT_NE(text.find("\t19998 -- 19999;\n}\n"), std::string::npos);
+  delete large;
+}
+
+TEST(GraphTest, BulkLoad) {
+  Graph bulk(4, {0, 1, 2, 3}, {1, 2, 3, 1}, {0.5, 2, 1, 4}, true);
+  EXPECT_EQ(bulk.getEdgesCount(), 4u);
+  EXPECT_EQ(bulk.getBulkEdgesCount(), 4u);
+  EXPECT_EQ(bulk.getEdgeSource(3), 3u);
+  EXPECT_EQ(bulk.getEdgeTarget(3), 1u);
+  EXPECT_EQ(bulk.getAdjacentNodes(1), std::set<unsigned int>{2});
+  EXPECT_EQ(getEdgeWeights(&bulk), (std::vector<double>{0.5, 2, 1, 4}));
+  std::ostringstream dot;
+  writeGraphViz(&bulk, dot);
+  EXPECT_NE(dot.str().find("\t3 -> 1 [label=\"4.\"];\n"), std::string::npos);
+
+  // Edges added later follow the bulk ones.
+  bulk.addEdge(new WeightedEdge(2, 0, new IntegerValue(3)));
+  EXPECT_EQ(getEdgeWeights(&bulk), (std::vector<double>{0.5, 2, 1, 4, 3}));
+  const compact_adjacency &adjacency = bulk.getAdjacency();
+  EXPECT_EQ(adjacency.offsets[3] - adjacency.offsets[2], 2u);
+  Graph *copy = bulk.clone();
+  EXPECT_EQ(copy->getBulkEdgesCount(), 4u);
+  EXPECT_EQ(copy->getEdgesCount(), 5u);
+
+  // The objects are created on request, in index order.
+  EXPECT_EQ(bulk.getEdges().size(), 5u);
+  auto weighted = dynamic_cast<WeightedEdge *>(bulk.getEdgeAt(1));
+  ASSERT_NE(weighted, nullptr);
+  EXPECT_EQ(weighted->getSource(), 1u);
+  EXPECT_EQ(dynamic_cast<RealValue *>(weighted->getWeight())->getValue(), 2.0);
+  EXPECT_EQ(bulk.getIncidentEdges(2).size(), 2u);
+  EXPECT_EQ(bulk.getEdge(3, 1), bulk.getEdgeAt(3));
+  bulk.addEdge(new Edge(0, 3));
+  EXPECT_EQ(bulk.getIncidentEdges(0).size(), 2u);
+  EXPECT_EQ(copy->getEdge(2, 0)->getSource(), 2u);
+  delete copy;
+
+  // The same graph as the one built edge by edge.
+  WorkloadGenerator gen(9);
+  edge_list edges;
+  for (unsigned int i = 0; i < 300; ++i)
+    edges.emplace_back(static_cast<unsigned int>(gen.uniform(50)),
+                       static_cast<unsigned int>(gen.uniform(50)));
+  for (bool directed : {true, false}) {
+    Graph *loaded = WorkloadGenerator::buildGraph(50, edges, directed, true);
+    Graph *built = makeGraph(50, edges, directed);
+    EXPECT_EQ(loaded->getAdjacency().targets, built->getAdjacency().targets);
+    EXPECT_EQ(loaded->getAdjacency().edges, built->getAdjacency().edges);
+    EXPECT_EQ(loaded->getGraphViz(), built->getGraphViz());
+    for (unsigned int n = 0; n < 50; ++n)
+      EXPECT_EQ(loaded->getAdjacentNodes(n), built->getAdjacentNodes(n));
+    delete loaded;
+    delete built;
+  }
+
+  EXPECT_THROW(Graph(2, {0, 2}, {1, 1}), ChaseError);
+  EXPECT_THROW(Graph(2, {0}, {1, 1}), ChaseError);
+}
+
+TEST(GraphTest, BulkSubGraph) {
+  Graph bulk(4, {0, 1, 2, 2, 1}, {1, 2, 1, 3, 1}, {0.5, 2, 3, 1, 5}, true);
+  for (unsigned int i = 0; i < 4; ++i)
+    bulk.associateVertex(i, new Vertex(new Name("n" + std::to_string(i))));
+  bulk.addEdge(new WeightedEdge(3, 2, new IntegerValue(7)));
+
+  // The edges of the sub-graph, as source, target and weight.
+  auto edgesOf = [](Graph *g) {
+    std::set<std::tuple<std::string, std::string, std::string>> edges;
+    for (auto e : g->getEdges()) {
+      auto weighted = dynamic_cast<WeightedEdge *>(e);
+      edges.emplace(g->getVertex(e->getSource())->getName()->getString(),
+                    g->getVertex(e->getTarget())->getName()->getString(),
+                    weighted ? weighted->getWeight()->getString() : "");
+    }
+    return edges;
+  };
+
+#ifdef CHASE_PROFILING
+  resetProfile();
+  setProfilingEnabled(true);
+#endif
+  Graph *sub = getSubGraph(&bulk, {bulk.getVertex(1), bulk.getVertex(2)});
+  Graph *other = getSubGraph(&bulk, {bulk.getVertex(2), bulk.getVertex(3)});
+#ifdef CHASE_PROFILING
+  setProfilingEnabled(false);
+  // The objects of the edges loaded in bulk are not created.
+  for (auto &entry : getProfileSummary())
+    EXPECT_NE(entry.name, "Graph::materializeEdges");
+  resetProfile();
+#endif
+
+  using edge = std::tuple<std::string, std::string, std::string>;
+  EXPECT_EQ(edgesOf(sub), (std::set<edge>{{"n1", "n2", "2."},
+                                          {"n2", "n1", "3."},
+                                          {"n1", "n1", "5."}}));
+  EXPECT_EQ(edgesOf(other), (std::set<edge>{{"n2", "n3", "1."},
+                                            {"n3", "n2", "7"}}));
+  delete sub;
+  delete other;
+}
+
+TEST(GraphTest, EdgeListReader) {
+  std::string text = "# comment\n0 1 2.5\n\n1 2 -1\n% comment\n 3\t0 4";
+  std::istringstream in(text);
+  Graph *g = readEdgeList(in, true);
+  EXPECT_EQ(g->getSize(), 4u);
+  EXPECT_EQ(g->getEdgesCount(), 3u);
+  EXPECT_TRUE(g->isDirected());
+  EXPECT_EQ(g->getBulkWeights(), (std::vector<double>{2.5, -1, 4}));
+  EXPECT_EQ(g->getEdgeSource(2), 3u);
+  delete g;
+
+  // Lines across the blocks of the reader.
+  std::string large;
+  for (unsigned int i = 0; i < 30000; ++i)
+    large += std::to_string(i) + " " + std::to_string((i * 7) % 30000) + "\n";
+  std::istringstream bulk(large);
+  g = readEdgeList(bulk);
+  ASSERT_EQ(g->getEdgesCount(), 30000u);
+  EXPECT_TRUE(g->getBulkWeights().empty());
+  for (unsigned int i = 0; i < 30000; i += 997)
+    EXPECT_EQ(g->getEdgeTarget(i), (i * 7) % 30000);
+  delete g;
+
+  std::istringstream mixed("0 1 2\n1 2\n");
+  EXPECT_THROW(readEdgeList(mixed), ChaseError);
+  std::istringstream malformed("0 x\n");
+  EXPECT_THROW(readEdgeList(malformed), ChaseError);
+  EXPECT_THROW(readEdgeList(std::string("/nonexistent/edges.txt")),
+               ChaseError);
+}
+
+TEST(GraphTest, BreadthFirstSearch) {
+  WorkloadGenerator gen(49);
+  ThreadPool pool(4);
+  // Sparse graphs keep the search top-down, dense ones switch to bottom-up.
+  for (unsigned int degree : {1u, 2u, 16u}) {
+    for (bool directed : {true, false}) {
+      const unsigned int size = 5000;
+      edge_list edges;
+      for (unsigned int i = 0; i < size * degree; ++i)
+        edges.emplace_back(static_cast<unsigned int>(gen.uniform(size)),
+                           static_cast<unsigned int>(gen.uniform(size)));
+      Graph *g = WorkloadGenerator::buildGraph(size, edges, directed, false);
+      const compact_adjacency &adjacency = g->getAdjacency();
+
+      BreadthFirstSearch serial(g);
+      BreadthFirstSearch parallel(adjacency, !directed, &pool);
+      EXPECT_EQ(parallel.getSize(), size);
+      for (unsigned int s : {0u, 17u, size - 1}) {
+        std::vector<unsigned int> expected = distancesFrom(adjacency, s);
+        EXPECT_EQ(serial.getDistances(s), expected) << degree << directed;
+        EXPECT_EQ(parallel.getDistances(s), expected) << degree << directed;
+      }
+
+      // Three batches, the last one partial, and a repeated source.
+      std::vector<unsigned int> sources;
+      for (unsigned int i = 0; i < 150; ++i)
+        sources.push_back(static_cast<unsigned int>(gen.uniform(size)));
+      sources[100] = sources[99];
+      std::vector<unsigned int> distances = parallel.getDistances(sources);
+      std::vector<uint64_t> reached = parallel.getReachedSets(sources);
+      EXPECT_EQ(serial.getReachedSets(sources), reached);
+      ASSERT_EQ(distances.size(), sources.size() * size);
+      ASSERT_EQ(reached.size(), 3 * size);
+      for (size_t i = 0; i < sources.size(); ++i) {
+        std::vector<unsigned int> expected = distancesFrom(adjacency,
+                                                           sources[i]);
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(),
+                               distances.begin() + i * size))
+            << i;
+        for (unsigned int v = 0; v < size; ++v)
+          ASSERT_EQ((reached[i / 64 * size + v] >> (i % 64)) & 1,
+                    expected[v] != UINT_MAX)
+              << i << " " << v;
+      }
+      delete g;
+    }
+  }
+
+  {
+    // Searches started by tasks of the pool they use wait only for their
+    // own tasks, also when they outnumber the workers.
+    const unsigned int size = 5000;
+    edge_list edges;
+    for (unsigned int i = 0; i < size * 16; ++i)
+      edges.emplace_back(static_cast<unsigned int>(gen.uniform(size)),
+                         static_cast<unsigned int>(gen.uniform(size)));
+    Graph *g = WorkloadGenerator::buildGraph(size, edges, false, false);
+    ThreadPool shared(2);
+    BreadthFirstSearch serial(g);
+    BreadthFirstSearch parallel(g, &shared);
+    std::vector<unsigned int> sources;
+    for (unsigned int i = 0; i < 150; ++i)
+      sources.push_back(static_cast<unsigned int>(gen.uniform(size)));
+    std::vector<uint64_t> expected = serial.getReachedSets(sources);
+    std::vector<unsigned int> distances = serial.getDistances(0);
+    std::atomic<unsigned int> matching(0);
+    for (int t = 0; t < 4; ++t) {
+      shared.submit([&] {
+        if (parallel.getReachedSets(sources) == expected &&
+            parallel.getDistances(0) == distances)
+          ++matching;
+      });
+    }
+    shared.wait();
+    EXPECT_EQ(matching, 4u);
+    delete g;
+  }
+
+  Graph *g = makeGraph(3, {{0, 1}});
+  BreadthFirstSearch search(g);
+  EXPECT_EQ(search.getDistances(2), (std::vector<unsigned int>{UINT_MAX,
+                                                                UINT_MAX, 0}));
+  EXPECT_TRUE(search.getReachedSets({}).empty());
+  EXPECT_THROW(search.getDistances(3), ChaseError);
+  EXPECT_THROW(search.getReachedSets({0, 5}), ChaseError);
+  delete g;
+}
+
+TEST(GraphTest, Partitioning) {
+  // Eight dense groups of 50 nodes, joined in a ring by two edges each.
+  WorkloadGenerator gen(50);
+  const unsigned int groups = 8, members = 50;
+  edge_list edges;
+  for (unsigned int c = 0; c < groups; ++c) {
+    for (unsigned int i = 0; i < members * 6; ++i)
+      edges.emplace_back(c * members + gen.uniform(members),
+                         c * members + gen.uniform(members));
+    unsigned int next = (c + 1) % groups;
+    for (unsigned int i = 0; i < 2; ++i)
+      edges.emplace_back(c * members + gen.uniform(members),
+                         next * members + gen.uniform(members));
+  }
+  Graph *g = WorkloadGenerator::buildGraph(groups * members, edges, false,
+                                           false);
+  const compact_adjacency &adjacency = g->getAdjacency();
+  std::vector<unsigned int> parts = partitionGraph(adjacency, {}, groups);
+  ASSERT_EQ(parts.size(), groups * members);
+  std::vector<unsigned int> sizes(groups, 0);
+  for (auto p : parts) {
+    ASSERT_LT(p, groups);
+    ++sizes[p];
+  }
+  for (auto size : sizes)
+    EXPECT_LE(size, members * 1.03);
+  EXPECT_EQ(getCutWeight(adjacency, {}, parts), 2.0 * groups);
+  EXPECT_EQ(partitionGraph(adjacency, {}, groups), parts);
+
+  // Weights: the heavy edges stay inside the parts.
+  std::vector<double> weights(g->getEdgesCount(), 1.0);
+  for (unsigned int e = 0; e < g->getEdgesCount(); ++e)
+    if (g->getEdgeSource(e) / members != g->getEdgeTarget(e) / members)
+      weights[e] = 0.5;
+  parts = partitionGraph(adjacency, weights, 2, 0.0);
+  EXPECT_EQ(std::count(parts.begin(), parts.end(), 0u), groups * members / 2);
+  EXPECT_EQ(getCutWeight(adjacency, weights, parts), 2.0);
+  delete g;
+
+  // Node weights: the heavy node is alone.
+  g = makeGraph(4, {{0, 1}, {1, 2}, {2, 3}}, false);
+  parts = partitionGraph(g->getAdjacency(), {}, 2, 0.03, {3, 1, 1, 1});
+  EXPECT_NE(parts[0], parts[1]);
+  EXPECT_EQ(std::count(parts.begin(), parts.end(), parts[1]), 3);
+  // More parts than nodes.
+  parts = partitionGraph(g->getAdjacency(), {}, 8);
+  EXPECT_EQ(std::set<unsigned int>(parts.begin(), parts.end()).size(), 4u);
+  EXPECT_EQ(partitionGraph(g->getAdjacency(), {}, 1),
+            std::vector<unsigned int>(4, 0));
+  EXPECT_THROW(partitionGraph(g->getAdjacency(), {}, 0), ChaseError);
+  EXPECT_THROW(partitionGraph(g->getAdjacency(), {1, -1, 1}, 2), ChaseError);
+  delete g;
+}
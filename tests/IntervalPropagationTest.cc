@@ -0,0 +1,61 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+using namespace chase;
+
+TEST(IntervalPropagationTest, Linear) {
+  auto x = new Variable(new Integer(0, 10), new Name("x"));
+  auto y = new Variable(new Integer(0, 10), new Name("y"));
+
+  IntervalPropagator p;
+  // x + y = 15, x <= 6
+  p.addConstraint(Eq(Sum(Id(x), Id(y)), IntVal(15)));
+  p.addConstraint(LE(Id(x), IntVal(6)));
+  ASSERT_TRUE(p.propagate());
+
+  EXPECT_EQ(p.getDomain(x).lower, 5.0);
+  EXPECT_EQ(p.getDomain(x).upper, 6.0);
+  EXPECT_EQ(p.getDomain(y).lower, 9.0);
+  EXPECT_EQ(p.getDomain(y).upper, 10.0);
+}
+
+TEST(IntervalPropagationTest, Domains) {
+  auto x = new Variable(new Real(), new Name("x"));
+  auto y = new Variable(new Real(), new Name("y"));
+
+  IntervalPropagator p;
+  p.addVariable(x, new Interval(new RealValue(1.0), new RealValue(4.0)));
+  p.addVariable(y, new Range(-10, 10));
+  // y = 2 * x
+  p.addConstraint(Eq(Id(y), Mult(IntVal(2), Id(x))));
+  ASSERT_TRUE(p.propagate());
+  EXPECT_DOUBLE_EQ(p.getDomain(y).lower, 2.0);
+  EXPECT_DOUBLE_EQ(p.getDomain(y).upper, 8.0);
+
+  Interval *i = p.getInterval(y);
+  EXPECT_EQ(i->getLeftBound()->IsA(), realValue_node);
+  delete i;
+}
+
+TEST(IntervalPropagationTest, Infeasible) {
+  auto x = new Variable(new Integer(0, 100), new Name("x"));
+  auto y = new Variable(new Integer(0, 100), new Name("y"));
+
+  IntervalPropagator p;
+  p.addConstraint(LT(Id(x), Id(y)));
+  p.addConstraint(LT(Id(y), Id(x)));
+  EXPECT_FALSE(p.propagate());
+  EXPECT_FALSE(p.isConsistent());
+}
+
+TEST(IntervalPropagationTest, Unbounded) {
+  auto x = new Variable(new Real(), new Name("x"));
+  auto y = new Variable(new Real(), new Name("y"));
+
+  // Cyclic constraints over unbounded domains must terminate.
+  IntervalPropagator p;
+  p.addConstraint(LE(Id(x), Sub(Id(y), IntVal(1))));
+  p.addConstraint(LE(Id(y), Sub(Id(x), IntVal(1))));
+  p.propagate();
+  EXPECT_LT(p.getRevisionsCount(), 100u);
+}
@@ -0,0 +1,80 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+using namespace chase;
+
+namespace {
+
+Proposition *boolProp(const std::string &name) {
+  return Prop(new Variable(new Boolean(), new Name(name)));
+}
+
+} // namespace
+
+TEST(LtlToBuchiTest, HashConsing) {
+  LtlFormulaTable table;
+  auto a = boolProp("a");
+  auto b = boolProp("b");
+  unsigned int f1 = table.intern(And(a, b));
+  unsigned int f2 = table.intern(And(b->clone(), a->clone()));
+  EXPECT_EQ(f1, f2);
+  EXPECT_EQ(table.getAtomsCount(), 2u);
+  // Negations are pushed to the atoms.
+  unsigned int n = table.intern(Not(Or(a->clone(), b->clone())));
+  EXPECT_EQ(table.getNode(n).kind, ltl_and);
+}
+
+TEST(LtlToBuchiTest, Satisfiability) {
+  auto a = boolProp("a");
+  auto b = boolProp("b");
+
+  EXPECT_TRUE(isSatisfiableLTL(Until(a, b)));
+  EXPECT_TRUE(isSatisfiableLTL(Always(Eventually(a->clone()))));
+  EXPECT_FALSE(
+      isSatisfiableLTL(And(Always(a->clone()), Eventually(Not(a->clone())))));
+  EXPECT_FALSE(isSatisfiableLTL(
+      And(Always(Eventually(b->clone())), Eventually(Always(Not(b->clone()))))));
+  EXPECT_FALSE(isSatisfiableLTL(And(Next(a->clone()), Next(Not(a->clone())))));
+}
+
+TEST(LtlToBuchiTest, Validity) {
+  auto a = boolProp("a");
+  EXPECT_TRUE(isValidLTL(Implies(Always(a), Eventually(a->clone()))));
+  EXPECT_TRUE(isValidLTL(Or(a->clone(), Not(a->clone()))));
+  EXPECT_FALSE(isValidLTL(Eventually(a->clone())));
+}
+
+TEST(LtlToBuchiTest, Automaton) {
+  auto a = boolProp("a");
+  auto b = boolProp("b");
+  BuchiAutomaton automaton(Until(a, b));
+  automaton.explore();
+  EXPECT_EQ(automaton.getStatesCount(), 2u);
+  EXPECT_EQ(automaton.getAcceptanceSetsCount(), 1u);
+  EXPECT_FALSE(automaton.isEmpty());
+}
+
+TEST(LtlToBuchiTest, Refinement) {
+  auto makeContract = [](const std::string &name, const std::string &var,
+                         bool always) {
+    auto v = new Variable(new Boolean(), new Name(var));
+    auto c = new Contract(name);
+    c->addDeclaration(v);
+    if (always)
+      c->addGuarantees(logic, Always(Prop(v)));
+    else
+      c->addGuarantees(logic, Eventually(Prop(v)));
+    return c;
+  };
+
+  names_projection_map correspondences;
+  correspondences["b"] = "a";
+  EXPECT_TRUE(checkRefinementLTL(makeContract("c1", "a", true),
+                                 makeContract("c2", "b", false),
+                                 correspondences));
+  correspondences.clear();
+  correspondences["a"] = "b";
+  EXPECT_FALSE(checkRefinementLTL(makeContract("c2", "b", false),
+                                  makeContract("c1", "a", true),
+                                  correspondences));
+}
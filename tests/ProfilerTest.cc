@@ -0,0 +1,116 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chase;
+
+namespace {
+
+const profile_entry *findEntry(const std::vector<profile_entry> &summary,
+                               const std::string &name) {
+  for (auto &e : summary)
+    if (e.name == name)
+      return &e;
+  return nullptr;
+}
+
+} // namespace
+
+TEST(ProfilerTest, Disabled) {
+  resetProfile();
+  setProfilingEnabled(false);
+  {
+    ScopedTimer t("disabled");
+    addProfileCounter("disabled");
+  }
+  EXPECT_EQ(findEntry(getProfileSummary(), "disabled"), nullptr);
+  EXPECT_TRUE(getProfileCounters().empty());
+}
+
+TEST(ProfilerTest, NestedScopes) {
+  resetProfile();
+  setProfilingEnabled(true);
+  for (int i = 0; i < 3; ++i) {
+    ScopedTimer outer("outer");
+    for (int j = 0; j < 2; ++j) {
+      ScopedTimer inner("inner");
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+  }
+  setProfilingEnabled(false);
+
+  auto summary = getProfileSummary();
+  auto outer = findEntry(summary, "outer");
+  auto inner = findEntry(summary, "inner");
+  ASSERT_NE(outer, nullptr);
+  ASSERT_NE(inner, nullptr);
+  EXPECT_EQ(outer->calls, 3u);
+  EXPECT_EQ(inner->calls, 6u);
+  EXPECT_GE(outer->total, inner->total);
+  EXPECT_EQ(inner->self, inner->total);
+  EXPECT_LE(outer->self, outer->total - inner->total);
+  // Sorted by self time.
+  EXPECT_EQ(summary.front().name, "inner");
+  resetProfile();
+}
+
+TEST(ProfilerTest, ThreadsAndExport) {
+  resetProfile();
+  setProfilingEnabled(true, true);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([] {
+      for (int i = 0; i < 100; ++i) {
+        ScopedTimer timer("work");
+        addProfileCounter("items", 2);
+      }
+    });
+  for (auto &t : threads)
+    t.join();
+  setProfilingEnabled(false);
+
+  auto work = findEntry(getProfileSummary(), "work");
+  ASSERT_NE(work, nullptr);
+  EXPECT_EQ(work->calls, 400u);
+  EXPECT_EQ(getProfileCounters()["items"], 800);
+  EXPECT_EQ(getProfileTrace().size(), 400u);
+
+  std::ostringstream trace, table;
+  writeChromeTrace(trace);
+  EXPECT_NE(trace.str().find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(trace.str().find("\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(trace.str().find("\"items\":800"), std::string::npos);
+  printProfileSummary(table);
+  EXPECT_NE(table.str().find("work"), std::string::npos);
+  resetProfile();
+}
+
+#ifdef CHASE_PROFILING
+TEST(ProfilerTest, InstrumentedAlgebra) {
+  resetProfile();
+  setProfilingEnabled(true);
+  auto c1 = new Contract("c1");
+  auto c2 = new Contract("c2");
+  auto a = new Variable(new Boolean(), new Name("a"));
+  c1->addDeclaration(a);
+  c1->addGuarantees(logic, Always(Prop(a)));
+  names_projection_map correspondences;
+  Contract *r = Contract::composition(c1, c2, correspondences);
+  setProfilingEnabled(false);
+
+  auto summary = getProfileSummary();
+  EXPECT_NE(findEntry(summary, "Contract::composition"), nullptr);
+  EXPECT_NE(findEntry(summary, "Contract::mergeDeclarations"), nullptr);
+  EXPECT_NE(findEntry(summary, "ClonedDeclarationVisitor"), nullptr);
+  EXPECT_EQ(getProfileCounters()["Contract::mergeDeclarations::declarations"],
+            1);
+  resetProfile();
+  delete r;
+  delete c1;
+  delete c2;
+}
+#endif
@@ -0,0 +1,99 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+using namespace chase;
+
+TEST(SimplexTest, Rational) {
+  Rational a(1, 3), b(-2, 6);
+  EXPECT_EQ(a + b, Rational(0));
+  EXPECT_EQ(a * Rational(3), Rational(1));
+  EXPECT_EQ(Rational(7, 2).floor(), Rational(3));
+  EXPECT_EQ(Rational(-7, 2).floor(), Rational(-4));
+  EXPECT_EQ(Rational(-7, 2).ceil(), Rational(-3));
+  EXPECT_EQ(Rational::fromDouble(0.1), Rational(1, 10));
+  EXPECT_EQ(Rational::fromDouble(-2.75), Rational(-11, 4));
+}
+
+TEST(SimplexTest, Feasibility) {
+  auto x = new Variable(new Real(), new Name("x"));
+  auto y = new Variable(new Real(), new Name("y"));
+
+  SimplexSolver s;
+  // x + y <= 4, x - y >= 1, y >= 1/2
+  s.addConstraint(LE(Sum(Id(x), Id(y)), IntVal(4)));
+  s.addConstraint(GE(Sub(Id(x), Id(y)), IntVal(1)));
+  s.addConstraint(GE(Mult(IntVal(2), Id(y)), IntVal(1)));
+  ASSERT_EQ(s.check(), simplex_sat);
+
+  Rational vx = s.getValue(x), vy = s.getValue(y);
+  EXPECT_LE(vx + vy, Rational(4));
+  EXPECT_GE(vx - vy, Rational(1));
+  EXPECT_GE(vy, Rational(1, 2));
+
+  // x + y >= 5 contradicts the first constraint.
+  s.push();
+  s.addConstraint(GE(Sum(Id(x), Id(y)), IntVal(5)));
+  EXPECT_EQ(s.check(), simplex_unsat);
+  s.pop();
+  EXPECT_EQ(s.check(), simplex_sat);
+}
+
+TEST(SimplexTest, ExactOnly) {
+  auto x = new Variable(new Real(), new Name("x"));
+  auto y = new Variable(new Real(), new Name("y"));
+
+  SimplexSolver s;
+  s.setFastPath(false);
+  // 3x = 1, y = x / 3
+  s.addConstraint(Eq(Mult(IntVal(3), Id(x)), IntVal(1)));
+  s.addConstraint(Eq(Id(y), Div(Id(x), IntVal(3))));
+  ASSERT_EQ(s.check(), simplex_sat);
+  EXPECT_EQ(s.getValue(x), Rational(1, 3));
+  EXPECT_EQ(s.getValue(y), Rational(1, 9));
+}
+
+TEST(SimplexTest, Integers) {
+  auto x = new Variable(new Integer(), new Name("x"));
+  auto y = new Variable(new Integer(), new Name("y"));
+
+  SimplexSolver s;
+  // 2x + 2y = 3 has rational solutions only.
+  s.addConstraint(Eq(Sum(Mult(IntVal(2), Id(x)), Mult(IntVal(2), Id(y))),
+                     IntVal(3)));
+  s.addConstraint(GE(Id(x), IntVal(0)));
+  s.addConstraint(GE(Id(y), IntVal(0)));
+  EXPECT_EQ(s.check(), simplex_unsat);
+
+  SimplexSolver t;
+  // 3x + 2y = 7, x >= 0, y >= 0 -> x = 1, y = 2.
+  t.addConstraint(Eq(Sum(Mult(IntVal(3), Id(x)), Mult(IntVal(2), Id(y))),
+                     IntVal(7)));
+  t.addConstraint(GE(Id(x), IntVal(0)));
+  t.addConstraint(GE(Id(y), IntVal(0)));
+  ASSERT_EQ(t.check(), simplex_sat);
+  EXPECT_EQ(t.getValue(x), Rational(1));
+  EXPECT_EQ(t.getValue(y), Rational(2));
+}
+
+TEST(SimplexTest, TypeBoundsSurvivePop) {
+  auto x = new Variable(new Integer(0, 10), new Name("x"));
+  auto y = new Variable(new Real(-1, 1), new Name("y"));
+
+  SimplexSolver s;
+  // The variables are first seen inside a scope.
+  s.push();
+  s.addConstraint(GE(Sum(Id(x), Id(y)), IntVal(2)));
+  EXPECT_EQ(s.check(), simplex_sat);
+  s.pop();
+
+  // Only the type bounds are violated.
+  s.push();
+  s.addConstraint(GE(Id(x), IntVal(11)));
+  EXPECT_EQ(s.check(), simplex_unsat);
+  s.pop();
+  s.push();
+  s.addConstraint(LE(Id(y), IntVal(-2)));
+  EXPECT_EQ(s.check(), simplex_unsat);
+  s.pop();
+  EXPECT_EQ(s.check(), simplex_sat);
+}
@@ -1,7 +1,13 @@
 #include "representation/System.hh"
 #include "representation/Component.hh"
 #include "representation/Contract.hh"
+#include "representation/Identifier.hh"
+#include "representation/Proposition.hh"
+#include "representation/UnaryTemporalFormula.hh"
+#include "utilities/Factory.hh"
+#include "utilities/InteractionGraph.hh"
 #include <gtest/gtest.h>
+#include <set>
 #include <string>
 
 using namespace chase;
@@ -31,3 +37,150 @@ TEST(SystemTest, AddComponent) {
   EXPECT_EQ(components.size(), 1);
   EXPECT_EQ(*components.begin(), c);
 }
+
+TEST(SystemTest, LazyClone) {
+  auto s = new System("TestSystem");
+  auto c1 = new Contract("c1");
+  auto c2 = new Contract("c2");
+  s->addContract(c1);
+  s->addContract(c2);
+
+  System *clone = s->lazyClone();
+  EXPECT_EQ(clone->getContractsSet(), s->getContractsSet());
+  EXPECT_TRUE(clone->isShared(c1));
+  EXPECT_TRUE(s->isShared(c1));
+
+  // The edited contract is copied, the other one stays shared.
+  Contract *edited = clone->getMutableContract(c1);
+  EXPECT_NE(edited, c1);
+  edited->setName(new Name("edited"));
+  EXPECT_EQ(c1->getName()->getString(), "c1");
+  EXPECT_EQ(clone->getContractsSet().count(c1), 0u);
+  EXPECT_EQ(clone->getContractsSet().count(c2), 1u);
+  EXPECT_FALSE(s->isShared(c1));
+  EXPECT_TRUE(s->isShared(c2));
+
+  // The last holder owns the object, and edits it in place.
+  EXPECT_EQ(s->getMutableContract(c1), c1);
+  delete s;
+  EXPECT_FALSE(clone->isShared(c2));
+  EXPECT_EQ(clone->getMutableContract(c2), c2);
+  delete clone;
+}
+
+TEST(SystemTest, LazyCloneDeclarations) {
+  auto s = new System("TestSystem");
+  auto v = new Variable(new Boolean(), new Name("v"));
+  s->addDeclaration(v);
+  auto c = new Contract("c");
+  c->addGuarantees(logic, Always(Prop(v)));
+  s->addContract(c);
+
+  System *clone = s->lazyClone();
+  Declaration *copy = clone->getMutableDeclaration(v);
+  EXPECT_NE(copy, v);
+  EXPECT_EQ(clone->getDeclarationsSet().front(), copy);
+
+  // The contract referring to the declaration is copied and redirected.
+  Contract *cc = *clone->getContractsSet().begin();
+  EXPECT_NE(cc, c);
+  auto g = dynamic_cast<UnaryTemporalFormula *>(cc->guarantees[logic]);
+  auto p = dynamic_cast<Proposition *>(g->getFormula());
+  EXPECT_EQ(dynamic_cast<Identifier *>(p->getValue())->getDeclaration(), copy);
+  g = dynamic_cast<UnaryTemporalFormula *>(c->guarantees[logic]);
+  p = dynamic_cast<Proposition *>(g->getFormula());
+  EXPECT_EQ(dynamic_cast<Identifier *>(p->getValue())->getDeclaration(), v);
+
+  delete clone;
+  delete s;
+}
+
+TEST(SystemTest, LazyCloneParents) {
+  auto s = new System("TestSystem");
+  s->addDeclaration(new Variable(new Boolean(), new Name("v")));
+  s->addContract(new Contract("c1"));
+  s->addContract(new Contract("c2"));
+  s->addComponent(new Component(new ComponentDefinition("d"), "k"));
+
+  System *clone = s->lazyClone();
+  System *second = clone->lazyClone();
+  delete s;
+
+  // The shared objects are moved to the surviving holders.
+  for (System *system : {clone, second}) {
+    for (auto d : system->getDeclarationsSet())
+      EXPECT_TRUE(d->getParent() == clone || d->getParent() == second);
+    for (auto c : system->getContractsSet())
+      EXPECT_TRUE(c->getParent() == clone || c->getParent() == second);
+    for (auto c : system->getComponentsSet())
+      EXPECT_TRUE(c->getParent() == clone || c->getParent() == second);
+  }
+
+  delete clone;
+  for (auto c : second->getContractsSet())
+    EXPECT_EQ(c->getParent(), second);
+  for (auto d : second->getDeclarationsSet())
+    EXPECT_EQ(d->getParent(), second);
+  EXPECT_FALSE(second->isShared(*second->getContractsSet().begin()));
+  delete second;
+}
+
+TEST(SystemTest, InteractionGraph) {
+  // Two groups of contracts, {a0, a1, a2} on x and {b0, b1, b2} on y, joined
+  // by z, shared by a2 and b0. b2 names y as w, through its correspondences.
+  auto s = new System("s");
+  for (const char *name : {"x", "y", "z"})
+    s->addDeclaration(new Variable(new Boolean(), new Name(name)));
+  std::map<std::string, std::vector<std::string>> variables = {
+      {"a0", {"x"}},      {"a1", {"x"}}, {"a2", {"x", "z"}},
+      {"b0", {"y", "z"}}, {"b1", {"y"}}, {"b2", {"w", "local"}}};
+  system_correspondences correspondences;
+  for (auto &c : variables) {
+    auto contract = new Contract(c.first);
+    for (auto &v : c.second)
+      contract->addDeclaration(new Variable(new Boolean(), new Name(v)));
+    // Not a variable: ignored.
+    contract->addDeclaration(
+        new Constant(new Boolean(), new Name("x"), new BooleanValue(true)));
+    s->addContract(contract);
+    if (c.first == "b2")
+      correspondences[contract]["w"] = "y";
+  }
+
+  interaction_graph interactions = buildInteractionGraph(s, correspondences);
+  Graph *g = interactions.graph;
+  ASSERT_EQ(g->getSize(), 6u);
+  EXPECT_EQ(interactions.contracts[0]->getName()->getString(), "a0");
+  EXPECT_EQ(g->getVertex(5)->getName()->getString(), "b2");
+  // Three edges per group, plus the one on z.
+  ASSERT_EQ(g->getEdgesCount(), 7u);
+  ASSERT_EQ(interactions.shared.size(), 7u);
+  for (unsigned int e = 0; e < 7; ++e) {
+    ASSERT_EQ(interactions.shared[e].size(), 1u);
+    std::string name = interactions.shared[e][0]->getName()->getString();
+    bool a = g->getEdgeSource(e) < 3, b = g->getEdgeTarget(e) < 3;
+    EXPECT_EQ(name, a && b ? "x" : !a && !b ? "y" : "z");
+    // The declarations of the system label the edges.
+    EXPECT_EQ(interactions.shared[e][0]->getParent(), s);
+  }
+  EXPECT_EQ(g->getAdjacentNodes(5), (std::set<unsigned int>{3, 4}));
+  for (unsigned int v = 0; v < g->getSize(); ++v)
+    delete g->getVertex(v);
+  delete g;
+
+  system_partition partition = partitionSystem(s, 2, correspondences);
+  ASSERT_EQ(partition.clusters.size(), 2u);
+  EXPECT_EQ(partition.clusters[0].size(), 3u);
+  EXPECT_EQ(partition.clusters[1].size(), 3u);
+  EXPECT_EQ(partition.cut, 1.0);
+  ASSERT_EQ(partition.interface.size(), 1u);
+  EXPECT_EQ(partition.interface[0]->getName()->getString(), "z");
+  std::set<std::string> first;
+  for (auto c : partition.clusters[0])
+    first.insert(c->getName()->getString());
+  EXPECT_TRUE(first == (std::set<std::string>{"a0", "a1", "a2"}) ||
+              first == (std::set<std::string>{"b0", "b1", "b2"}));
+
+  EXPECT_THROW(partitionSystem(s, 0), ChaseError);
+  delete s;
+}
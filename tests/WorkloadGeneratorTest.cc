@@ -0,0 +1,97 @@
+#include "chase-core.hh"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace chase;
+
+TEST(WorkloadGeneratorTest, Reproducible) {
+  workload_options options(3, 4, 3, 2);
+  options.pool = 6;
+
+  WorkloadGenerator g1(7), g2(7), g3(8);
+  System *s1 = g1.generateSystem(options);
+  System *s2 = g2.generateSystem(options);
+  System *s3 = g3.generateSystem(options);
+
+  std::string str1, str2, str3;
+  for (auto c : s1->getContractsSet())
+    str1 += c->getString();
+  for (auto c : s2->getContractsSet())
+    str2 += c->getString();
+  for (auto c : s3->getContractsSet())
+    str3 += c->getString();
+  // Contracts are stored by address: compare the sorted texts.
+  std::sort(str1.begin(), str1.end());
+  std::sort(str2.begin(), str2.end());
+  std::sort(str3.begin(), str3.end());
+  EXPECT_EQ(str1, str2);
+  EXPECT_NE(str1, str3);
+
+  EXPECT_EQ(s1->getContractsSet().size(), 3u);
+  EXPECT_EQ(s1->getDeclarationsSet().size(), 6u);
+  EXPECT_EQ(g1.next(), g2.next());
+}
+
+TEST(WorkloadGeneratorTest, Contracts) {
+  WorkloadGenerator g(1);
+  workload_options options(1, 5, 2, 3);
+  options.pool = 20;
+  options.temporal = 1.0;
+  Contract *c = g.generateContract("c", options);
+
+  ASSERT_EQ(c->declarations.size(), 5u);
+  std::vector<std::string> names;
+  for (auto d : c->declarations)
+    names.push_back(d->getName()->getString());
+  std::sort(names.begin(), names.end());
+  EXPECT_EQ(std::unique(names.begin(), names.end()), names.end());
+
+  auto g1 = dynamic_cast<LargeBooleanFormula *>(c->guarantees[logic]);
+  ASSERT_NE(g1, nullptr);
+  EXPECT_EQ(g1->operands.size(), 3u);
+}
+
+TEST(WorkloadGeneratorTest, Distributions) {
+  WorkloadGenerator g(3);
+  std::vector<int> counts(10, 0);
+  for (int i = 0; i < 100000; ++i)
+    ++counts[g.uniform(10)];
+  for (int c : counts) {
+    EXPECT_GT(c, 9000);
+    EXPECT_LT(c, 11000);
+  }
+  double x = g.uniformReal();
+  EXPECT_GE(x, 0.0);
+  EXPECT_LT(x, 1.0);
+  EXPECT_EQ(g.generateString(5, "p_", "_s").size(), 9u);
+}
+
+TEST(WorkloadGeneratorTest, Graphs) {
+  WorkloadGenerator g(5);
+  edge_list edges;
+  const unsigned int size = 20000, m = 3;
+  g.generatePowerLawEdges(size, m, edges);
+  EXPECT_GT(edges.size(), (size - 1) * m * 99 / 100);
+  EXPECT_LE(edges.size(), (size - 1) * m);
+
+  std::vector<unsigned int> degree(size, 0);
+  for (auto &e : edges) {
+    EXPECT_LT(e.second, e.first);
+    ++degree[e.first];
+    ++degree[e.second];
+  }
+  // Preferential attachment creates hubs.
+  EXPECT_GT(*std::max_element(degree.begin(), degree.end()), 20 * m);
+
+  g.generateGridEdges(4, 5, edges);
+  EXPECT_EQ(edges.size(), 4u * 4 + 3u * 5);
+
+  Graph *grid = g.generateGridGraph(3, 3);
+  EXPECT_EQ(grid->getSize(), 9u);
+  EXPECT_NE(grid->getEdge(4, 5), nullptr);
+  EXPECT_NE(grid->getEdge(4, 7), nullptr);
+  EXPECT_EQ(grid->getVertexIndex("n8"), 8);
+}